@@ -6,16 +6,35 @@
  * text-based front-end.  When the SFML GUI is ready, a separate
  * `src/gui/main_gui.cpp` entry-point will reuse the same Kernel
  * through the Game / Session API.
+ *
+ * Usage:
+ * @code
+ *   rsp_console [--plugins DIR] [--strategy NAME]
+ *   rsp_console --serve NAME      # run the kernel for shared-memory front-ends
+ *   rsp_console --connect NAME    # play through a kernel started with --serve
+ * @endcode
+ * With --plugins, strategy plugins in DIR are (re)loaded before every
+ * session, so a plugin dropped into or rebuilt in DIR is picked up by
+ * the next session without restarting.  --strategy selects the plugin
+ * strategy to play against (default: the built-in ComputerAI).
+ *
+ * With --serve, this process only hosts the kernel (see ShmServer) until
+ * Enter is pressed; --connect runs the console front-end against it.
  */
 
 #include "kernel/Game.h"
 #include "kernel/User.h"
 #include "kernel/ComputerAI.h"
+#include "kernel/PluginLoader.h"
+#include "kernel/ShmClient.h"
+#include "kernel/ShmServer.h"
 
+#include <chrono>
 #include <iostream>
 #include <limits>
 #include <string>
 #include <memory>
+#include <vector>
 
 /**
  * @brief Reads a valid Combination choice from the console.
@@ -37,7 +56,69 @@ static Combination readUserChoice() {
     return static_cast<Combination>(choice - 1);
 }
 
-int main() {
+/**
+ * @brief Hosts the kernel for shared-memory front-ends until Enter.
+ */
+static int serveKernel(const std::string& name) {
+    ShmServer server;
+    if (!server.start(name)) {
+        std::cerr << "  Could not create shared-memory segment " << name << "\n";
+        return 1;
+    }
+    std::cout << "  Kernel serving front-ends on " << name << ". Press Enter to stop.\n";
+    std::string line;
+    std::getline(std::cin, line);
+    std::cout << "  Served " << server.getRoundsServed() << " rounds.\n";
+    return 0;
+}
+
+/**
+ * @brief Console front-end talking to a kernel started with --serve.
+ */
+static int playRemote(const std::string& name) {
+    std::string username;
+    std::cout << "  Enter your name: ";
+    std::getline(std::cin, username);
+
+    ShmClient client;
+    if (!client.connect(name, username.empty() ? "Player" : username)) {
+        std::cerr << "  No kernel with a free slot on " << name << "\n";
+        return 1;
+    }
+    const auto timeout = std::chrono::microseconds(5000000);
+    ShmEvent e;
+    std::string again = "y";
+    while (again == "y" || again == "Y") {
+        if (!client.newSession(Session::DEFAULT_ROUNDS) || !client.waitEvent(e, timeout)) break;
+        const std::int64_t rounds = e.round; // SessionStarted carries the round count
+        for (std::int64_t r = 0; r < rounds; ++r) {
+            if (!client.play(readUserChoice()) || !client.waitEvent(e, timeout)) return 1;
+            std::cout << "  Round " << (e.round + 1) << ": "
+                      << combinationLabel(static_cast<Combination>(e.userHand)) << " vs "
+                      << combinationLabel(static_cast<Combination>(e.computerHand)) << " -> "
+                      << moveResultLabel(static_cast<MoveResult>(e.result)) << "\n";
+        }
+        if (!client.waitEvent(e, timeout)) return 1; // SessionOver
+        std::cout << "\n  Score " << e.userScore << " : " << e.computerScore
+                  << " (draws " << e.drawCount << ")\n  Play again? (y/n): ";
+        std::cin >> again;
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return client.isConnected() ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    std::string pluginDir;
+    std::string strategy;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string key = argv[i];
+        if (key == "--plugins")       pluginDir = argv[i + 1];
+        else if (key == "--strategy") strategy  = argv[i + 1];
+        else if (key == "--serve")    return serveKernel(argv[i + 1]);
+        else if (key == "--connect")  return playRemote(argv[i + 1]);
+    }
+    PluginLoader plugins;
+
     std::cout << "\n"
               << "  =============================================\n"
               << "       Rock - Scissors - Paper   (Console)\n"
@@ -63,7 +144,24 @@ int main() {
 
     // ── Game loop: play sessions until the user quits ──────────────
     std::string again = "y";
+    std::size_t pluginErrorsShown = 0;
     while (again == "y" || again == "Y") {
+        if (!pluginDir.empty()) {
+            if (plugins.refresh(pluginDir) > 0) {
+                std::cout << "  Loaded strategy plugins from " << pluginDir << "\n";
+            }
+            const std::vector<std::string> errors = plugins.getErrors();
+            for (; pluginErrorsShown < errors.size(); ++pluginErrorsShown) {
+                std::cerr << "  Plugin error: " << errors[pluginErrorsShown] << "\n";
+            }
+            if (!strategy.empty()) {
+                if (plugins.find(strategy)) {
+                    game.setComputer(plugins.createPlayer(strategy));
+                } else {
+                    std::cout << "  Strategy '" << strategy << "' not found; keeping current opponent.\n";
+                }
+            }
+        }
         game.newSession();  // default 10 rounds
 
         while (game.getState() == GameState::Running) {
@@ -0,0 +1,35 @@
+/**
+ * @file BeatLastPlugin.cpp
+ * @brief Example strategy plugin: plays what beats the opponent's last hand.
+ *
+ * Built as a loadable module (see add_strategy_plugin() in
+ * CMakeLists.txt) and picked up at run time by PluginLoader, e.g.
+ * `rsp_console --plugins <dir> --strategy beat-last`.
+ */
+#include "kernel/PluginAbi.h"
+#include "kernel/Combination.h"
+
+namespace {
+
+class BeatLastStrategy : public IPlayer {
+public:
+    std::string getName() const override { return "BeatLast"; }
+
+    Hand chooseHand() override {
+        return hasLast_ ? Hand(counterTo(last_)) : Hand::generateCombination();
+    }
+
+    void observeRound(const Hand& own, const Hand& opponent) override {
+        (void)own;
+        last_ = opponent.getCombination();
+        hasLast_ = true;
+    }
+
+private:
+    Combination last_ = Combination::Rock;
+    bool hasLast_ = false;
+};
+
+} // namespace
+
+RSP_DEFINE_STRATEGY_PLUGIN(BeatLastStrategy, "beat-last", "1.0")
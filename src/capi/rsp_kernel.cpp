@@ -0,0 +1,253 @@
+#include "capi/rsp_kernel.h"
+#include "kernel/ComputerAI.h"
+#include "kernel/MetaAI.h"
+#include "kernel/Session.h"
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <string>
+
+namespace {
+
+/// Rounds handed to Session::playBatch() per step, bounding scratch memory.
+constexpr std::int64_t CHUNK_ROUNDS = 4096;
+
+thread_local std::string lastError;
+
+std::int32_t fail(std::int32_t status, const char* message) {
+    lastError = message;
+    return status;
+}
+
+/// Result of user gesture u against computer gesture c, indexed u * 3 + c.
+constexpr std::uint8_t RESULT_TABLE[9] = {
+    RSP_DRAW,          RSP_USER_WINS, RSP_COMPUTER_WINS,  // Rock vs R/S/P
+    RSP_COMPUTER_WINS, RSP_DRAW,      RSP_USER_WINS,      // Scissors vs R/S/P
+    RSP_USER_WINS,     RSP_COMPUTER_WINS, RSP_DRAW        // Paper vs R/S/P
+};
+
+bool validGestures(const std::uint8_t* gestures, std::size_t count) {
+    return std::all_of(gestures, gestures + count, [](std::uint8_t g) { return g < 3; });
+}
+
+/**
+ * @brief Player whose hands are read from a caller buffer, one batch
+ *        at a time.
+ */
+class ExternalPlayer : public IPlayer {
+public:
+    explicit ExternalPlayer(std::string_view name) : name_(name) {}
+
+    void feed(const std::uint8_t* gestures) { next_ = gestures; }
+
+    Hand chooseHand() override {
+        return Hand(static_cast<Combination>(*next_++));
+    }
+
+    void chooseHands(Hand* out, std::size_t count) override {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = Hand(static_cast<Combination>(next_[i]));
+        }
+        next_ += count;
+    }
+
+    // The gestures are fixed before the batch starts.
+    bool isBatchable() const override { return true; }
+
+    std::string getName() const override { return name_; }
+    std::string_view getNameView() const override { return name_; }
+
+private:
+    std::string name_;
+    const std::uint8_t* next_ = nullptr;
+};
+
+std::shared_ptr<IPlayer> makePlayer(const rsp_player_spec* spec, const char* name,
+                                    std::uint32_t stream,
+                                    std::shared_ptr<ExternalPlayer>& external) {
+    const std::int32_t kind = spec ? spec->kind : RSP_PLAYER_RANDOM;
+    switch (kind) {
+        case RSP_PLAYER_RANDOM:
+            return std::make_shared<ComputerAI>(name);
+        case RSP_PLAYER_SEEDED:
+            return std::make_shared<ComputerAI>(name, spec->seed, 0, stream);
+        case RSP_PLAYER_META:
+            return std::make_shared<MetaAI>(name);
+        case RSP_PLAYER_EXTERNAL:
+            external = std::make_shared<ExternalPlayer>(name);
+            return external;
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace
+
+struct rsp_session {
+    std::shared_ptr<ExternalPlayer> userFeed;     ///< Set for external users.
+    std::shared_ptr<ExternalPlayer> computerFeed; ///< Set for external computers.
+    std::unique_ptr<Session> session;
+
+    // Output cursors for the batch callback during rsp_session_play().
+    std::uint8_t* userOut = nullptr;
+    std::uint8_t* computerOut = nullptr;
+    std::uint8_t* resultOut = nullptr;
+};
+
+extern "C" {
+
+uint32_t rsp_abi_version(void) {
+    return RSP_ABI_VERSION;
+}
+
+const char* rsp_last_error(void) {
+    return lastError.c_str();
+}
+
+rsp_session* rsp_session_create(const rsp_player_spec* user,
+                                const rsp_player_spec* computer,
+                                int64_t rounds,
+                                uint64_t history_limit) {
+    if (rounds <= 0) {
+        fail(RSP_ERR_INVALID_ARGUMENT, "rounds must be positive");
+        return nullptr;
+    }
+    try {
+        auto handle = std::make_unique<rsp_session>();
+        auto u = makePlayer(user, "User", 0, handle->userFeed);
+        auto c = makePlayer(computer, "Computer", 1, handle->computerFeed);
+        if (!u || !c) {
+            fail(RSP_ERR_INVALID_ARGUMENT, "unknown player kind");
+            return nullptr;
+        }
+        const std::size_t limit = history_limit == 0
+            ? MoveHistory::UNLIMITED
+            : static_cast<std::size_t>(std::min<std::uint64_t>(history_limit, MoveHistory::UNLIMITED));
+        handle->session = std::make_unique<Session>(u, c, rounds, limit);
+
+        rsp_session* h = handle.get();
+        h->session->onBatchCompleted([h](std::int64_t, const Move* moves, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) {
+                if (h->userOut) {
+                    h->userOut[i] = static_cast<std::uint8_t>(moves[i].getUserHand().getCombination());
+                }
+                if (h->computerOut) {
+                    h->computerOut[i] = static_cast<std::uint8_t>(moves[i].getComputerHand().getCombination());
+                }
+                if (h->resultOut) {
+                    h->resultOut[i] = static_cast<std::uint8_t>(moves[i].getWhoWins());
+                }
+            }
+        });
+        return handle.release();
+    } catch (const std::exception& e) {
+        fail(RSP_ERR_INTERNAL, e.what());
+        return nullptr;
+    }
+}
+
+void rsp_session_destroy(rsp_session* session) {
+    delete session;
+}
+
+int64_t rsp_session_play(rsp_session* session, int64_t rounds,
+                         const uint8_t* user_in, const uint8_t* computer_in,
+                         uint8_t* user_out, uint8_t* computer_out,
+                         uint8_t* result_out) {
+    if (!session || rounds < 0) {
+        return fail(RSP_ERR_INVALID_ARGUMENT, "null session or negative round count");
+    }
+    Session& s = *session->session;
+    const std::int64_t remaining = s.getTotalRounds() - s.getRoundsPlayed();
+    if (remaining <= 0) {
+        return fail(RSP_ERR_FINISHED, "all rounds have already been played");
+    }
+    const std::int64_t total = std::min(rounds, remaining);
+    const std::size_t n = static_cast<std::size_t>(total);
+    if ((session->userFeed && (!user_in || !validGestures(user_in, n))) ||
+        (session->computerFeed && (!computer_in || !validGestures(computer_in, n)))) {
+        return fail(RSP_ERR_INVALID_ARGUMENT, "missing or invalid external gestures");
+    }
+
+    try {
+        if (session->userFeed) session->userFeed->feed(user_in);
+        if (session->computerFeed) session->computerFeed->feed(computer_in);
+        session->userOut = user_out;
+        session->computerOut = computer_out;
+        session->resultOut = result_out;
+
+        std::int64_t played = 0;
+        while (played < total) {
+            const std::int64_t step = s.playBatch(std::min(CHUNK_ROUNDS, total - played));
+            played += step;
+            if (session->userOut) session->userOut += step;
+            if (session->computerOut) session->computerOut += step;
+            if (session->resultOut) session->resultOut += step;
+        }
+        return played;
+    } catch (const std::exception& e) {
+        return fail(RSP_ERR_INTERNAL, e.what());
+    }
+}
+
+int32_t rsp_session_score(const rsp_session* session, rsp_score* out) {
+    if (!session || !out) {
+        return fail(RSP_ERR_INVALID_ARGUMENT, "null session or output");
+    }
+    const Session& s = *session->session;
+    out->user_wins     = s.getUserScore();
+    out->computer_wins = s.getComputerScore();
+    out->draws         = s.getDrawCount();
+    out->rounds_played = s.getRoundsPlayed();
+    out->total_rounds  = s.getTotalRounds();
+    out->running       = s.isRunning() ? 1 : 0;
+    return RSP_OK;
+}
+
+int64_t rsp_session_history(const rsp_session* session, int64_t first, int64_t count,
+                            uint8_t* user_out, uint8_t* computer_out) {
+    if (!session || first < 0 || count < 0) {
+        return fail(RSP_ERR_INVALID_ARGUMENT, "null session or negative range");
+    }
+    try {
+        const MoveHistory& moves = session->session->getMoves();
+        const std::int64_t played = static_cast<std::int64_t>(moves.size());
+        const std::int64_t n = std::max<std::int64_t>(0, std::min(count, played - first));
+        for (std::int64_t i = 0; i < n; ++i) {
+            const Move m = moves[static_cast<std::uint64_t>(first + i)];
+            if (user_out) user_out[i] = static_cast<std::uint8_t>(m.getUserHand().getCombination());
+            if (computer_out) computer_out[i] = static_cast<std::uint8_t>(m.getComputerHand().getCombination());
+        }
+        return n;
+    } catch (const std::exception& e) {
+        return fail(RSP_ERR_INTERNAL, e.what());
+    }
+}
+
+int32_t rsp_score_batch(const uint8_t* user, const uint8_t* computer, size_t count,
+                        uint8_t* result_out, rsp_score* totals) {
+    if (count > 0 && (!user || !computer)) {
+        return fail(RSP_ERR_INVALID_ARGUMENT, "null gesture buffer");
+    }
+    if (!validGestures(user, count) || !validGestures(computer, count)) {
+        return fail(RSP_ERR_INVALID_ARGUMENT, "invalid gesture");
+    }
+    std::int64_t tally[3] = {0, 0, 0};
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint8_t r = RESULT_TABLE[user[i] * 3 + computer[i]];
+        ++tally[r];
+        if (result_out) result_out[i] = r;
+    }
+    if (totals) {
+        totals->user_wins     = tally[RSP_USER_WINS];
+        totals->computer_wins = tally[RSP_COMPUTER_WINS];
+        totals->draws         = tally[RSP_DRAW];
+        totals->rounds_played = static_cast<std::int64_t>(count);
+        totals->total_rounds  = 0;
+        totals->running       = 0;
+    }
+    return RSP_OK;
+}
+
+} // extern "C"
@@ -0,0 +1,164 @@
+#ifndef RSP_KERNEL_H
+#define RSP_KERNEL_H
+
+/**
+ * @file rsp_kernel.h
+ * @brief Stable C ABI of the Rock-Scissors-Paper kernel (librsp_kernel).
+ *
+ * Lets other runtimes (C, Rust, Python ctypes, Go cgo, ...) drive the
+ * kernel without C++ types crossing the boundary:
+ * - sessions are opaque handles;
+ * - every call is batch-oriented: one call plays or scores any number
+ *   of rounds, writing gestures and results into caller-provided
+ *   buffers, so the per-call cost is paid once per batch;
+ * - errors are returned as negative status codes, never as exceptions;
+ *   rsp_last_error() gives a message for the calling thread.
+ *
+ * Gestures and results are one byte each:
+ * | value | gesture  | result        |
+ * |-------|----------|---------------|
+ * | 0     | Rock     | user wins     |
+ * | 1     | Scissors | computer wins |
+ * | 2     | Paper    | draw          |
+ *
+ * A session handle may be used by one thread at a time.
+ *
+ * @par Compatibility
+ * Only additions are made within an ABI version.  Check
+ * rsp_abi_version() against RSP_ABI_VERSION at load time.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(RSP_KERNEL_BUILD)
+#    define RSP_API __declspec(dllexport)
+#  else
+#    define RSP_API __declspec(dllimport)
+#  endif
+#else
+#  define RSP_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief ABI version implemented by this header. */
+#define RSP_ABI_VERSION 1
+
+/** @brief Status codes (negative values are errors). */
+enum {
+    RSP_OK                   =  0,
+    RSP_ERR_INVALID_ARGUMENT = -1, /**< Null handle/buffer or bad gesture. */
+    RSP_ERR_FINISHED         = -2, /**< All rounds have been played.       */
+    RSP_ERR_INTERNAL         = -3  /**< Unexpected kernel failure.         */
+};
+
+/** @brief Gesture codes (same values as the kernel's Combination). */
+enum {
+    RSP_ROCK     = 0,
+    RSP_SCISSORS = 1,
+    RSP_PAPER    = 2
+};
+
+/** @brief Round result codes (same values as the kernel's MoveResult). */
+enum {
+    RSP_USER_WINS     = 0,
+    RSP_COMPUTER_WINS = 1,
+    RSP_DRAW          = 2
+};
+
+/** @brief Who chooses a side's gestures. */
+enum {
+    RSP_PLAYER_RANDOM   = 0, /**< Kernel ComputerAI, unseeded.                 */
+    RSP_PLAYER_SEEDED   = 1, /**< Kernel ComputerAI, reproducible from seed.   */
+    RSP_PLAYER_META     = 2, /**< Kernel adaptive MetaAI.                      */
+    RSP_PLAYER_EXTERNAL = 3  /**< Gestures supplied by the caller per batch.   */
+};
+
+/** @brief Describes one side of a session. */
+typedef struct rsp_player_spec {
+    int32_t  kind; /**< One of RSP_PLAYER_*. */
+    uint64_t seed; /**< Used by RSP_PLAYER_SEEDED. */
+} rsp_player_spec;
+
+/** @brief Running totals of a session or a scored batch. */
+typedef struct rsp_score {
+    int64_t user_wins;
+    int64_t computer_wins;
+    int64_t draws;
+    int64_t rounds_played;
+    int64_t total_rounds;  /**< 0 for rsp_score_batch(). */
+    int32_t running;       /**< Non-zero while the session is in progress. */
+} rsp_score;
+
+/** @brief Opaque session handle. */
+typedef struct rsp_session rsp_session;
+
+/** @brief Returns the ABI version of the loaded library. */
+RSP_API uint32_t rsp_abi_version(void);
+
+/**
+ * @brief Returns a description of the calling thread's last error
+ *        ("" if none).  Valid until the thread's next failing call.
+ */
+RSP_API const char* rsp_last_error(void);
+
+/**
+ * @brief Creates a session.
+ * @param user          User side; NULL means RSP_PLAYER_RANDOM.
+ * @param computer      Computer side; NULL means RSP_PLAYER_RANDOM.
+ * @param rounds        Total rounds (> 0).
+ * @param history_limit Rounds of history kept in RAM before spilling to
+ *                      a temporary file; 0 keeps everything in RAM.
+ * @return A handle, or NULL on error (see rsp_last_error()).
+ */
+RSP_API rsp_session* rsp_session_create(const rsp_player_spec* user,
+                                        const rsp_player_spec* computer,
+                                        int64_t rounds,
+                                        uint64_t history_limit);
+
+/** @brief Destroys a session.  NULL is ignored. */
+RSP_API void rsp_session_destroy(rsp_session* session);
+
+/**
+ * @brief Plays up to @p rounds rounds in one call.
+ *
+ * For an RSP_PLAYER_EXTERNAL side the matching input buffer must hold
+ * @p rounds gestures; it is ignored (may be NULL) otherwise.  Any output
+ * buffer may be NULL; non-NULL ones receive one byte per round played.
+ *
+ * @return Rounds played (clipped to the rounds remaining), or a negative
+ *         RSP_ERR_* code.  Nothing is played when an error is returned.
+ */
+RSP_API int64_t rsp_session_play(rsp_session* session, int64_t rounds,
+                                 const uint8_t* user_in, const uint8_t* computer_in,
+                                 uint8_t* user_out, uint8_t* computer_out,
+                                 uint8_t* result_out);
+
+/** @brief Writes the session's totals into @p out. @return RSP_OK or an error. */
+RSP_API int32_t rsp_session_score(const rsp_session* session, rsp_score* out);
+
+/**
+ * @brief Copies rounds [first, first + count) of the history.
+ * @return Rounds copied (clipped to the rounds played), or an error.
+ */
+RSP_API int64_t rsp_session_history(const rsp_session* session, int64_t first, int64_t count,
+                                    uint8_t* user_out, uint8_t* computer_out);
+
+/**
+ * @brief Scores @p count rounds without a session.
+ * @param result_out Receives one result per round (may be NULL).
+ * @param totals     Receives the tallies (may be NULL).
+ * @return RSP_OK or RSP_ERR_INVALID_ARGUMENT.
+ */
+RSP_API int32_t rsp_score_batch(const uint8_t* user, const uint8_t* computer, size_t count,
+                                uint8_t* result_out, rsp_score* totals);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* RSP_KERNEL_H */
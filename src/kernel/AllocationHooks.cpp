@@ -0,0 +1,85 @@
+/**
+ * @file AllocationHooks.cpp
+ * @brief Replacement global operator new / delete feeding AllocationTracker.
+ *
+ * Deliberately NOT part of the `kernel` library: link the
+ * `kernel_alloc_hooks` object library to opt in.  Replacing the global
+ * operators is a whole-program decision, so it must stay explicit.
+ */
+#include "kernel/AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+void* allocate(std::size_t size) {
+    AllocationTracker::recordAllocation(size);
+    if (size == 0) size = 1;
+    while (true) {
+        if (void* p = std::malloc(size)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t al) {
+    AllocationTracker::recordAllocation(size);
+    std::size_t align = static_cast<std::size_t>(al);
+    if (size == 0) size = 1;
+#ifdef _WIN32
+    void* p = _aligned_malloc(size, align);
+#else
+    size = (size + align - 1) / align * align;
+    void* p = std::aligned_alloc(align, size);
+#endif
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void release(void* p) noexcept {
+    if (!p) return;
+    AllocationTracker::recordDeallocation();
+    std::free(p);
+}
+
+void releaseAligned(void* p) noexcept {
+    if (!p) return;
+    AllocationTracker::recordDeallocation();
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+struct Installer {
+    Installer() { AllocationTracker::markInstalled(); }
+} installer;
+
+} // namespace
+
+void* operator new(std::size_t size)   { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return allocate(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return allocate(size); } catch (...) { return nullptr; }
+}
+
+void* operator new(std::size_t size, std::align_val_t al)   { return allocateAligned(size, al); }
+void* operator new[](std::size_t size, std::align_val_t al) { return allocateAligned(size, al); }
+
+void operator delete(void* p) noexcept                          { release(p); }
+void operator delete[](void* p) noexcept                        { release(p); }
+void operator delete(void* p, std::size_t) noexcept             { release(p); }
+void operator delete[](void* p, std::size_t) noexcept           { release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept   { release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { release(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept                { releaseAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept              { releaseAligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept   { releaseAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { releaseAligned(p); }
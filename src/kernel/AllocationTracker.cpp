@@ -0,0 +1,48 @@
+#include "kernel/AllocationTracker.h"
+#include <atomic>
+
+namespace {
+    // Trivially-constructible so the hooks may touch it before main().
+    thread_local AllocationStats tl_stats;
+    std::atomic<bool> g_installed{false};
+}
+
+bool AllocationTracker::isInstalled() noexcept {
+    return g_installed.load(std::memory_order_relaxed);
+}
+
+AllocationStats AllocationTracker::current() noexcept {
+    return tl_stats;
+}
+
+void AllocationTracker::recordAllocation(std::size_t bytes) noexcept {
+    ++tl_stats.allocations;
+    tl_stats.bytes += bytes;
+}
+
+void AllocationTracker::recordDeallocation() noexcept {
+    ++tl_stats.deallocations;
+}
+
+void AllocationTracker::markInstalled() noexcept {
+    g_installed.store(true, std::memory_order_relaxed);
+}
+
+AllocationScope::AllocationScope() noexcept
+    : start_(AllocationTracker::current())
+{}
+
+AllocationStats AllocationScope::delta() const noexcept {
+    AllocationStats now = AllocationTracker::current();
+    return {now.allocations   - start_.allocations,
+            now.deallocations - start_.deallocations,
+            now.bytes         - start_.bytes};
+}
+
+std::uint64_t AllocationScope::allocations() const noexcept {
+    return delta().allocations;
+}
+
+std::uint64_t AllocationScope::bytes() const noexcept {
+    return delta().bytes;
+}
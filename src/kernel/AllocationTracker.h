@@ -0,0 +1,86 @@
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file AllocationTracker.h
+ * @brief Opt-in, per-thread heap allocation counters.
+ *
+ * The counters are only fed when the replacement global `operator new`
+ * / `operator delete` in AllocationHooks.cpp is linked into the
+ * executable (CMake target `kernel_alloc_hooks`).  Without it every
+ * query returns zero and isInstalled() reports false.
+ *
+ * Counters are thread-local, so a scope only sees allocations made by
+ * its own thread – parallel tests do not disturb each other.
+ *
+ * @par Design Patterns
+ * - **RAII** – AllocationScope snapshots the counters on construction
+ *   and reports the difference on demand.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – counting only; the hooks that feed it
+ *   live in a separate translation unit.
+ */
+
+/**
+ * @brief Snapshot of the calling thread's allocation counters.
+ */
+struct AllocationStats {
+    std::uint64_t allocations   = 0; ///< Number of operator new calls.
+    std::uint64_t deallocations = 0; ///< Number of operator delete calls.
+    std::uint64_t bytes         = 0; ///< Total bytes requested.
+};
+
+/**
+ * @class AllocationTracker
+ * @brief Static access to the thread-local allocation counters.
+ */
+class AllocationTracker {
+public:
+    /** @brief Returns true when the counting hooks are linked in. */
+    static bool isInstalled() noexcept;
+
+    /** @brief Returns the calling thread's running totals. */
+    static AllocationStats current() noexcept;
+
+    /** @brief Called by the hooks for each allocation of @p bytes. */
+    static void recordAllocation(std::size_t bytes) noexcept;
+
+    /** @brief Called by the hooks for each deallocation. */
+    static void recordDeallocation() noexcept;
+
+    /** @brief Called once by the hooks at static-init time. */
+    static void markInstalled() noexcept;
+};
+
+/**
+ * @class AllocationScope
+ * @brief Counts the allocations made by this thread since construction.
+ *
+ * @code
+ *   AllocationScope scope;
+ *   session.playRound();
+ *   assert(scope.allocations() == 0);
+ * @endcode
+ */
+class AllocationScope {
+public:
+    AllocationScope() noexcept;
+
+    /** @brief Returns the counters accumulated since construction. */
+    AllocationStats delta() const noexcept;
+
+    /** @brief Returns the number of allocations since construction. */
+    std::uint64_t allocations() const noexcept;
+
+    /** @brief Returns the bytes requested since construction. */
+    std::uint64_t bytes() const noexcept;
+
+private:
+    AllocationStats start_; ///< Counters at construction time.
+};
+
+#endif // ALLOCATION_TRACKER_H
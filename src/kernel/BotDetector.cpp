@@ -0,0 +1,209 @@
+#include "kernel/BotDetector.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    unsigned popcount(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(x));
+#else
+        unsigned n = 0;
+        for (; x; x &= x - 1) ++n;
+        return n;
+#endif
+    }
+
+    /// Most frequent next gesture of a context, or -1 if it was never seen.
+    int predict(const std::uint16_t* next) noexcept {
+        if (next[0] + next[1] + next[2] == 0) return -1;
+        int best = 0;
+        if (next[1] > next[best]) best = 1;
+        if (next[2] > next[best]) best = 2;
+        return best;
+    }
+}
+
+BotDetector::BotDetector(BotDetectorConfig config)
+    : config_(config)
+    , xLog2x_{}
+    , alerts_(0)
+{
+    for (std::size_t c = 1; c <= WINDOW; ++c) {
+        xLog2x_[c] = static_cast<double>(c) * std::log2(static_cast<double>(c));
+    }
+}
+
+BotDetector::UserId BotDetector::allocate(std::string_view name) {
+    UserId id;
+    if (!free_.empty()) {
+        id = free_.back();
+        free_.pop_back();
+        users_[id] = State{};
+        names_[id].assign(name.data(), name.size());
+    } else {
+        id = static_cast<UserId>(users_.size());
+        users_.emplace_back();
+        names_.emplace_back(name);
+    }
+    users_[id].live = true;
+    return id;
+}
+
+BotDetector::State& BotDetector::state(UserId user) {
+    State& s = users_.at(user);
+    if (!s.live) throw std::out_of_range("BotDetector: released user");
+    return s;
+}
+
+const BotDetector::State& BotDetector::state(UserId user) const {
+    const State& s = users_.at(user);
+    if (!s.live) throw std::out_of_range("BotDetector: released user");
+    return s;
+}
+
+BotDetector::UserId BotDetector::userId(std::string_view name) {
+    auto it = ids_.find(name);
+    if (it != ids_.end()) return it->second;
+
+    const UserId id = allocate(name);
+    ids_.emplace(names_[id], id);
+    return id;
+}
+
+BotDetector::UserId BotDetector::addUser(std::string_view name) {
+    return allocate(name);
+}
+
+void BotDetector::release(UserId user) {
+    State& s = state(user);
+    auto it = ids_.find(names_[user]);
+    if (it != ids_.end() && it->second == user) ids_.erase(it);
+    s.live = false;
+    names_[user].clear();
+    names_[user].shrink_to_fit();
+    free_.push_back(user);
+}
+
+void BotDetector::observe(UserId user, Combination gesture, Combination opponent,
+                          std::chrono::microseconds responseTime) {
+    State& s = state(user);
+    const std::size_t slot = s.rounds % WINDOW;
+    const auto g = static_cast<std::uint8_t>(gesture);
+    const auto o = static_cast<std::uint8_t>(opponent);
+
+    if (s.rounds >= WINDOW) { // evict round rounds - WINDOW
+        const std::uint8_t old = s.gesture[slot];
+        --s.counts[old];
+        if (s.contextOwn[slot] != NO_CONTEXT) --s.modelOwn[s.contextOwn[slot]][old];
+        if (s.contextRound[slot] != NO_CONTEXT) --s.modelRound[s.contextRound[slot]][old];
+        if (const std::uint64_t r = s.responseUs[slot]) {
+            --s.timed;
+            s.responseSum -= r;
+            s.responseSumSq -= r * r;
+        }
+    }
+
+    std::uint8_t contextOwn = NO_CONTEXT;
+    std::uint8_t contextRound = NO_CONTEXT;
+    if (s.rounds >= 1) {
+        const std::size_t prev = (s.rounds - 1) % WINDOW;
+        contextRound = static_cast<std::uint8_t>(3 * s.gesture[prev] + s.opponent[prev]);
+        if (s.rounds >= 2) {
+            contextOwn = static_cast<std::uint8_t>(3 * s.gesture[(s.rounds - 2) % WINDOW] + s.gesture[prev]);
+        }
+    }
+
+    // Score the predictions made before seeing this gesture, then learn it.
+    const std::uint64_t bit = std::uint64_t{1} << slot;
+    const bool hitOwn = contextOwn != NO_CONTEXT && predict(s.modelOwn[contextOwn]) == g;
+    const bool hitRound = contextRound != NO_CONTEXT && predict(s.modelRound[contextRound]) == g;
+    s.hitsOwn = hitOwn ? (s.hitsOwn | bit) : (s.hitsOwn & ~bit);
+    s.hitsRound = hitRound ? (s.hitsRound | bit) : (s.hitsRound & ~bit);
+    if (contextOwn != NO_CONTEXT) ++s.modelOwn[contextOwn][g];
+    if (contextRound != NO_CONTEXT) ++s.modelRound[contextRound][g];
+
+    ++s.counts[g];
+    s.gesture[slot] = g;
+    s.opponent[slot] = o;
+    s.contextOwn[slot] = contextOwn;
+    s.contextRound[slot] = contextRound;
+
+    const auto us = static_cast<std::uint32_t>(
+        std::min<std::int64_t>(std::max<std::int64_t>(responseTime.count(), 0), MAX_RESPONSE_US));
+    s.responseUs[slot] = us;
+    if (us) {
+        ++s.timed;
+        s.responseSum += us;
+        s.responseSumSq += static_cast<std::uint64_t>(us) * us;
+    }
+    ++s.rounds;
+
+    const BotScore score = evaluate(s);
+    if (score.flagged && !s.flagged) {
+        ++alerts_;
+        if (alertCallback_) alertCallback_(BotAlert{names_[user], score});
+    }
+    s.flagged = score.flagged;
+}
+
+void BotDetector::observe(std::string_view user, const Move& move,
+                          std::chrono::microseconds responseTime) {
+    observe(userId(user), move.getUserHand().getCombination(),
+            move.getComputerHand().getCombination(), responseTime);
+}
+
+BotScore BotDetector::evaluate(const State& s) const {
+    BotScore score;
+    score.rounds = s.rounds;
+    const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(s.rounds, WINDOW));
+    if (n == 0) return score;
+
+    const double dn = static_cast<double>(n);
+    score.entropyBits = std::max(0.0, std::log2(dn) -
+        (xLog2x_[s.counts[0]] + xLog2x_[s.counts[1]] + xLog2x_[s.counts[2]]) / dn);
+    score.predictability = std::max(popcount(s.hitsOwn), popcount(s.hitsRound)) / dn;
+
+    if (s.timed > 0) {
+        const double t = static_cast<double>(s.timed);
+        const double mean = static_cast<double>(s.responseSum) / t;
+        const double variance = std::max(0.0, static_cast<double>(s.responseSumSq) / t - mean * mean);
+        score.meanResponseMs = mean / 1000.0;
+        score.responseCv = mean > 0.0 ? std::sqrt(variance) / mean : 0.0;
+    }
+
+    if (n < WINDOW) return score; // too little evidence to judge
+    if (score.entropyBits < config_.minEntropyBits) score.signals |= BOT_LOW_ENTROPY;
+    if (score.predictability > config_.maxPredictability) score.signals |= BOT_PREDICTABLE;
+    if (s.timed >= WINDOW / 2) {
+        if (score.responseCv < config_.minResponseCv) score.signals |= BOT_REGULAR_TIMING;
+        if (score.meanResponseMs < config_.minMeanResponseMs) score.signals |= BOT_FAST_RESPONSES;
+    }
+    score.flagged = score.signals != 0 &&
+                    popcount(score.signals) >= std::max(1u, config_.minSignals);
+    return score;
+}
+
+BotScore BotDetector::score(UserId user) const {
+    const State& s = state(user);
+    BotScore result = evaluate(s);
+    result.flagged = s.flagged;
+    return result;
+}
+
+std::string_view BotDetector::getName(UserId user) const {
+    state(user);
+    return names_[user];
+}
+
+std::size_t BotDetector::getUserCount() const {
+    return users_.size() - free_.size();
+}
+
+std::uint64_t BotDetector::getAlertCount() const {
+    return alerts_;
+}
+
+void BotDetector::onAlert(AlertCallback cb) {
+    alertCallback_ = std::move(cb);
+}
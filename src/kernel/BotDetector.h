@@ -0,0 +1,191 @@
+#ifndef BOT_DETECTOR_H
+#define BOT_DETECTOR_H
+
+#include "Combination.h"
+#include "Move.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file BotDetector.h
+ * @brief Streaming detection of scripted players from their rounds.
+ *
+ * For every user the detector keeps the last WINDOW rounds and, updated
+ * in O(1) per round:
+ * - the Shannon entropy of the user's gestures (table lookups over
+ *   three counters);
+ * - the hit rate of two online n-gram predictors – one keyed on the
+ *   user's last two gestures, one on the last round (own and opponent
+ *   gesture), which catches cycles and "beat the last move" scripts;
+ *   hits are kept as a 64-bit ring so the rate is a popcount;
+ * - the mean and coefficient of variation of response times, from
+ *   running sums.
+ * Counts leaving the window are subtracted, so nothing is ever rescanned.
+ *
+ * Once a window is full, each statistic is compared against
+ * BotDetectorConfig.  A user crossing at least minSignals thresholds is
+ * flagged and the alert callback fires once; it can fire again after
+ * the user's statistics return to normal.
+ *
+ * Users are either looked up by name (userId()) or registered per
+ * connection (addUser()), so a client cannot pollute another user's
+ * statistics by claiming their name.  release() drops a user's state and
+ * recycles the id; a server that releases on disconnect keeps memory
+ * bounded by its live connections.
+ *
+ * Not thread-safe: feed it from a single consumer thread (e.g. the
+ * ShmServer serve thread or a RoundBroadcaster subscription).
+ *
+ * @par Design Patterns
+ * - **Observer** – alerts are delivered through a callback.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – scoring only; what to do with a flagged
+ *   user is the caller's decision.
+ */
+
+/** @brief Reasons for an alert (bit flags in BotScore::signals). */
+enum BotSignal : std::uint32_t {
+    BOT_LOW_ENTROPY    = 1, ///< Gesture mix far from uniform.
+    BOT_PREDICTABLE    = 2, ///< Next gesture follows from recent rounds.
+    BOT_REGULAR_TIMING = 4, ///< Response times barely vary.
+    BOT_FAST_RESPONSES = 8  ///< Responses faster than a person can react.
+};
+
+/**
+ * @brief Alert thresholds.
+ */
+struct BotDetectorConfig {
+    double minEntropyBits       = 1.2;  ///< Of log2(3) ≈ 1.585 for a uniform mix.
+    double maxPredictability    = 0.75; ///< Best predictor hit rate (chance: 1/3).
+    double minResponseCv        = 0.05; ///< Stddev / mean of response times.
+    double minMeanResponseMs    = 100.0;
+    unsigned minSignals         = 1;    ///< Signals needed to flag a user.
+};
+
+/** @brief Current statistics of one user. */
+struct BotScore {
+    std::uint64_t rounds = 0;         ///< Rounds observed in total.
+    double entropyBits = 0.0;         ///< Over the window.
+    double predictability = 0.0;      ///< Best predictor hit rate over the window.
+    double meanResponseMs = 0.0;      ///< Over timed rounds in the window.
+    double responseCv = 0.0;
+    std::uint32_t signals = 0;        ///< BotSignal flags (full window only).
+    bool flagged = false;
+};
+
+/** @brief Payload of an alert. */
+struct BotAlert {
+    std::string_view user;
+    BotScore score;
+};
+
+/**
+ * @class BotDetector
+ * @brief Per-user sliding-window statistics and alerts.
+ */
+class BotDetector {
+public:
+    static constexpr std::size_t WINDOW = 64; ///< Rounds per user window.
+
+    /// Dense handle of a user, valid until release().
+    using UserId = std::uint32_t;
+
+    using AlertCallback = std::function<void(const BotAlert& alert)>;
+
+    /** @brief Creates a detector with @p config. */
+    explicit BotDetector(BotDetectorConfig config = {});
+
+    /** @brief Returns the id of @p name, registering it if new. */
+    UserId userId(std::string_view name);
+
+    /**
+     * @brief Registers a new user labelled @p name that userId() never
+     *        returns, e.g. one network connection.
+     */
+    UserId addUser(std::string_view name);
+
+    /**
+     * @brief Forgets @p user; its id may be handed out again.
+     * @throws std::out_of_range if @p user is not registered.
+     */
+    void release(UserId user);
+
+    /**
+     * @brief Records one round of user @p user.
+     * @param user         From userId().
+     * @param gesture      The user's gesture.
+     * @param opponent     The opponent's gesture.
+     * @param responseTime Time the user took to answer; zero if unknown
+     *                     (the round is left out of timing statistics).
+     */
+    void observe(UserId user, Combination gesture, Combination opponent,
+                 std::chrono::microseconds responseTime = std::chrono::microseconds(0));
+
+    /** @brief Same as observe() with the hands of @p move. */
+    void observe(std::string_view user, const Move& move,
+                 std::chrono::microseconds responseTime = std::chrono::microseconds(0));
+
+    /** @brief Returns the current statistics of @p user. */
+    BotScore score(UserId user) const;
+
+    /** @brief Returns the name of @p user (valid until it is released). */
+    std::string_view getName(UserId user) const;
+
+    /** @brief Returns the number of registered (not released) users. */
+    std::size_t getUserCount() const;
+
+    /** @brief Returns the number of alerts raised so far. */
+    std::uint64_t getAlertCount() const;
+
+    /** @brief Sets the callback invoked when a user becomes flagged. */
+    void onAlert(AlertCallback cb);
+
+private:
+    static constexpr std::uint8_t NO_CONTEXT = 9;
+    static constexpr std::uint32_t MAX_RESPONSE_US = 60000000; ///< Longer answers are clamped.
+
+    /// One user's window.  Rings are indexed by round number mod WINDOW.
+    struct State {
+        std::uint64_t rounds = 0;
+        std::uint8_t gesture[WINDOW] = {};
+        std::uint8_t opponent[WINDOW] = {};
+        std::uint8_t contextOwn[WINDOW] = {};   ///< Context of the own-history model.
+        std::uint8_t contextRound[WINDOW] = {}; ///< Context of the last-round model.
+        std::uint32_t responseUs[WINDOW] = {};
+        std::uint64_t hitsOwn = 0;              ///< Bit i: round i mod WINDOW was predicted.
+        std::uint64_t hitsRound = 0;
+        std::uint32_t counts[3] = {};
+        std::uint16_t modelOwn[9][3] = {};      ///< Next-gesture counts per context.
+        std::uint16_t modelRound[9][3] = {};
+        std::uint32_t timed = 0;                ///< Rounds with a response time.
+        std::uint64_t responseSum = 0;          ///< µs; integers, so eviction is exact.
+        std::uint64_t responseSumSq = 0;
+        bool flagged = false;
+        bool live = false;
+    };
+
+    UserId allocate(std::string_view name);
+    State& state(UserId user);
+    const State& state(UserId user) const;
+    BotScore evaluate(const State& s) const;
+
+    BotDetectorConfig config_;
+    std::array<double, WINDOW + 1> xLog2x_; ///< c · log2(c) for window counts.
+    std::vector<State> users_;
+    std::deque<std::string> names_;         ///< Stable storage for the ids_ keys.
+    std::unordered_map<std::string_view, UserId> ids_; ///< userId() users only.
+    std::vector<UserId> free_;              ///< Released ids.
+    AlertCallback alertCallback_;
+    std::uint64_t alerts_;
+};
+
+#endif // BOT_DETECTOR_H
@@ -2,6 +2,7 @@
 #define COMBINATION_H
 
 #include <string>
+#include <string_view>
 #include <stdexcept>
 
 /**
@@ -26,12 +27,12 @@ enum class Combination {
 };
 
 /**
- * @brief Converts a Combination to its human-readable string.
- * @param c The combination to convert.
- * @return A string representation ("Rock", "Scissors", or "Paper").
+ * @brief Returns the human-readable label of a Combination.
+ * @param c The combination to label.
+ * @return "Rock", "Scissors", or "Paper" (static storage, no allocation).
  * @throws std::invalid_argument if the value is out of range.
  */
-inline std::string combinationToString(Combination c) {
+constexpr std::string_view combinationLabel(Combination c) {
     switch (c) {
         case Combination::Rock:     return "Rock";
         case Combination::Scissors: return "Scissors";
@@ -40,6 +41,17 @@ inline std::string combinationToString(Combination c) {
     throw std::invalid_argument("Unknown Combination value");
 }
 
+/**
+ * @brief Converts a Combination to its human-readable string.
+ * @param c The combination to convert.
+ * @return A string representation ("Rock", "Scissors", or "Paper").
+ * @throws std::invalid_argument if the value is out of range.
+ * @note Compatibility wrapper; prefer combinationLabel().
+ */
+inline std::string combinationToString(Combination c) {
+    return std::string(combinationLabel(c));
+}
+
 /**
  * @brief Determines whether the left combination beats the right one.
  * @param lhs The attacking combination.
@@ -59,4 +71,13 @@ inline bool beats(Combination lhs, Combination rhs) {
            (lhs == Combination::Paper    && rhs == Combination::Rock);
 }
 
+/**
+ * @brief Returns the combination that beats @p c.
+ * @param c The combination to counter.
+ * @return Paper for Rock, Rock for Scissors, Scissors for Paper.
+ */
+inline Combination counterTo(Combination c) {
+    return static_cast<Combination>((static_cast<int>(c) + 2) % 3);
+}
+
 #endif // COMBINATION_H
@@ -1,13 +1,74 @@
 #include "kernel/ComputerAI.h"
+#include <algorithm>
+#include <stdexcept>
 
 ComputerAI::ComputerAI(const std::string& name)
     : name_(name)
+    , seeded_(false)
+    , seed_(0)
+    , sessionId_(0)
+    , stream_(0)
+    , round_(0)
+{}
+
+ComputerAI::ComputerAI(const std::string& name, std::uint64_t seed,
+                       std::uint64_t sessionId, std::uint32_t stream)
+    : name_(name)
+    , seeded_(true)
+    , seed_(seed)
+    , sessionId_(sessionId)
+    , stream_(stream)
+    , round_(0)
 {}
 
 std::string ComputerAI::getName() const {
     return name_;
 }
 
+std::string_view ComputerAI::getNameView() const {
+    return name_;
+}
+
 Hand ComputerAI::chooseHand() {
+    if (seeded_) {
+        return Hand::generateCombination(seed_, sessionId_, round_++, stream_);
+    }
     return Hand::generateCombination();
 }
+
+void ComputerAI::chooseHands(Hand* out, std::size_t count) {
+    if (seeded_) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = Hand::generateCombination(seed_, sessionId_, round_++, stream_);
+        }
+        return;
+    }
+    Combination buffer[64];
+    for (std::size_t i = 0; i < count; i += 64) {
+        const std::size_t n = std::min<std::size_t>(64, count - i);
+        Hand::generateCombinations(buffer, n);
+        for (std::size_t j = 0; j < n; ++j) {
+            out[i + j] = Hand(buffer[j]);
+        }
+    }
+}
+
+bool ComputerAI::isBatchable() const {
+    return true;
+}
+
+void ComputerAI::reseed(std::uint64_t sessionId) {
+    sessionId_ = sessionId;
+    round_ = 0;
+}
+
+bool ComputerAI::isSeeded() const {
+    return seeded_;
+}
+
+Hand ComputerAI::handAt(std::uint64_t roundIndex) const {
+    if (!seeded_) {
+        throw std::logic_error("handAt() requires a seeded ComputerAI");
+    }
+    return Hand::generateCombination(seed_, sessionId_, roundIndex, stream_);
+}
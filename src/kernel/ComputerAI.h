@@ -2,12 +2,17 @@
 #define COMPUTER_AI_H
 
 #include "IPlayer.h"
+#include <cstdint>
 
 /**
  * @file ComputerAI.h
  * @brief AI opponent that selects a random hand each round.
  *
  * ComputerAI is the simplest Strategy implementation: pure randomness.
+ * By default it draws from a per-thread engine; constructed with a
+ * seed and session id it becomes reproducible, drawing round r from
+ * the counter-based generator (see CounterRng), so any round can be
+ * replayed in O(1) with handAt().
  * It satisfies the Liskov Substitution Principle – any code that works
  * with an IPlayer also works with ComputerAI without modification.
  *
@@ -28,17 +33,62 @@ public:
      */
     explicit ComputerAI(const std::string& name = "Computer");
 
+    /**
+     * @brief Constructs a reproducible AI.
+     * @param name      Display name.
+     * @param seed      Global seed of the run.
+     * @param sessionId Session number within the run.
+     * @param stream    Player stream 0..3 (defaults to 1, the computer).
+     */
+    ComputerAI(const std::string& name, std::uint64_t seed,
+               std::uint64_t sessionId, std::uint32_t stream = 1);
+
     /** @copydoc IPlayer::getName */
     std::string getName() const override;
 
+    /** @copydoc IPlayer::getNameView */
+    std::string_view getNameView() const override;
+
     /**
      * @copydoc IPlayer::chooseHand
      * @note Always returns a randomly-generated Hand.
      */
     Hand chooseHand() override;
 
+    /**
+     * @copydoc IPlayer::chooseHands
+     * @note Generates the hands in one loop; a seeded AI yields exactly
+     *       the hands @p count chooseHand() calls would, an unseeded one
+     *       draws them in bulk with Hand::generateCombinations().
+     */
+    void chooseHands(Hand* out, std::size_t count) override;
+
+    /** @brief True: the hands never depend on the opponent. */
+    bool isBatchable() const override;
+
+    /**
+     * @brief Starts a new session in reproducible mode (round 0).
+     * @param sessionId Session number within the run.
+     */
+    void reseed(std::uint64_t sessionId);
+
+    /** @brief Returns true when constructed with a seed. */
+    bool isSeeded() const;
+
+    /**
+     * @brief Returns the hand played (or to be played) at @p roundIndex
+     *        of the current session without advancing.  O(1).
+     * @throws std::logic_error if the AI is not seeded.
+     */
+    Hand handAt(std::uint64_t roundIndex) const;
+
 private:
-    std::string name_; ///< Display name of the AI player.
+    std::string name_;      ///< Display name of the AI player.
+    bool seeded_;           ///< Reproducible mode enabled.
+    std::uint64_t seed_;
+    std::uint64_t sessionId_;
+    std::uint32_t stream_;
+    std::uint64_t round_;   ///< Next round index in reproducible mode.
 };
 
 #endif // COMPUTER_AI_H
@@ -0,0 +1,55 @@
+#include "kernel/CounterRng.h"
+
+namespace {
+
+constexpr std::uint32_t PHILOX_M0 = 0xD2511F53u;
+constexpr std::uint32_t PHILOX_M1 = 0xCD9E8D57u;
+constexpr std::uint32_t PHILOX_W0 = 0x9E3779B9u; ///< Golden ratio.
+constexpr std::uint32_t PHILOX_W1 = 0xBB67AE85u; ///< sqrt(3) - 1.
+constexpr int PHILOX_ROUNDS = 10;
+
+inline void mulhilo(std::uint32_t a, std::uint32_t b, std::uint32_t& hi, std::uint32_t& lo) {
+    const std::uint64_t p = static_cast<std::uint64_t>(a) * b;
+    hi = static_cast<std::uint32_t>(p >> 32);
+    lo = static_cast<std::uint32_t>(p);
+}
+
+} // namespace
+
+CounterRng::Counter CounterRng::philox(Counter c, Key k) {
+    for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+        if (round > 0) {
+            k[0] += PHILOX_W0;
+            k[1] += PHILOX_W1;
+        }
+        std::uint32_t hi0, lo0, hi1, lo1;
+        mulhilo(PHILOX_M0, c[0], hi0, lo0);
+        mulhilo(PHILOX_M1, c[2], hi1, lo1);
+        c = {hi1 ^ c[1] ^ k[0], lo1, hi0 ^ c[3] ^ k[1], lo0};
+    }
+    return c;
+}
+
+CounterRng::Counter CounterRng::block(std::uint64_t seed, std::uint64_t sessionId,
+                                      std::uint64_t roundIndex) {
+    const Counter counter{static_cast<std::uint32_t>(roundIndex),
+                          static_cast<std::uint32_t>(roundIndex >> 32),
+                          static_cast<std::uint32_t>(sessionId),
+                          static_cast<std::uint32_t>(sessionId >> 32)};
+    const Key key{static_cast<std::uint32_t>(seed),
+                  static_cast<std::uint32_t>(seed >> 32)};
+    return philox(counter, key);
+}
+
+Combination CounterRng::combinationAt(std::uint64_t seed, std::uint64_t sessionId,
+                                      std::uint64_t roundIndex, std::uint32_t stream) {
+    // One block holds a 32-bit word per stream.  2^32 - 1 values are
+    // divisible by 3, so only 0xFFFFFFFF is rejected (falling back to
+    // the next word, probability 2^-32) to keep the mapping unbiased.
+    const Counter bits = block(seed, sessionId, roundIndex);
+    std::uint32_t x = bits[stream & 3u];
+    for (std::uint32_t i = 1; x == 0xFFFFFFFFu && i < 4; ++i) {
+        x = bits[(stream + i) & 3u];
+    }
+    return static_cast<Combination>(x % 3);
+}
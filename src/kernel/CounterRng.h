@@ -0,0 +1,64 @@
+#ifndef COUNTER_RNG_H
+#define COUNTER_RNG_H
+
+#include "Combination.h"
+#include <array>
+#include <cstdint>
+
+/**
+ * @file CounterRng.h
+ * @brief Stateless counter-based random numbers (Philox4x32-10).
+ *
+ * A counter-based generator is a keyed bijection: the same
+ * (key, counter) always yields the same 128 random bits, and any
+ * counter can be evaluated directly.  Keying by the global seed and
+ * counting by (session id, round index) means every gesture of every
+ * session can be regenerated in O(1), independent of which thread
+ * played it or in which order – a million-session run gives
+ * bit-identical results on 1 thread or 64.
+ *
+ * The block function is the Philox4x32-10 construction of Salmon et
+ * al., "Parallel Random Numbers: As Easy as 1, 2, 3" (SC'11).
+ *
+ * @par Design Patterns
+ * - **Pure Function** – no state, safe from any thread.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – random bits only; mapping to gestures
+ *   is a thin helper on top.
+ */
+class CounterRng {
+public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key     = std::array<std::uint32_t, 2>;
+
+    /**
+     * @brief The raw Philox4x32-10 block function.
+     * @param counter 128-bit counter.
+     * @param key     64-bit key.
+     * @return 128 pseudo-random bits.
+     */
+    static Counter philox(Counter counter, Key key);
+
+    /**
+     * @brief Returns 128 random bits for one round of one session.
+     * @param seed       Global seed of the run (the key).
+     * @param sessionId  Session number within the run.
+     * @param roundIndex Round number within the session.
+     */
+    static Counter block(std::uint64_t seed, std::uint64_t sessionId,
+                         std::uint64_t roundIndex);
+
+    /**
+     * @brief Returns an unbiased gesture for one player of one round.
+     * @param seed       Global seed of the run.
+     * @param sessionId  Session number within the run.
+     * @param roundIndex Round number within the session.
+     * @param stream     Stream 0..3 (e.g. 0 = user, 1 = computer); each
+     *                   stream reads its own word of the round's block.
+     */
+    static Combination combinationAt(std::uint64_t seed, std::uint64_t sessionId,
+                                     std::uint64_t roundIndex, std::uint32_t stream = 0);
+};
+
+#endif // COUNTER_RNG_H
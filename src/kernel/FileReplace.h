@@ -0,0 +1,24 @@
+#ifndef FILE_REPLACE_H
+#define FILE_REPLACE_H
+
+#include <string>
+
+/**
+ * @file FileReplace.h
+ * @brief Atomic replacement of a file by a fully written temporary.
+ *
+ * Writers (metrics, leaderboard snapshots, opening books) write to
+ * `path + ".tmp"` and then call replaceFile(), so readers observe either
+ * the old or the new file and never a missing or truncated one.
+ */
+
+/**
+ * @brief Moves @p from over @p to, replacing @p to if it exists.
+ *
+ * Atomic on POSIX (rename(2)); on Windows uses MoveFileEx with
+ * MOVEFILE_REPLACE_EXISTING, since rename() refuses to overwrite there.
+ * @return true on success; @p from is left in place on failure.
+ */
+bool replaceFile(const std::string& from, const std::string& to);
+
+#endif // FILE_REPLACE_H
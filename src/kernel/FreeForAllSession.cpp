@@ -0,0 +1,174 @@
+#include "kernel/FreeForAllSession.h"
+#include "kernel/Tracer.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+    /// Most thrown gesture in @p counts after removing one @p own.
+    Combination crowdGesture(const MultiMove& move, Combination own) {
+        Combination best = own;
+        int bestCount = -1;
+        for (int c = 0; c < 3; ++c) {
+            const auto combo = static_cast<Combination>(c);
+            const int count = move.getCount(combo) - (combo == own ? 1 : 0);
+            if (count > bestCount) {
+                best = combo;
+                bestCount = count;
+            }
+        }
+        return best;
+    }
+}
+
+FreeForAllSession::FreeForAllSession(std::vector<std::shared_ptr<IPlayer>> players,
+                                     std::int64_t rounds, FreeForAllMode mode)
+    : players_(std::move(players))
+    , mode_(mode)
+    , totalRounds_(rounds)
+{
+    if (players_.size() < 2) {
+        throw std::invalid_argument("FreeForAllSession needs at least two players");
+    }
+    if (std::any_of(players_.begin(), players_.end(),
+                    [](const std::shared_ptr<IPlayer>& p) { return !p; })) {
+        throw std::invalid_argument("FreeForAllSession: null player");
+    }
+    if (rounds <= 0) {
+        throw std::invalid_argument("FreeForAllSession: rounds must be positive");
+    }
+
+    const std::size_t n = players_.size();
+    scores_.assign(n, 0);
+    losses_.assign(n, 0);
+    draws_.assign(n, 0);
+    eliminatedIn_.assign(n, -1);
+    active_.resize(n);
+    std::iota(active_.begin(), active_.end(), std::size_t{0});
+}
+
+void FreeForAllSession::start() {
+    while (!isFinished()) {
+        playRound();
+    }
+}
+
+const MultiMove& FreeForAllSession::playRound() {
+    if (isFinished()) {
+        throw std::runtime_error("The free-for-all session is already finished.");
+    }
+    TraceScope trace("FreeForAllSession::playRound", "session");
+
+    round_.clear();
+    for (std::size_t seat : active_) {
+        round_.add(players_[seat]->chooseHand(), seat);
+    }
+    const MultiMove& move = round_;
+    const std::int64_t roundIndex = roundsPlayed_++;
+
+    std::size_t survivors = 0;
+    for (std::size_t i = 0; i < active_.size(); ++i) {
+        const std::size_t seat = active_[i];
+        const Hand own = move.getHand(i);
+        players_[seat]->observeRound(own, Hand(crowdGesture(move, own.getCombination())));
+
+        if (move.isDraw()) {
+            ++draws_[seat];
+        } else if (move.isWinner(i)) {
+            ++scores_[seat];
+        } else {
+            ++losses_[seat];
+            if (mode_ == FreeForAllMode::Elimination) {
+                eliminatedIn_[seat] = roundIndex;
+                continue;
+            }
+        }
+        active_[survivors++] = seat;
+    }
+    active_.resize(survivors);
+
+    if (roundCallback_) {
+        TraceScope traceCallback("roundCallback", "callback");
+        roundCallback_(roundIndex, move);
+    }
+    return move;
+}
+
+bool FreeForAllSession::isFinished() const {
+    return roundsPlayed_ >= totalRounds_ ||
+           (mode_ == FreeForAllMode::Elimination && active_.size() <= 1);
+}
+
+FreeForAllMode FreeForAllSession::getMode() const {
+    return mode_;
+}
+
+std::size_t FreeForAllSession::getPlayerCount() const {
+    return players_.size();
+}
+
+const std::shared_ptr<IPlayer>& FreeForAllSession::getPlayer(std::size_t seat) const {
+    return players_.at(seat);
+}
+
+std::int64_t FreeForAllSession::getRoundsPlayed() const {
+    return roundsPlayed_;
+}
+
+std::int64_t FreeForAllSession::getTotalRounds() const {
+    return totalRounds_;
+}
+
+std::size_t FreeForAllSession::getActiveCount() const {
+    return active_.size();
+}
+
+bool FreeForAllSession::isActive(std::size_t seat) const {
+    return eliminatedIn_.at(seat) < 0;
+}
+
+std::int64_t FreeForAllSession::getEliminationRound(std::size_t seat) const {
+    return eliminatedIn_.at(seat);
+}
+
+const std::vector<std::int64_t>& FreeForAllSession::getScores() const {
+    return scores_;
+}
+
+const std::vector<std::int64_t>& FreeForAllSession::getLosses() const {
+    return losses_;
+}
+
+const std::vector<std::int64_t>& FreeForAllSession::getDraws() const {
+    return draws_;
+}
+
+std::vector<std::size_t> FreeForAllSession::getLeaders() const {
+    if (mode_ == FreeForAllMode::Elimination) {
+        return active_;
+    }
+    const std::int64_t best = *std::max_element(scores_.begin(), scores_.end());
+    std::vector<std::size_t> leaders;
+    for (std::size_t seat = 0; seat < scores_.size(); ++seat) {
+        if (scores_[seat] == best) {
+            leaders.push_back(seat);
+        }
+    }
+    return leaders;
+}
+
+std::string_view FreeForAllSession::whoWinsView() const {
+    const std::vector<std::size_t> leaders = getLeaders();
+    if (leaders.size() != 1) {
+        return "Draw";
+    }
+    return players_[leaders.front()]->getNameView();
+}
+
+const MultiMove* FreeForAllSession::getLastRound() const {
+    return roundsPlayed_ == 0 ? nullptr : &round_;
+}
+
+void FreeForAllSession::onRoundCompleted(RoundCallback cb) {
+    roundCallback_ = std::move(cb);
+}
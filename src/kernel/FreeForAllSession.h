@@ -0,0 +1,155 @@
+#ifndef FREE_FOR_ALL_SESSION_H
+#define FREE_FOR_ALL_SESSION_H
+
+#include "MultiMove.h"
+#include "IPlayer.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file FreeForAllSession.h
+ * @brief Runs lobby games where any number of players throw at once.
+ *
+ * Every round, each active player chooses a Hand and the resulting
+ * MultiMove is judged in O(N).  Two modes are supported:
+ * - **Points** – everyone plays every round; winners score a point.
+ * - **Elimination** – players holding the losing gesture are knocked
+ *   out; the session ends when one player remains (or the round limit
+ *   is reached).
+ *
+ * Per-player state (score, wins, losses, elimination round) lives in
+ * flat arrays indexed by seat, the position of the player in the
+ * constructor's list.
+ *
+ * After each round every participant is told, through
+ * IPlayer::observeRound(), its own hand and the gesture most thrown by
+ * the other participants, so adaptive strategies can track the crowd.
+ *
+ * @par Design Patterns
+ * - **Façade** – single entry-point for an N-player game.
+ * - **Observer (light)** – optional round-completed callback.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – N-player session lifecycle only.
+ * - **Dependency Inversion** – depends on IPlayer, not concrete types.
+ */
+
+/** @brief How a FreeForAllSession scores its rounds. */
+enum class FreeForAllMode {
+    Points,     ///< Fixed number of rounds; winners score a point.
+    Elimination ///< Losers drop out until one player remains.
+};
+
+class FreeForAllSession {
+public:
+    /**
+     * @brief Parameters: round index (0-based), the round just played.
+     */
+    using RoundCallback = std::function<void(std::int64_t roundIndex, const MultiMove& move)>;
+
+    /** @brief Default round limit, matching Session. */
+    static constexpr int DEFAULT_ROUNDS = 10;
+
+    /**
+     * @brief Constructs a session.
+     * @param players Two or more players; their order defines the seats.
+     * @param rounds  Rounds to play (Points) or the round limit (Elimination).
+     * @param mode    Scoring mode.
+     * @throws std::invalid_argument on fewer than two players, a null
+     *         player, or a non-positive round count.
+     */
+    FreeForAllSession(std::vector<std::shared_ptr<IPlayer>> players,
+                      std::int64_t rounds = DEFAULT_ROUNDS,
+                      FreeForAllMode mode = FreeForAllMode::Points);
+
+    /** @brief Plays rounds until isFinished(). */
+    void start();
+
+    /**
+     * @brief Plays one round with every active player.
+     * @return The round just played (valid until the next round, which
+     *         refills the same object in place).
+     * @throws std::runtime_error if the session is already finished.
+     */
+    const MultiMove& playRound();
+
+    /** @brief Returns true once no further round can be played. */
+    bool isFinished() const;
+
+    /** @brief Returns the scoring mode. */
+    FreeForAllMode getMode() const;
+
+    /** @brief Returns the number of seats. */
+    std::size_t getPlayerCount() const;
+
+    /** @brief Returns the player in seat @p seat. */
+    const std::shared_ptr<IPlayer>& getPlayer(std::size_t seat) const;
+
+    /** @brief Returns the number of rounds played. */
+    std::int64_t getRoundsPlayed() const;
+
+    /** @brief Returns the configured round count / limit. */
+    std::int64_t getTotalRounds() const;
+
+    /** @brief Returns the number of players still in the game. */
+    std::size_t getActiveCount() const;
+
+    /** @brief Returns true if seat @p seat has not been eliminated. */
+    bool isActive(std::size_t seat) const;
+
+    /**
+     * @brief Returns the 0-based round in which @p seat was eliminated,
+     *        or -1 if it is still active.
+     */
+    std::int64_t getEliminationRound(std::size_t seat) const;
+
+    /** @brief Points per seat (rounds won). */
+    const std::vector<std::int64_t>& getScores() const;
+
+    /** @brief Rounds lost per seat. */
+    const std::vector<std::int64_t>& getLosses() const;
+
+    /** @brief Rounds drawn per seat. */
+    const std::vector<std::int64_t>& getDraws() const;
+
+    /**
+     * @brief Returns the seats currently leading.
+     *
+     * Points: the seats with the highest score.  Elimination: the seats
+     * still active (one once the game is decided).
+     */
+    std::vector<std::size_t> getLeaders() const;
+
+    /**
+     * @brief Returns the winner's name, or "Draw" if several players lead.
+     */
+    std::string_view whoWinsView() const;
+
+    /** @brief Returns the last round played, or nullptr before the first. */
+    const MultiMove* getLastRound() const;
+
+    /** @brief Registers a callback invoked after each round. */
+    void onRoundCompleted(RoundCallback cb);
+
+private:
+    std::vector<std::shared_ptr<IPlayer>> players_;
+    FreeForAllMode mode_;
+    std::int64_t totalRounds_;
+    std::int64_t roundsPlayed_ = 0;
+
+    // Flat per-seat state.
+    std::vector<std::int64_t> scores_;
+    std::vector<std::int64_t> losses_;
+    std::vector<std::int64_t> draws_;
+    std::vector<std::int64_t> eliminatedIn_; ///< -1 while active.
+    std::vector<std::size_t> active_; ///< Seats still playing, ascending.
+
+    MultiMove round_; ///< Refilled in place every round.
+    RoundCallback roundCallback_;
+};
+
+#endif // FREE_FOR_ALL_SESSION_H
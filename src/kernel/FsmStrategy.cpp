@@ -0,0 +1,70 @@
+#include "kernel/FsmStrategy.h"
+#include <stdexcept>
+
+FsmStrategy::FsmStrategy(std::vector<std::uint8_t> genome, const std::string& name)
+    : owned_(std::move(genome))
+    , genome_(owned_.data())
+    , states_(owned_.size() / GENES_PER_STATE)
+    , current_(0)
+    , name_(name)
+{
+    if (owned_.size() % GENES_PER_STATE != 0 || !isValidGenome(genome_, states_)) {
+        throw std::invalid_argument("Malformed FSM genome");
+    }
+}
+
+FsmStrategy::FsmStrategy(const std::uint8_t* genome, std::size_t states,
+                         const std::string& name)
+    : owned_()
+    , genome_(genome)
+    , states_(states)
+    , current_(0)
+    , name_(name)
+{
+    if (!isValidGenome(genome_, states_)) {
+        throw std::invalid_argument("Malformed FSM genome");
+    }
+}
+
+std::string FsmStrategy::getName() const {
+    return name_;
+}
+
+std::string_view FsmStrategy::getNameView() const {
+    return name_;
+}
+
+Hand FsmStrategy::chooseHand() {
+    return Hand(static_cast<Combination>(genome_[current_ * GENES_PER_STATE]));
+}
+
+void FsmStrategy::observeRound(const Hand& /*own*/, const Hand& opponent) {
+    const auto reply = static_cast<std::size_t>(opponent.getCombination());
+    current_ = genome_[current_ * GENES_PER_STATE + 1 + reply];
+}
+
+void FsmStrategy::reset() {
+    current_ = 0;
+}
+
+std::size_t FsmStrategy::getStateCount() const {
+    return states_;
+}
+
+std::size_t FsmStrategy::getCurrentState() const {
+    return current_;
+}
+
+bool FsmStrategy::isValidGenome(const std::uint8_t* genome, std::size_t states) {
+    if (genome == nullptr || states == 0 || states > 256) {
+        return false;
+    }
+    for (std::size_t s = 0; s < states; ++s) {
+        const std::uint8_t* g = genome + s * GENES_PER_STATE;
+        if (g[0] > 2) return false;
+        for (std::size_t t = 1; t < GENES_PER_STATE; ++t) {
+            if (g[t] >= states) return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,90 @@
+#ifndef FSM_STRATEGY_H
+#define FSM_STRATEGY_H
+
+#include "IPlayer.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file FsmStrategy.h
+ * @brief Player driven by a compact finite-state machine genome.
+ *
+ * A genome is a flat byte array of GENES_PER_STATE bytes per state:
+ * the gesture played in that state, followed by the next state for each
+ * gesture the opponent may play.  The machine starts in state 0, plays
+ * its state's gesture, and moves on the opponent's reply.
+ *
+ * The player can either own its genome or view one stored elsewhere
+ * (e.g. inside a StrategyEvolver population), so evaluating thousands
+ * of machines does not copy their genes.
+ *
+ * @par Design Patterns
+ * - **Strategy** – a data-driven hand-selection strategy.
+ * - **Flyweight (light)** – view mode shares the population's storage.
+ *
+ * @par SOLID
+ * - **Liskov Substitution** – drop-in replacement for any IPlayer.
+ */
+class FsmStrategy : public IPlayer {
+public:
+    /** @brief Bytes per state: output gesture + 3 transitions. */
+    static constexpr std::size_t GENES_PER_STATE = 4;
+
+    /**
+     * @brief Constructs an FSM that owns a copy of @p genome.
+     * @param genome Genome bytes (size must be a multiple of 4).
+     * @param name   Display name.
+     * @throws std::invalid_argument if the genome is malformed.
+     */
+    explicit FsmStrategy(std::vector<std::uint8_t> genome,
+                         const std::string& name = "FSM");
+
+    /**
+     * @brief Constructs an FSM that views external genome bytes.
+     * @param genome Pointer to @p states × 4 bytes that must outlive this.
+     * @param states Number of states.
+     * @param name   Display name.
+     */
+    FsmStrategy(const std::uint8_t* genome, std::size_t states,
+                const std::string& name = "FSM");
+
+    FsmStrategy(const FsmStrategy&) = delete;
+    FsmStrategy& operator=(const FsmStrategy&) = delete;
+
+    /** @copydoc IPlayer::getName */
+    std::string getName() const override;
+
+    /** @copydoc IPlayer::getNameView */
+    std::string_view getNameView() const override;
+
+    /** @copydoc IPlayer::chooseHand */
+    Hand chooseHand() override;
+
+    /** @copydoc IPlayer::observeRound */
+    void observeRound(const Hand& own, const Hand& opponent) override;
+
+    /** @brief Returns the machine to its initial state. */
+    void reset();
+
+    /** @brief Returns the number of states. */
+    std::size_t getStateCount() const;
+
+    /** @brief Returns the current state index. */
+    std::size_t getCurrentState() const;
+
+    /**
+     * @brief Checks that every output is a gesture and every transition
+     *        names an existing state.
+     */
+    static bool isValidGenome(const std::uint8_t* genome, std::size_t states);
+
+private:
+    std::vector<std::uint8_t> owned_; ///< Storage in owning mode (else empty).
+    const std::uint8_t* genome_;      ///< Active genome bytes.
+    std::size_t states_;
+    std::size_t current_;
+    std::string name_;
+};
+
+#endif // FSM_STRATEGY_H
@@ -1,4 +1,7 @@
 #include "kernel/Game.h"
+#include "kernel/Metrics.h"
+#include "kernel/Tracer.h"
+#include <chrono>
 #include <stdexcept>
 #include <sstream>
 
@@ -8,21 +11,40 @@ Game::Game(std::shared_ptr<IPlayer> user, std::shared_ptr<IPlayer> computer)
     , state_(GameState::Idle)
 {}
 
-void Game::newSession(int rounds) {
-    currentSession_ = std::make_unique<Session>(user_, computer_, rounds);
+Game::~Game() {
+    if (state_ == GameState::Running) {
+        KernelMetrics::get().activeGames.add(-1);
+    }
+}
+
+void Game::newSession(std::int64_t rounds) {
+    TraceScope trace("Game::newSession", "game");
+    currentSession_ = std::make_unique<Session>(user_, computer_, rounds, historyLimit_);
+    if (state_ != GameState::Running) {
+        KernelMetrics::get().activeGames.add(1);
+    }
     state_ = GameState::Running;
 
-    emit("=== New Session (" + std::to_string(rounds) + " rounds) ===");
+    if (outputCallback_) {
+        emit("=== New Session (" + std::to_string(rounds) + " rounds) ===");
+    }
 
-    // Wire per-round callback to the output
+    // Wire per-round callback to the output.  Formatting is skipped when
+    // nobody listens, so headless rounds stay allocation-free.
     currentSession_->onRoundCompleted(
-        [this](int idx, const Move& move) {
+        [this](std::int64_t idx, const Move& move) {
+            if (roundObserver_) {
+                roundObserver_(idx, move);
+            }
+            if (!outputCallback_) {
+                return;
+            }
             std::ostringstream oss;
             oss << "Round " << (idx + 1) << ": "
-                << combinationToString(move.getUserHand().getCombination())
+                << combinationLabel(move.getUserHand().getCombination())
                 << " vs "
-                << combinationToString(move.getComputerHand().getCombination())
-                << " -> " << moveResultToString(move.getWhoWins());
+                << combinationLabel(move.getComputerHand().getCombination())
+                << " -> " << moveResultLabel(move.getWhoWins());
             emit(oss.str());
         });
 }
@@ -36,13 +58,32 @@ Move Game::playSingleRound() {
 
     if (!currentSession_->isRunning()) {
         state_ = GameState::Finished;
+        KernelMetrics::get().activeGames.add(-1);
+        if (leaderboard_) {
+            leaderboard_->recordSession(
+                user_->getNameView(),
+                currentSession_->getUserScore() > currentSession_->getComputerScore());
+        }
+        if (historyStore_) {
+            const auto now = std::chrono::system_clock::now().time_since_epoch();
+            historyStore_->record(
+                *currentSession_,
+                std::chrono::duration_cast<std::chrono::milliseconds>(now).count());
+        }
+        if (sessionStats_) {
+            sessionStats_->record(*currentSession_);
+        }
+        if (!outputCallback_) {
+            return move;
+        }
 
         std::ostringstream oss;
         oss << "\n=== Session Over ===\n"
-            << user_->getName()     << ": " << currentSession_->getUserScore()     << " wins\n"
-            << computer_->getName() << ": " << currentSession_->getComputerScore() << " wins\n"
+            << user_->getNameView()     << ": " << currentSession_->getUserScore()     << " wins\n"
+            << currentSession_->getComputer()->getNameView() << ": "
+            << currentSession_->getComputerScore() << " wins\n"
             << "Draws: " << currentSession_->getDrawCount() << "\n"
-            << "Winner: " << currentSession_->whoWins();
+            << "Winner: " << currentSession_->whoWinsView();
         emit(oss.str());
     }
 
@@ -61,6 +102,33 @@ void Game::setOutputCallback(OutputCallback cb) {
     outputCallback_ = std::move(cb);
 }
 
+void Game::setRoundObserver(Session::RoundCallback cb) {
+    roundObserver_ = std::move(cb);
+}
+
+void Game::setHistoryLimit(std::size_t limit) {
+    historyLimit_ = limit;
+}
+
+void Game::setLeaderboard(std::shared_ptr<Leaderboard> board) {
+    leaderboard_ = std::move(board);
+}
+
+void Game::setHistoryStore(std::shared_ptr<HistoryStore> store) {
+    historyStore_ = std::move(store);
+}
+
+void Game::setSessionStats(std::shared_ptr<SessionStatsCollector> stats) {
+    sessionStats_ = std::move(stats);
+}
+
+void Game::setComputer(std::shared_ptr<IPlayer> computer) {
+    if (!computer) {
+        throw std::invalid_argument("Game::setComputer: null player");
+    }
+    computer_ = std::move(computer);
+}
+
 void Game::emit(const std::string& msg) {
     if (outputCallback_) {
         outputCallback_(msg);
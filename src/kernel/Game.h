@@ -4,6 +4,10 @@
 #include "Session.h"
 #include "User.h"
 #include "ComputerAI.h"
+#include "HistoryStore.h"
+#include "Leaderboard.h"
+#include "SessionStats.h"
+#include <atomic>
 #include <memory>
 #include <functional>
 
@@ -58,11 +62,33 @@ public:
      */
     Game(std::shared_ptr<IPlayer> user, std::shared_ptr<IPlayer> computer);
 
+    /** @brief Destroys the Game (an unfinished session stops counting as active). */
+    ~Game();
+
     /**
      * @brief Creates and starts a new Session with the configured rounds.
      * @param rounds Number of rounds (default 10).
      */
-    void newSession(int rounds = Session::DEFAULT_ROUNDS);
+    void newSession(std::int64_t rounds = Session::DEFAULT_ROUNDS);
+
+    /**
+     * @brief Sets how many rounds of history later sessions keep in RAM
+     *        (see MoveHistory); older rounds spill to disk.
+     * @param limit Rounds kept in memory, or MoveHistory::UNLIMITED.
+     */
+    void setHistoryLimit(std::size_t limit);
+
+    /**
+     * @brief Replaces the opponent for sessions started afterwards.
+     *
+     * The current session keeps the player it started with, so a
+     * strategy can be swapped (e.g. to a freshly loaded plugin) without
+     * disturbing a session in progress.
+     *
+     * @param computer The new AI player.
+     * @throws std::invalid_argument if @p computer is null.
+     */
+    void setComputer(std::shared_ptr<IPlayer> computer);
 
     /**
      * @brief Plays a single round in the current session.
@@ -71,7 +97,7 @@ public:
      */
     Move playSingleRound();
 
-    /** @brief Returns the current game state. */
+    /** @brief Returns the current game state (safe from any thread). */
     GameState getState() const;
 
     /** @brief Returns a pointer to the current session (nullptr if none). */
@@ -83,12 +109,45 @@ public:
      */
     void setOutputCallback(OutputCallback cb);
 
+    /**
+     * @brief Registers a structured per-round observer (e.g. a
+     *        RoundBroadcaster callback) for every session this Game runs.
+     * @param cb The callback function.
+     */
+    void setRoundObserver(Session::RoundCallback cb);
+
+    /**
+     * @brief Reports every finished session to @p board (shared with
+     *        other Games); the user is credited a win on a higher score.
+     * @param board The leaderboard, or nullptr to stop reporting.
+     */
+    void setLeaderboard(std::shared_ptr<Leaderboard> board);
+
+    /**
+     * @brief Appends every finished session to @p store, stamped with
+     *        the wall-clock time it finished.
+     * @param store The history store, or nullptr to stop recording.
+     */
+    void setHistoryStore(std::shared_ptr<HistoryStore> store);
+
+    /**
+     * @brief Records every finished session into @p stats (typically
+     *        shared by many Games on many threads).
+     * @param stats The collector, or nullptr to stop recording.
+     */
+    void setSessionStats(std::shared_ptr<SessionStatsCollector> stats);
+
 private:
     std::shared_ptr<IPlayer> user_;
     std::shared_ptr<IPlayer> computer_;
     std::unique_ptr<Session> currentSession_;
-    GameState state_;
+    std::atomic<GameState> state_;
     OutputCallback outputCallback_;
+    Session::RoundCallback roundObserver_;
+    std::size_t historyLimit_ = MoveHistory::UNLIMITED;
+    std::shared_ptr<Leaderboard> leaderboard_;
+    std::shared_ptr<HistoryStore> historyStore_;
+    std::shared_ptr<SessionStatsCollector> sessionStats_;
 
     /**
      * @brief Sends a message through the output callback (if registered).
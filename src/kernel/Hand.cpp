@@ -1,16 +1,45 @@
 #include "kernel/Hand.h"
+#include "kernel/CounterRng.h"
+#include <algorithm>
 #include <random>
 
+namespace {
+    /// Per-thread engine shared by the single and bulk factories.
+    std::mt19937& threadEngine() {
+        static thread_local std::mt19937 rng{std::random_device{}()};
+        return rng;
+    }
+
+    constexpr std::uint32_t DIGITS_PER_DRAW = 20;
+    constexpr std::uint32_t POW3_20 = 3486784401u; ///< 3^20 < 2^32.
+}
+
 Hand::Hand() : currentCombination_(Combination::Rock) {}
 
 Hand::Hand(Combination combination) : currentCombination_(combination) {}
 
 Hand Hand::generateCombination() {
-    // Thread-local random engine seeded once per thread
-    static thread_local std::mt19937 rng{std::random_device{}()};
     std::uniform_int_distribution<int> dist(0, 2);
+    return Hand(static_cast<Combination>(dist(threadEngine())));
+}
+
+void Hand::generateCombinations(Combination* out, std::size_t count) {
+    std::mt19937& rng = threadEngine();
+    std::size_t i = 0;
+    while (i < count) {
+        std::uint32_t x = static_cast<std::uint32_t>(rng());
+        if (x >= POW3_20) continue; // keeps every digit uniform
+        const std::size_t n = std::min<std::size_t>(DIGITS_PER_DRAW, count - i);
+        for (std::size_t d = 0; d < n; ++d) {
+            out[i++] = static_cast<Combination>(x % 3);
+            x /= 3;
+        }
+    }
+}
 
-    return Hand(static_cast<Combination>(dist(rng)));
+Hand Hand::generateCombination(std::uint64_t seed, std::uint64_t sessionId,
+                               std::uint64_t roundIndex, std::uint32_t stream) {
+    return Hand(CounterRng::combinationAt(seed, sessionId, roundIndex, stream));
 }
 
 Combination Hand::getCombination() const {
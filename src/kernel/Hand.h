@@ -2,6 +2,8 @@
 #define HAND_H
 
 #include "Combination.h"
+#include <cstddef>
+#include <cstdint>
 
 /**
  * @file Hand.h
@@ -38,6 +40,31 @@ public:
      */
     static Hand generateCombination();
 
+    /**
+     * @brief Bulk factory: fills @p out with @p count random gestures
+     *        from the same per-thread engine as generateCombination().
+     *
+     * Each 32-bit draw below 3^20 is split into 20 base-3 digits
+     * (larger draws are rejected), so the gestures stay unbiased while
+     * the engine runs about 16x less often than with per-call draws.
+     *
+     * @param out   Destination for @p count gestures.
+     * @param count Number of gestures to generate.
+     */
+    static void generateCombinations(Combination* out, std::size_t count);
+
+    /**
+     * @brief Reproducible factory: the gesture for one player of one
+     *        round, derived statelessly from a counter-based RNG.
+     * @param seed       Global seed of the run.
+     * @param sessionId  Session number within the run.
+     * @param roundIndex Round number within the session.
+     * @param stream     Player stream 0..3.
+     * @return The same Hand for the same arguments, on any thread.
+     */
+    static Hand generateCombination(std::uint64_t seed, std::uint64_t sessionId,
+                                    std::uint64_t roundIndex, std::uint32_t stream = 0);
+
     /**
      * @brief Returns the current combination held by this hand.
      * @return The stored Combination value.
@@ -0,0 +1,274 @@
+#include "kernel/HistoryStore.h"
+#include "kernel/Session.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace {
+    void putVarint(std::vector<std::uint8_t>& out, std::int64_t value) {
+        // Zig-zag so small negative deltas (out-of-order appends) stay short.
+        std::uint64_t v = (static_cast<std::uint64_t>(value) << 1) ^
+                          static_cast<std::uint64_t>(value >> 63);
+        while (v >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(v));
+    }
+
+    std::int64_t getVarint(const std::uint8_t*& p) {
+        std::uint64_t v = 0;
+        int shift = 0;
+        while (*p & 0x80) {
+            v |= static_cast<std::uint64_t>(*p++ & 0x7F) << shift;
+            shift += 7;
+        }
+        v |= static_cast<std::uint64_t>(*p++) << shift;
+        return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+    }
+
+    template <typename T>
+    std::size_t bytesOf(const std::vector<T>& v) { return v.capacity() * sizeof(T); }
+}
+
+double HistoryStats::winRate() const {
+    return sessions == 0 ? 0.0 : static_cast<double>(sessionsWon) / static_cast<double>(sessions);
+}
+
+void HistoryStats::merge(const HistoryStats& other) {
+    sessions     += other.sessions;
+    sessionsWon  += other.sessionsWon;
+    sessionsLost += other.sessionsLost;
+    rounds       += other.rounds;
+    roundsWon    += other.roundsWon;
+    roundsLost   += other.roundsLost;
+}
+
+void HistoryStore::Chunk::pushHand(std::uint8_t nibble) {
+    if (handNibbles % 2 == 0) {
+        hands.push_back(nibble);
+    } else {
+        hands.back() = static_cast<std::uint8_t>(hands.back() | (nibble << 4));
+    }
+    ++handNibbles;
+}
+
+void HistoryStore::Chunk::pushHands(const std::vector<std::uint8_t>& packed,
+                                    std::uint64_t nibbles) {
+    if (handNibbles % 2 == 0) {
+        hands.insert(hands.end(), packed.begin(), packed.end());
+        handNibbles += nibbles;
+        return;
+    }
+    for (std::uint64_t i = 0; i < nibbles; ++i) {
+        pushHand(static_cast<std::uint8_t>((packed[i / 2] >> ((i % 2) * 4)) & 0x0F));
+    }
+}
+
+std::uint8_t HistoryStore::Chunk::handAt(std::uint64_t nibble) const {
+    return static_cast<std::uint8_t>((hands[nibble / 2] >> ((nibble % 2) * 4)) & 0x0F);
+}
+
+HistoryStore::HistoryStore(unsigned threads)
+    : threads_(threads ? threads : std::max(1u, std::thread::hardware_concurrency()))
+{}
+
+std::uint32_t HistoryStore::internLocked(std::string_view name) {
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    const auto id = static_cast<std::uint32_t>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(std::string_view(names_.back()), id);
+    chunksByUser_.emplace_back();
+    return id;
+}
+
+bool HistoryStore::lookupLocked(const std::string& name, std::uint32_t& id) const {
+    auto it = ids_.find(name);
+    if (it == ids_.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+template <typename MoveIt>
+void HistoryStore::appendRange(std::string_view user, std::string_view opponent,
+                               std::int64_t timestampMs, MoveIt first, std::size_t count) {
+    // Encode outside the lock: walking a spilled MoveHistory reads from disk.
+    std::vector<std::uint8_t> packed((count + 1) / 2);
+    std::uint64_t userWins = 0;
+    std::uint64_t opponentWins = 0;
+    for (std::size_t i = 0; i < count; ++i, ++first) {
+        const Move move = *first;
+        const auto u = static_cast<std::uint8_t>(move.getUserHand().getCombination());
+        const auto c = static_cast<std::uint8_t>(move.getComputerHand().getCombination());
+        packed[i / 2] = static_cast<std::uint8_t>(packed[i / 2] | ((u | (c << 2)) << ((i % 2) * 4)));
+        switch (move.getWhoWins()) {
+            case MoveResult::UserWins:     ++userWins;     break;
+            case MoveResult::ComputerWins: ++opponentWins; break;
+            case MoveResult::Draw:                         break;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    const std::uint32_t userId = internLocked(user);
+    const std::uint32_t opponentId = internLocked(opponent);
+
+    if (chunks_.empty() || chunks_.back().size() == CHUNK_SESSIONS) {
+        chunks_.emplace_back();
+    }
+    const auto chunkIndex = static_cast<std::uint32_t>(chunks_.size() - 1);
+    Chunk& chunk = chunks_.back();
+    chunk.pushHands(packed, count);
+
+    chunk.user.push_back(userId);
+    chunk.opponent.push_back(opponentId);
+    putVarint(chunk.tsDelta, timestampMs - chunk.lastTs);
+    chunk.lastTs = timestampMs;
+    chunk.rounds.push_back(count);
+    chunk.userWins.push_back(userWins);
+    chunk.opponentWins.push_back(opponentWins);
+
+    chunk.minTs = std::min(chunk.minTs, timestampMs);
+    chunk.maxTs = std::max(chunk.maxTs, timestampMs);
+    chunk.minOpponent = std::min(chunk.minOpponent, opponentId);
+    chunk.maxOpponent = std::max(chunk.maxOpponent, opponentId);
+
+    auto& index = chunksByUser_[userId];
+    if (index.empty() || index.back() != chunkIndex) {
+        index.push_back(chunkIndex);
+    }
+    ++sessionCount_;
+    roundCount_ += count;
+}
+
+void HistoryStore::append(std::string_view user, std::string_view opponent,
+                          std::int64_t timestampMs, const Move* moves, std::size_t count) {
+    appendRange(user, opponent, timestampMs, moves, count);
+}
+
+void HistoryStore::record(const Session& session, std::int64_t timestampMs) {
+    const MoveHistory& moves = session.getMoves();
+    appendRange(session.getUser()->getNameView(), session.getComputer()->getNameView(),
+                timestampMs, moves.begin(), moves.size());
+}
+
+void HistoryStore::scanChunk(const Chunk& chunk, const HistoryQuery& q, bool hasUser,
+                             std::uint32_t user, bool hasOpponent, std::uint32_t opponent,
+                             HistoryResult& out) const {
+    // Timestamps are only decoded when the chunk straddles the time filter.
+    const bool allInTime = chunk.minTs >= q.fromMs && chunk.maxTs < q.toMs;
+    const std::uint8_t* ts = chunk.tsDelta.data();
+    std::int64_t timestamp = 0;
+    std::uint64_t nibble = 0;
+
+    const std::size_t n = chunk.size();
+    for (std::size_t row = 0; row < n; ++row) {
+        const std::uint64_t rounds = chunk.rounds[row];
+        const std::uint64_t firstHand = nibble;
+        nibble += rounds;
+        if (!allInTime) {
+            timestamp += getVarint(ts);
+            if (timestamp < q.fromMs || timestamp >= q.toMs) continue;
+        }
+        if (hasUser && chunk.user[row] != user) continue;
+        if (hasOpponent && chunk.opponent[row] != opponent) continue;
+
+        HistoryStats s;
+        s.sessions     = 1;
+        s.sessionsWon  = chunk.userWins[row] > chunk.opponentWins[row];
+        s.sessionsLost = chunk.userWins[row] < chunk.opponentWins[row];
+        s.rounds       = rounds;
+        s.roundsWon    = chunk.userWins[row];
+        s.roundsLost   = chunk.opponentWins[row];
+        out.total.merge(s);
+        if (rounds > 0) {
+            out.byFirstGesture[chunk.handAt(firstHand) & 0x03].merge(s);
+        }
+    }
+}
+
+HistoryResult HistoryStore::query(const HistoryQuery& q) const {
+    HistoryResult result;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    std::uint32_t user = 0;
+    std::uint32_t opponent = 0;
+    const bool hasUser = !q.user.empty();
+    const bool hasOpponent = !q.opponent.empty();
+    if ((hasUser && !lookupLocked(q.user, user)) ||
+        (hasOpponent && !lookupLocked(q.opponent, opponent)) ||
+        q.fromMs >= q.toMs) {
+        return result;
+    }
+
+    // Per-user index, then zone maps.
+    std::vector<const Chunk*> candidates;
+    auto consider = [&](const Chunk& chunk) {
+        if (chunk.size() == 0 || chunk.maxTs < q.fromMs || chunk.minTs >= q.toMs) return;
+        if (hasOpponent && (opponent < chunk.minOpponent || opponent > chunk.maxOpponent)) return;
+        candidates.push_back(&chunk);
+    };
+    if (hasUser) {
+        for (std::uint32_t index : chunksByUser_[user]) consider(chunks_[index]);
+    } else {
+        for (const Chunk& chunk : chunks_) consider(chunk);
+    }
+    result.chunksScanned = candidates.size();
+    if (candidates.empty()) {
+        return result;
+    }
+
+    const unsigned threads = std::min<unsigned>(threads_, static_cast<unsigned>(candidates.size()));
+    std::vector<HistoryResult> partial(threads);
+    std::atomic<std::size_t> next{0};
+    auto worker = [&](unsigned t) {
+        for (std::size_t i = next++; i < candidates.size(); i = next++) {
+            scanChunk(*candidates[i], q, hasUser, user, hasOpponent, opponent, partial[t]);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) workers.emplace_back(worker, t);
+    worker(0);
+    for (auto& w : workers) w.join();
+
+    for (const HistoryResult& p : partial) {
+        result.total.merge(p.total);
+        for (std::size_t g = 0; g < result.byFirstGesture.size(); ++g) {
+            result.byFirstGesture[g].merge(p.byFirstGesture[g]);
+        }
+    }
+    return result;
+}
+
+std::size_t HistoryStore::getSessionCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return sessionCount_;
+}
+
+std::uint64_t HistoryStore::getRoundCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return roundCount_;
+}
+
+std::size_t HistoryStore::getChunkCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return chunks_.size();
+}
+
+std::size_t HistoryStore::getMemoryBytes() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::size_t bytes = 0;
+    for (const Chunk& c : chunks_) {
+        bytes += sizeof(Chunk) + bytesOf(c.user) + bytesOf(c.opponent) + bytesOf(c.tsDelta) +
+                 bytesOf(c.rounds) + bytesOf(c.userWins) + bytesOf(c.opponentWins) +
+                 bytesOf(c.hands);
+    }
+    for (const std::string& name : names_) bytes += sizeof(std::string) + name.capacity();
+    for (const auto& index : chunksByUser_) bytes += bytesOf(index);
+    return bytes;
+}
@@ -0,0 +1,175 @@
+#ifndef HISTORY_STORE_H
+#define HISTORY_STORE_H
+
+#include "Move.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class Session;
+
+/**
+ * @file HistoryStore.h
+ * @brief Columnar store of finished sessions for analytical queries.
+ *
+ * Sessions are appended to fixed-size chunks.  Inside a chunk every
+ * attribute is its own column, so a query reads only the columns it
+ * needs:
+ * - user / opponent – dictionary-encoded 32-bit ids;
+ * - timestamp – zig-zag varint deltas from the previous session;
+ * - rounds, user wins, opponent wins – 64-bit counters;
+ * - hands – 4 bits per round (two gestures), packed back to back.
+ *
+ * Each chunk keeps a zone map (time range, opponent-id range), and a
+ * per-user index lists the chunks a user appears in.  A query over one
+ * user therefore visits only that user's chunks, skips chunks whose
+ * zone map misses the filter, and decodes timestamps only for chunks
+ * that straddle a time boundary.  The surviving chunks are scanned in
+ * parallel and the partial results merged.
+ *
+ * @par Design Patterns
+ * - **Flyweight** – names are stored once in the dictionary.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – storage and scanning only; players and
+ *   rules stay in Session.
+ */
+
+/** @brief Filter of a HistoryStore query; defaults match everything. */
+struct HistoryQuery {
+    std::string user;     ///< Only this user's sessions (empty = all).
+    std::string opponent; ///< Only sessions against this opponent (empty = all).
+    std::int64_t fromMs = std::numeric_limits<std::int64_t>::min(); ///< Inclusive.
+    std::int64_t toMs   = std::numeric_limits<std::int64_t>::max(); ///< Exclusive.
+};
+
+/** @brief Aggregated outcome of a set of sessions, from the user's side. */
+struct HistoryStats {
+    std::uint64_t sessions     = 0;
+    std::uint64_t sessionsWon  = 0;
+    std::uint64_t sessionsLost = 0;
+    std::uint64_t rounds       = 0;
+    std::uint64_t roundsWon    = 0;
+    std::uint64_t roundsLost   = 0;
+
+    /** @brief Sessions won / sessions (0 if empty). */
+    double winRate() const;
+
+    /** @brief Adds @p other into this. */
+    void merge(const HistoryStats& other);
+};
+
+/** @brief Result of HistoryStore::query(). */
+struct HistoryResult {
+    HistoryStats total;
+    /** Sessions grouped by the user's first gesture (index = Combination). */
+    std::array<HistoryStats, 3> byFirstGesture{};
+    std::size_t chunksScanned = 0; ///< Chunks that survived index and zone maps.
+};
+
+/**
+ * @class HistoryStore
+ * @brief Append-only columnar history of finished sessions.
+ *
+ * Appends and queries are thread-safe; queries run concurrently with
+ * each other and exclude appends while they scan.  An append encodes
+ * its rounds before taking the lock, so reading a long (possibly
+ * disk-spilled) history never stalls queries.
+ */
+class HistoryStore {
+public:
+    static constexpr std::size_t CHUNK_SESSIONS = 4096; ///< Sessions per chunk.
+
+    /**
+     * @brief Creates an empty store.
+     * @param threads Scan threads per query (0 = hardware concurrency).
+     */
+    explicit HistoryStore(unsigned threads = 0);
+
+    HistoryStore(const HistoryStore&) = delete;
+    HistoryStore& operator=(const HistoryStore&) = delete;
+
+    /**
+     * @brief Appends one finished session.
+     * @param user        User name.
+     * @param opponent    Opponent name.
+     * @param timestampMs When the session finished (ms since the epoch).
+     * @param moves       The rounds, in order.
+     * @param count       Number of rounds.
+     */
+    void append(std::string_view user, std::string_view opponent,
+                std::int64_t timestampMs, const Move* moves, std::size_t count);
+
+    /**
+     * @brief Appends @p session (its players, scores and full history).
+     * @param session     A finished (or stopped) session.
+     * @param timestampMs When the session finished (ms since the epoch).
+     */
+    void record(const Session& session, std::int64_t timestampMs);
+
+    /** @brief Aggregates every session matching @p query. */
+    HistoryResult query(const HistoryQuery& query) const;
+
+    /** @brief Returns the number of stored sessions. */
+    std::size_t getSessionCount() const;
+
+    /** @brief Returns the number of stored rounds. */
+    std::uint64_t getRoundCount() const;
+
+    /** @brief Returns the number of chunks (the last may be partial). */
+    std::size_t getChunkCount() const;
+
+    /** @brief Returns the approximate heap footprint of the columns. */
+    std::size_t getMemoryBytes() const;
+
+private:
+    struct Chunk {
+        // Zone map.
+        std::int64_t  minTs = std::numeric_limits<std::int64_t>::max();
+        std::int64_t  maxTs = std::numeric_limits<std::int64_t>::min();
+        std::uint32_t minOpponent = std::numeric_limits<std::uint32_t>::max();
+        std::uint32_t maxOpponent = 0;
+
+        // Columns, one entry per session (hands: one nibble per round).
+        std::vector<std::uint32_t> user;
+        std::vector<std::uint32_t> opponent;
+        std::int64_t lastTs = 0;          ///< Decoder state for the next append.
+        std::vector<std::uint8_t> tsDelta; ///< Zig-zag varints.
+        std::vector<std::uint64_t> rounds;
+        std::vector<std::uint64_t> userWins;
+        std::vector<std::uint64_t> opponentWins;
+        std::vector<std::uint8_t> hands;
+        std::uint64_t handNibbles = 0;
+
+        std::size_t size() const { return user.size(); }
+        void pushHand(std::uint8_t nibble);
+        void pushHands(const std::vector<std::uint8_t>& packed, std::uint64_t nibbles);
+        std::uint8_t handAt(std::uint64_t nibble) const;
+    };
+
+    template <typename MoveIt>
+    void appendRange(std::string_view user, std::string_view opponent,
+                     std::int64_t timestampMs, MoveIt first, std::size_t count);
+    std::uint32_t internLocked(std::string_view name);
+    bool lookupLocked(const std::string& name, std::uint32_t& id) const;
+    void scanChunk(const Chunk& chunk, const HistoryQuery& q, bool hasUser, std::uint32_t user,
+                   bool hasOpponent, std::uint32_t opponent, HistoryResult& out) const;
+
+    unsigned threads_;
+    mutable std::shared_mutex mutex_;
+    std::deque<std::string> names_;                           ///< Dictionary, by id.
+    std::unordered_map<std::string_view, std::uint32_t> ids_; ///< Keys view names_.
+    std::vector<std::vector<std::uint32_t>> chunksByUser_;    ///< Per-user chunk index.
+    std::deque<Chunk> chunks_;
+    std::size_t sessionCount_ = 0;
+    std::uint64_t roundCount_ = 0;
+};
+
+#endif // HISTORY_STORE_H
@@ -0,0 +1,87 @@
+#include "kernel/HyperLogLog.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    /// Position of the first set bit, counting from 1 at the top.
+    unsigned leadingZerosPlusOne(std::uint64_t w) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_clzll(w)) + 1;
+#else
+        unsigned n = 1;
+        while (!(w & (std::uint64_t{1} << 63))) {
+            w <<= 1;
+            ++n;
+        }
+        return n;
+#endif
+    }
+}
+
+void HyperLogLog::addHash(std::uint64_t h) noexcept {
+    const std::size_t index = static_cast<std::size_t>(h >> (64 - PRECISION));
+    // The sentinel bit caps the rank at 64 - PRECISION + 1 and keeps w != 0.
+    const std::uint64_t w = (h << PRECISION) | (std::uint64_t{1} << (PRECISION - 1));
+    const auto rank = static_cast<std::uint8_t>(leadingZerosPlusOne(w));
+    if (rank > registers_[index]) registers_[index] = rank;
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) noexcept {
+    for (std::size_t i = 0; i < REGISTERS; ++i) {
+        registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+}
+
+void HyperLogLog::reset() noexcept {
+    registers_.fill(0);
+}
+
+double HyperLogLog::estimate() const noexcept {
+    constexpr double m = static_cast<double>(REGISTERS);
+    constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+
+    double sum = 0.0;
+    std::size_t zeros = 0;
+    for (std::uint8_t r : registers_) {
+        sum += std::ldexp(1.0, -static_cast<int>(r));
+        zeros += r == 0;
+    }
+    const double raw = alpha * m * m / sum;
+    if (raw <= 2.5 * m && zeros > 0) {
+        return m * std::log(m / static_cast<double>(zeros)); // linear counting
+    }
+    return raw; // 64-bit hashes need no large-range correction
+}
+
+std::uint64_t HyperLogLog::hash(std::string_view item) noexcept {
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for (unsigned char c : item) {
+        h ^= c;
+        h *= 0x100000001b3ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+void HyperLogLog::serialize(std::vector<std::uint8_t>& out) const {
+    out.push_back(static_cast<std::uint8_t>(PRECISION));
+    out.insert(out.end(), registers_.begin(), registers_.end());
+}
+
+bool HyperLogLog::deserialize(const std::vector<std::uint8_t>& in, std::size_t& pos) {
+    if (pos >= in.size() || in.size() - pos < 1 + REGISTERS || in[pos] != PRECISION) {
+        return false;
+    }
+    const auto* first = in.data() + pos + 1;
+    if (std::any_of(first, first + REGISTERS,
+                    [](std::uint8_t r) { return r > 64 - PRECISION + 1; })) {
+        return false;
+    }
+    std::copy(first, first + REGISTERS, registers_.begin());
+    pos += 1 + REGISTERS;
+    return true;
+}
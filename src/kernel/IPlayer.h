@@ -2,7 +2,9 @@
 #define IPLAYER_H
 
 #include "Hand.h"
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 /**
  * @file IPlayer.h
@@ -15,7 +17,8 @@
  * @par Design Patterns
  * - **Strategy** – concrete players implement different hand-selection
  *   strategies behind a uniform interface.
- * - **Interface Segregation** – minimal surface: name + choose.
+ * - **Interface Segregation** – minimal surface: name + choose, plus
+ *   a copy-free name view and an observation hook with defaults.
  *
  * @par SOLID
  * - **Dependency Inversion** – high-level modules (Session, Move)
@@ -33,6 +36,18 @@ public:
      */
     virtual std::string getName() const = 0;
 
+    /**
+     * @brief Returns the display name without copying it.
+     * @return A view valid for the lifetime of this player.  Consumers
+     *         that keep a name longer (leaderboard, history) copy it.
+     *
+     * Kernel players return the name they own.  The default caches
+     * getName() on the first call (one allocation, no lock) and returns
+     * the cache afterwards, so players whose name changes must override
+     * it.  Like the rest of the player, call it from the game thread.
+     */
+    virtual std::string_view getNameView() const;
+
     /**
      * @brief Asks the player to choose a hand for the current round.
      * @return The Hand chosen by this player.
@@ -41,6 +56,69 @@ public:
      * for the AI it generates a random hand.
      */
     virtual Hand chooseHand() = 0;
+
+    /**
+     * @brief Chooses the hands for @p count consecutive rounds at once.
+     * @param out   Destination for @p count hands.
+     * @param count Number of rounds.
+     *
+     * Used by Session::playBatch() for players whose isBatchable() is
+     * true.  The default calls chooseHand() @p count times; players that
+     * can produce hands in bulk override it to save the per-round
+     * virtual dispatch.
+     */
+    virtual void chooseHands(Hand* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = chooseHand();
+        }
+    }
+
+    /**
+     * @brief True if the player's hands do not depend on the rounds it
+     *        observes, so chooseHands() may pick a whole batch before any
+     *        of its rounds is observed.
+     *
+     * The default is false: Session::playBatch() then asks for one hand
+     * at a time and reports each round before the next choice, which is
+     * what adaptive strategies need.
+     */
+    virtual bool isBatchable() const {
+        return false;
+    }
+
+    /**
+     * @brief Called when a Session with this player is created.
+     *
+     * Players are reused across sessions (Game keeps its players), so
+     * strategies keyed on the current session's history reset here.
+     * The default does nothing.
+     */
+    virtual void onSessionStart() {}
+
+    /**
+     * @brief Informs the player of the hands played in the last round.
+     * @param own      The hand this player played.
+     * @param opponent The hand the opponent played.
+     *
+     * Called by Session after every round.  The default does nothing;
+     * adaptive strategies override it to learn from the history.
+     */
+    virtual void observeRound(const Hand& own, const Hand& opponent) {
+        (void)own;
+        (void)opponent;
+    }
+
+private:
+    mutable std::string nameCache_; ///< Default getNameView() storage.
+    mutable bool nameCached_ = false;
 };
 
+inline std::string_view IPlayer::getNameView() const {
+    if (!nameCached_) {
+        nameCache_ = getName();
+        nameCached_ = true;
+    }
+    return nameCache_;
+}
+
 #endif // IPLAYER_H
@@ -0,0 +1,104 @@
+#include "kernel/LatencyHistogram.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+unsigned highestBit(std::uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(v));
+#else
+    unsigned bit = 0;
+    while (v >>= 1) ++bit;
+    return bit;
+#endif
+}
+
+} // namespace
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+std::size_t LatencyHistogram::bucketIndex(std::uint64_t value) {
+    constexpr std::uint64_t SUB = 1u << SUB_BITS;
+    if (value < SUB) {
+        return static_cast<std::size_t>(value);
+    }
+    const unsigned top = highestBit(value);
+    const unsigned shift = top - SUB_BITS;
+    const std::uint64_t sub = (value >> shift) & (SUB - 1);
+    return (static_cast<std::size_t>(shift + 1) << SUB_BITS) + static_cast<std::size_t>(sub);
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(std::size_t index) {
+    constexpr std::uint64_t SUB = 1u << SUB_BITS;
+    if (index < SUB) {
+        return index;
+    }
+    const unsigned shift = static_cast<unsigned>(index >> SUB_BITS) - 1;
+    const std::uint64_t sub = index & (SUB - 1);
+    const std::uint64_t lower = (SUB + sub) << shift;
+    return lower + ((std::uint64_t{1} << shift) - 1);
+}
+
+void LatencyHistogram::record(std::uint64_t value) {
+    ++counts_[bucketIndex(value)];
+    ++count_;
+    sum_ += static_cast<double>(value);
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (std::size_t i = 0; i < BUCKETS; ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    count_ += other.count_;
+    sum_   += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+void LatencyHistogram::reset() {
+    counts_.fill(0);
+    count_ = 0;
+    min_ = std::numeric_limits<std::uint64_t>::max();
+    max_ = 0;
+    sum_ = 0.0;
+}
+
+std::uint64_t LatencyHistogram::getCount() const {
+    return count_;
+}
+
+std::uint64_t LatencyHistogram::getMin() const {
+    return count_ ? min_ : 0;
+}
+
+std::uint64_t LatencyHistogram::getMax() const {
+    return max_;
+}
+
+double LatencyHistogram::getMean() const {
+    return count_ ? sum_ / static_cast<double>(count_) : 0.0;
+}
+
+std::uint64_t LatencyHistogram::percentile(double q) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    q = std::min(std::max(q, 0.0), 1.0);
+    // Rank of the q-th value, 1-based.
+    auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count_) + 0.5);
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKETS; ++i) {
+        seen += counts_[i];
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(i), max_);
+        }
+    }
+    return max_;
+}
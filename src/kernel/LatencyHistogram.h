@@ -0,0 +1,76 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file LatencyHistogram.h
+ * @brief Fixed-size, mergeable log-linear histogram for latencies.
+ *
+ * Values (typically nanoseconds) are counted in buckets whose width
+ * grows with magnitude: every power of two is split into 16 linear
+ * sub-buckets, so any recorded value is reported within ~6 %.
+ * Recording is a couple of integer operations and never allocates;
+ * histograms from different threads are combined with merge().
+ *
+ * @par Design Patterns
+ * - **Value Object** – plain data, copyable and mergeable.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – distribution bookkeeping only.
+ */
+class LatencyHistogram {
+public:
+    /** @brief Linear sub-buckets per power of two (log2). */
+    static constexpr unsigned SUB_BITS = 4;
+
+    /** @brief Total number of buckets covering the full 64-bit range. */
+    static constexpr std::size_t BUCKETS = (64 - SUB_BITS + 1) << SUB_BITS;
+
+    LatencyHistogram();
+
+    /** @brief Records one value. */
+    void record(std::uint64_t value);
+
+    /** @brief Adds all counts of @p other into this histogram. */
+    void merge(const LatencyHistogram& other);
+
+    /** @brief Removes all recorded values. */
+    void reset();
+
+    /** @brief Returns the number of recorded values. */
+    std::uint64_t getCount() const;
+
+    /** @brief Returns the smallest recorded value (0 if empty). */
+    std::uint64_t getMin() const;
+
+    /** @brief Returns the largest recorded value (0 if empty). */
+    std::uint64_t getMax() const;
+
+    /** @brief Returns the arithmetic mean (0 if empty). */
+    double getMean() const;
+
+    /**
+     * @brief Returns the value at quantile @p q (0..1).
+     * @return The upper bound of the bucket holding the q-th value,
+     *         clamped to the recorded maximum (0 if empty).
+     */
+    std::uint64_t percentile(double q) const;
+
+    /** @brief Returns the bucket index for @p value. */
+    static std::size_t bucketIndex(std::uint64_t value);
+
+    /** @brief Returns the largest value that maps to bucket @p index. */
+    static std::uint64_t bucketUpperBound(std::size_t index);
+
+private:
+    std::array<std::uint64_t, BUCKETS> counts_;
+    std::uint64_t count_;
+    std::uint64_t min_;
+    std::uint64_t max_;
+    double sum_;
+};
+
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,318 @@
+#include "kernel/Leaderboard.h"
+#include "kernel/FileReplace.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    constexpr char SNAPSHOT_MAGIC[8] = {'R', 'S', 'P', 'L', 'B', '0', '0', '1'};
+
+    bool writeU32(std::FILE* f, std::uint32_t v) { return std::fwrite(&v, sizeof v, 1, f) == 1; }
+    bool writeU64(std::FILE* f, std::uint64_t v) { return std::fwrite(&v, sizeof v, 1, f) == 1; }
+    bool readU32(std::FILE* f, std::uint32_t& v) { return std::fread(&v, sizeof v, 1, f) == 1; }
+    bool readU64(std::FILE* f, std::uint64_t& v) { return std::fread(&v, sizeof v, 1, f) == 1; }
+
+    struct FileCloser {
+        void operator()(std::FILE* f) const { std::fclose(f); }
+    };
+    using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+}
+
+double LeaderboardEntry::winRate() const {
+    return sessionsPlayed == 0 ? 0.0
+                               : static_cast<double>(sessionsWon) / static_cast<double>(sessionsPlayed);
+}
+
+Leaderboard::Leaderboard() = default;
+
+Leaderboard::~Leaderboard() {
+    stopSnapshots();
+}
+
+bool Leaderboard::ahead(const LeaderboardEntry& a, const LeaderboardEntry& b) {
+    if (a.sessionsWon != b.sessionsWon) {
+        return a.sessionsWon > b.sessionsWon;
+    }
+    // Higher win rate first: a.won / a.played > b.won / b.played, compared
+    // exactly by cross-multiplying (counts stay far below 2^32).
+    const std::uint64_t lhs = a.sessionsWon * b.sessionsPlayed;
+    const std::uint64_t rhs = b.sessionsWon * a.sessionsPlayed;
+    if (lhs != rhs) {
+        return lhs > rhs;
+    }
+    return a.name < b.name;
+}
+
+int Leaderboard::randomLevel() {
+    // xorshift64; each extra level with probability 1/4.
+    int level = 1;
+    for (;;) {
+        rngState_ ^= rngState_ << 13;
+        rngState_ ^= rngState_ >> 7;
+        rngState_ ^= rngState_ << 17;
+        if (level >= MAX_LEVEL || (rngState_ & 3) != 0) {
+            return level;
+        }
+        ++level;
+    }
+}
+
+void Leaderboard::link(Node* node) {
+    std::array<Link*, MAX_LEVEL> update{};
+    std::array<std::size_t, MAX_LEVEL> rank{};
+
+    Link* links = head_.data();
+    for (int i = level_ - 1; i >= 0; --i) {
+        rank[i] = i == level_ - 1 ? 0 : rank[i + 1];
+        while (links[i].next && ahead(links[i].next->entry, node->entry)) {
+            rank[i] += links[i].span;
+            links = links[i].next->links.data();
+        }
+        update[i] = &links[i];
+    }
+
+    const int level = static_cast<int>(node->links.size());
+    for (int i = level_; i < level; ++i) {
+        rank[i] = 0;
+        update[i] = &head_[i];
+        head_[i].span = size_;
+    }
+    if (level > level_) {
+        level_ = level;
+    }
+
+    for (int i = 0; i < level; ++i) {
+        node->links[i].next = update[i]->next;
+        update[i]->next = node;
+        node->links[i].span = update[i]->span - (rank[0] - rank[i]);
+        update[i]->span = rank[0] - rank[i] + 1;
+    }
+    for (int i = level; i < level_; ++i) {
+        ++update[i]->span;
+    }
+    ++size_;
+}
+
+void Leaderboard::unlink(Node* node) {
+    std::array<Link*, MAX_LEVEL> update{};
+    Link* links = head_.data();
+    for (int i = level_ - 1; i >= 0; --i) {
+        while (links[i].next && ahead(links[i].next->entry, node->entry)) {
+            links = links[i].next->links.data();
+        }
+        update[i] = &links[i];
+    }
+
+    for (int i = 0; i < level_; ++i) {
+        if (update[i]->next == node) {
+            update[i]->span += node->links[i].span - 1;
+            update[i]->next = node->links[i].next;
+        } else {
+            --update[i]->span;
+        }
+    }
+    while (level_ > 1 && head_[level_ - 1].next == nullptr) {
+        --level_;
+    }
+    --size_;
+}
+
+std::size_t Leaderboard::rankOfLocked(const Node* node) const {
+    std::size_t rank = 0;
+    const Link* links = head_.data();
+    for (int i = level_ - 1; i >= 0; --i) {
+        while (links[i].next && !ahead(node->entry, links[i].next->entry)) {
+            rank += links[i].span;
+            if (links[i].next == node) {
+                return rank;
+            }
+            links = links[i].next->links.data();
+        }
+    }
+    return 0;
+}
+
+const Leaderboard::Node* Leaderboard::atRankLocked(std::size_t rank) const {
+    std::size_t traversed = 0;
+    const Link* links = head_.data();
+    const Node* node = nullptr;
+    for (int i = level_ - 1; i >= 0; --i) {
+        while (links[i].next && traversed + links[i].span <= rank) {
+            traversed += links[i].span;
+            node = links[i].next;
+            links = node->links.data();
+        }
+        if (traversed == rank) {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+void Leaderboard::recordSession(std::string_view name, bool won) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    Node* node;
+    auto it = byName_.find(name);
+    if (it == byName_.end()) {
+        auto fresh = std::make_unique<Node>();
+        fresh->entry.name = std::string(name);
+        fresh->links.resize(static_cast<std::size_t>(randomLevel()));
+        node = fresh.get();
+        byName_.emplace(std::string_view(node->entry.name), std::move(fresh));
+    } else {
+        node = it->second.get();
+        unlink(node);
+    }
+    ++node->entry.sessionsPlayed;
+    if (won) {
+        ++node->entry.sessionsWon;
+    }
+    link(node);
+}
+
+std::size_t Leaderboard::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return size_;
+}
+
+std::optional<std::size_t> Leaderboard::rankOf(std::string_view name) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = byName_.find(name);
+    if (it == byName_.end()) {
+        return std::nullopt;
+    }
+    return rankOfLocked(it->second.get());
+}
+
+std::optional<LeaderboardEntry> Leaderboard::find(std::string_view name) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = byName_.find(name);
+    if (it == byName_.end()) {
+        return std::nullopt;
+    }
+    return it->second->entry;
+}
+
+std::vector<LeaderboardEntry> Leaderboard::page(std::size_t offset, std::size_t count) const {
+    std::vector<LeaderboardEntry> out;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (offset >= size_ || count == 0) {
+        return out;
+    }
+    out.reserve(std::min(count, size_ - offset));
+    for (const Node* node = atRankLocked(offset + 1); node && out.size() < count;
+         node = node->links[0].next) {
+        out.push_back(node->entry);
+    }
+    return out;
+}
+
+std::vector<LeaderboardEntry> Leaderboard::top(std::size_t k) const {
+    return page(0, k);
+}
+
+void Leaderboard::clearLocked() {
+    byName_.clear();
+    head_ = {};
+    level_ = 1;
+    size_ = 0;
+}
+
+void Leaderboard::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    clearLocked();
+}
+
+bool Leaderboard::saveSnapshot(const std::string& path) const {
+    const std::vector<LeaderboardEntry> entries = page(0, static_cast<std::size_t>(-1));
+
+    const std::string tmp = path + ".tmp";
+    {
+        FilePtr file(std::fopen(tmp.c_str(), "wb"));
+        if (!file) return false;
+        bool ok = std::fwrite(SNAPSHOT_MAGIC, sizeof SNAPSHOT_MAGIC, 1, file.get()) == 1 &&
+                  writeU64(file.get(), entries.size());
+        for (const LeaderboardEntry& e : entries) {
+            if (!ok) break;
+            ok = writeU32(file.get(), static_cast<std::uint32_t>(e.name.size())) &&
+                 std::fwrite(e.name.data(), 1, e.name.size(), file.get()) == e.name.size() &&
+                 writeU64(file.get(), e.sessionsPlayed) &&
+                 writeU64(file.get(), e.sessionsWon);
+        }
+        if (!ok || std::fflush(file.get()) != 0) {
+            file.reset();
+            std::remove(tmp.c_str());
+            return false;
+        }
+    }
+    return replaceFile(tmp, path);
+}
+
+bool Leaderboard::loadSnapshot(const std::string& path) {
+    FilePtr file(std::fopen(path.c_str(), "rb"));
+    if (!file) return false;
+
+    char magic[sizeof SNAPSHOT_MAGIC];
+    std::uint64_t count = 0;
+    if (std::fread(magic, sizeof magic, 1, file.get()) != 1 ||
+        std::memcmp(magic, SNAPSHOT_MAGIC, sizeof magic) != 0 ||
+        !readU64(file.get(), count)) {
+        return false;
+    }
+
+    std::vector<std::unique_ptr<Node>> nodes;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        auto node = std::make_unique<Node>();
+        std::uint32_t length = 0;
+        if (!readU32(file.get(), length) || length > (1u << 20)) return false;
+        node->entry.name.resize(length);
+        if (std::fread(node->entry.name.data(), 1, length, file.get()) != length ||
+            !readU64(file.get(), node->entry.sessionsPlayed) ||
+            !readU64(file.get(), node->entry.sessionsWon) ||
+            node->entry.sessionsWon > node->entry.sessionsPlayed) {
+            return false;
+        }
+        nodes.push_back(std::move(node));
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    clearLocked();
+    for (auto& node : nodes) {
+        if (byName_.count(node->entry.name)) continue; // duplicate: keep the first
+        node->links.resize(static_cast<std::size_t>(randomLevel()));
+        link(node.get());
+        byName_.emplace(std::string_view(node->entry.name), std::move(node));
+    }
+    return true;
+}
+
+bool Leaderboard::startSnapshots(const std::string& path, std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    if (snapshotThread_.joinable()) {
+        return false;
+    }
+    snapshotStop_ = false;
+    snapshotThread_ = std::thread([this, path, interval]() {
+        std::unique_lock<std::mutex> lk(snapshotMutex_);
+        while (!snapshotWake_.wait_for(lk, interval, [this]() { return snapshotStop_; })) {
+            lk.unlock();
+            saveSnapshot(path);
+            lk.lock();
+        }
+        lk.unlock();
+        saveSnapshot(path);
+    });
+    return true;
+}
+
+void Leaderboard::stopSnapshots() {
+    std::thread worker;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        snapshotStop_ = true;
+        worker = std::move(snapshotThread_);
+    }
+    snapshotWake_.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
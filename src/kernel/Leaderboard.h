@@ -0,0 +1,152 @@
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file Leaderboard.h
+ * @brief Incrementally maintained player ranking with O(log n) queries.
+ *
+ * Players are ranked by sessions won, then by win rate, then by name.
+ * The ranking is an indexable skip list: every link stores how many
+ * entries it skips, so rank lookups, "entry at rank r" and top-K pages
+ * cost O(log n) (plus K) instead of a scan over all results.  A
+ * finished session moves one entry: unlink, update, relink – no
+ * allocation for a player already on the board.
+ *
+ * Queries take a shared lock and run concurrently; updates from game
+ * threads take the lock exclusively for the O(log n) relink.
+ *
+ * Snapshots are compact binary files written in rank order (to a
+ * temporary file, then renamed), so a restarted server reloads the
+ * board without replaying any results.
+ *
+ * @par Design Patterns
+ * - **Observer (light)** – Game reports finished sessions.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – ranking and its persistence only.
+ */
+
+/** @brief One player's standing. */
+struct LeaderboardEntry {
+    std::string name;
+    std::uint64_t sessionsPlayed = 0;
+    std::uint64_t sessionsWon    = 0;
+
+    /** @brief Sessions won / sessions played (0 if none played). */
+    double winRate() const;
+};
+
+/**
+ * @class Leaderboard
+ * @brief Thread-safe ranking of players across all sessions.
+ */
+class Leaderboard {
+public:
+    Leaderboard();
+    ~Leaderboard();
+
+    Leaderboard(const Leaderboard&) = delete;
+    Leaderboard& operator=(const Leaderboard&) = delete;
+
+    /**
+     * @brief Records one finished session for @p name.  Thread-safe.
+     * @param name Player name (the entry is created on first use).
+     * @param won  True if the player won the session.
+     */
+    void recordSession(std::string_view name, bool won);
+
+    /** @brief Returns the number of ranked players. */
+    std::size_t size() const;
+
+    /** @brief Returns the 1-based rank of @p name, if ranked. */
+    std::optional<std::size_t> rankOf(std::string_view name) const;
+
+    /** @brief Returns the standing of @p name, if ranked. */
+    std::optional<LeaderboardEntry> find(std::string_view name) const;
+
+    /**
+     * @brief Returns up to @p count entries starting at 0-based
+     *        position @p offset, best first.
+     */
+    std::vector<LeaderboardEntry> page(std::size_t offset, std::size_t count) const;
+
+    /** @brief Returns the best @p k entries. */
+    std::vector<LeaderboardEntry> top(std::size_t k) const;
+
+    /** @brief Removes every entry. */
+    void clear();
+
+    /**
+     * @brief Writes a snapshot of the board to @p path.
+     * @return true on success.
+     */
+    bool saveSnapshot(const std::string& path) const;
+
+    /**
+     * @brief Replaces the board with the snapshot in @p path.
+     * @return false (board unchanged) if the file is missing or corrupt.
+     */
+    bool loadSnapshot(const std::string& path);
+
+    /**
+     * @brief Starts a background thread that saves a snapshot to @p path
+     *        every @p interval (and once more on stop).
+     * @return false if snapshots are already running.
+     */
+    bool startSnapshots(const std::string& path, std::chrono::milliseconds interval);
+
+    /** @brief Stops periodic snapshots after writing a final one. */
+    void stopSnapshots();
+
+private:
+    static constexpr int MAX_LEVEL = 32;
+
+    struct Node;
+    struct Link {
+        Node* next = nullptr;
+        std::size_t span = 0; ///< Bottom-level entries this link skips.
+    };
+    struct Node {
+        LeaderboardEntry entry;
+        std::vector<Link> links; ///< One per level of this node.
+    };
+
+    /// True if @p a ranks strictly ahead of @p b.
+    static bool ahead(const LeaderboardEntry& a, const LeaderboardEntry& b);
+
+    int randomLevel();
+    void link(Node* node);
+    void unlink(Node* node);
+    std::size_t rankOfLocked(const Node* node) const;
+    const Node* atRankLocked(std::size_t rank) const;
+    void clearLocked();
+
+    mutable std::shared_mutex mutex_;
+    std::array<Link, MAX_LEVEL> head_{};
+    int level_ = 1;
+    std::size_t size_ = 0;
+    std::unordered_map<std::string_view, std::unique_ptr<Node>> byName_; ///< Keys view Node names.
+    std::uint64_t rngState_ = 0x9E3779B97F4A7C15ull;
+
+    std::mutex snapshotMutex_;
+    std::condition_variable snapshotWake_;
+    std::thread snapshotThread_;
+    bool snapshotStop_ = false;
+};
+
+#endif // LEADERBOARD_H
@@ -0,0 +1,186 @@
+#include "kernel/Matchmaker.h"
+#include "kernel/Metrics.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+std::unique_ptr<Game> Match::makeGame() const {
+    return std::make_unique<Game>(first, second);
+}
+
+std::unique_ptr<Session> Match::makeSession(int rounds) const {
+    return std::make_unique<Session>(first, second, rounds);
+}
+
+Matchmaker::Matchmaker(MatchmakerConfig config)
+    : config_(config)
+{
+    if (config_.bucketWidth <= 0 || config_.maxRating < config_.minRating) {
+        throw std::invalid_argument("Matchmaker: invalid rating buckets");
+    }
+    bucketCount_ = static_cast<std::size_t>(
+        (config_.maxRating - config_.minRating) / config_.bucketWidth + 1);
+    inboxes_ = std::make_unique<Inbox[]>(bucketCount_ * METRIC_SHARDS);
+    waiting_.resize(bucketCount_);
+}
+
+Matchmaker::~Matchmaker() {
+    stop();
+}
+
+std::size_t Matchmaker::bucketOf(int rating) const {
+    return static_cast<std::size_t>((rating - config_.minRating) / config_.bucketWidth);
+}
+
+int Matchmaker::allowedGap(const Entry& older, Clock::time_point now) const {
+    const double waited = std::chrono::duration<double>(now - older.joined).count();
+    const double gap = config_.baseGap + config_.gapPerSecond * std::max(0.0, waited);
+    return static_cast<int>(std::min<double>(gap, config_.maxGap));
+}
+
+std::uint64_t Matchmaker::join(std::shared_ptr<IPlayer> player, int rating,
+                               Clock::time_point now) {
+    if (!player) {
+        throw std::invalid_argument("Matchmaker: null player");
+    }
+    rating = std::clamp(rating, config_.minRating, config_.maxRating);
+    const std::uint64_t ticket = nextTicket_.fetch_add(1, std::memory_order_relaxed);
+
+    Inbox& inbox = inboxes_[bucketOf(rating) * METRIC_SHARDS + metricShard()];
+    {
+        std::lock_guard<std::mutex> lock(inbox.mutex);
+        inbox.entries.push_back(Entry{ticket, std::move(player), rating, now});
+    }
+    joins_.fetch_add(1, std::memory_order_release);
+    return ticket;
+}
+
+Match Matchmaker::makeMatch(Entry& a, Entry& b, Clock::time_point now) {
+    Entry& older = a.ticket < b.ticket ? a : b;
+    Entry& newer = a.ticket < b.ticket ? b : a;
+    Match m;
+    m.first        = std::move(older.player);
+    m.second       = std::move(newer.player);
+    m.firstRating  = older.rating;
+    m.secondRating = newer.rating;
+    m.waitSeconds  = std::max(0.0, std::chrono::duration<double>(now - older.joined).count());
+    return m;
+}
+
+std::vector<Match> Matchmaker::pump(Clock::time_point now) {
+    std::lock_guard<std::mutex> pumpLock(pumpMutex_);
+    std::vector<Match> matches;
+    std::vector<Entry> drained;
+
+    // Pass 1: drain each bucket's inboxes and pair in join order.
+    for (std::size_t b = 0; b < bucketCount_; ++b) {
+        std::vector<Entry>& waiting = waiting_[b];
+        const std::size_t before = waiting.size();
+        for (std::size_t s = 0; s < METRIC_SHARDS; ++s) {
+            Inbox& inbox = inboxes_[b * METRIC_SHARDS + s];
+            {
+                std::lock_guard<std::mutex> lock(inbox.mutex);
+                if (inbox.entries.empty()) continue;
+                drained.swap(inbox.entries);
+            }
+            std::move(drained.begin(), drained.end(), std::back_inserter(waiting));
+            drained.clear();
+        }
+        if (waiting.size() != before) {
+            std::sort(waiting.begin(), waiting.end(),
+                      [](const Entry& x, const Entry& y) { return x.ticket < y.ticket; });
+        }
+
+        const std::size_t pairs = waiting.size() / 2;
+        for (std::size_t i = 0; i < pairs; ++i) {
+            matches.push_back(makeMatch(waiting[2 * i], waiting[2 * i + 1], now));
+        }
+        waiting.erase(waiting.begin(), waiting.begin() + static_cast<std::ptrdiff_t>(pairs * 2));
+    }
+
+    // Pass 2: at most one player is left per bucket; pair neighbours
+    // whose rating gap the older player's wait allows.
+    std::vector<Entry>* carry = nullptr;
+    for (std::size_t b = 0; b < bucketCount_; ++b) {
+        if (waiting_[b].empty()) continue;
+        if (carry) {
+            Entry& lo = carry->front();
+            Entry& hi = waiting_[b].front();
+            const Entry& older = lo.ticket < hi.ticket ? lo : hi;
+            if (hi.rating - lo.rating <= allowedGap(older, now)) {
+                matches.push_back(makeMatch(lo, hi, now));
+                carry->clear();
+                waiting_[b].clear();
+                carry = nullptr;
+                continue;
+            }
+        }
+        carry = &waiting_[b];
+    }
+
+    matches_.fetch_add(matches.size(), std::memory_order_release);
+    return matches;
+}
+
+bool Matchmaker::start(std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(threadMutex_);
+    if (matcher_.joinable()) {
+        return false;
+    }
+    stopping_ = false;
+    matcher_ = std::thread([this, interval]() {
+        for (;;) {
+            MatchCallback cb;
+            {
+                std::lock_guard<std::mutex> lk(threadMutex_);
+                cb = callback_;
+            }
+            if (cb) { // without a consumer, players stay queued
+                for (Match& m : pump()) {
+                    cb(m);
+                }
+            }
+            std::unique_lock<std::mutex> lk(threadMutex_);
+            if (wake_.wait_for(lk, interval, [this]() { return stopping_; })) {
+                break;
+            }
+        }
+    });
+    return true;
+}
+
+void Matchmaker::stop() {
+    std::thread matcher;
+    {
+        std::lock_guard<std::mutex> lock(threadMutex_);
+        stopping_ = true;
+        matcher = std::move(matcher_);
+    }
+    wake_.notify_all();
+    if (matcher.joinable()) {
+        matcher.join();
+    }
+}
+
+void Matchmaker::onMatch(MatchCallback cb) {
+    std::lock_guard<std::mutex> lock(threadMutex_);
+    callback_ = std::move(cb);
+}
+
+std::size_t Matchmaker::getWaitingCount() const {
+    const std::uint64_t matched = matches_.load(std::memory_order_acquire) * 2;
+    const std::uint64_t joined  = joins_.load(std::memory_order_acquire);
+    return joined > matched ? static_cast<std::size_t>(joined - matched) : 0;
+}
+
+std::uint64_t Matchmaker::getJoinCount() const {
+    return joins_.load(std::memory_order_acquire);
+}
+
+std::uint64_t Matchmaker::getMatchCount() const {
+    return matches_.load(std::memory_order_acquire);
+}
+
+const MatchmakerConfig& Matchmaker::getConfig() const {
+    return config_;
+}
@@ -0,0 +1,174 @@
+#ifndef MATCHMAKER_H
+#define MATCHMAKER_H
+
+#include "Game.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file Matchmaker.h
+ * @brief Rating-based matchmaking queue that pairs players into Games.
+ *
+ * Players join with a rating.  The rating range is cut into fixed-width
+ * buckets, and each bucket's inbox is sharded per thread (like the
+ * metrics counters), so join() only locks a slot that other threads
+ * rarely touch: its cost stays flat however many threads are joining.
+ *
+ * A single matcher – pump(), or the background thread started with
+ * start() – drains the inboxes and pairs players:
+ * 1. Within a bucket, in join order.
+ * 2. The at most one player left per bucket is paired with the nearest
+ *    leftover in a higher bucket if their rating gap is within the
+ *    allowed gap, which widens with the older player's wait time.
+ * Apart from ordering each bucket's new arrivals by ticket, both passes
+ * are linear in the players drained plus the number of buckets.
+ *
+ * @par Design Patterns
+ * - **Producer / Consumer** – many joining threads, one matcher.
+ * - **Factory Method** – a Match creates the Game or Session it describes.
+ * - **Observer (light)** – matches are delivered to a callback.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – pairing only; playing is Game's job.
+ * - **Dependency Inversion** – queues IPlayers, not concrete types.
+ */
+
+/** @brief Tuning knobs for a Matchmaker. */
+struct MatchmakerConfig {
+    int minRating   = 0;      ///< Ratings below are clamped.
+    int maxRating   = 4000;   ///< Ratings above are clamped.
+    int bucketWidth = 50;     ///< Rating span of one bucket.
+    int baseGap     = 100;    ///< Allowed rating gap for a fresh join.
+    double gapPerSecond = 100.0; ///< Gap widening per second of waiting.
+    int maxGap      = 1000;   ///< Gap never widens beyond this.
+};
+
+/**
+ * @brief Two players paired by the Matchmaker.
+ *
+ * @c first joined before @c second and takes the user seat.
+ */
+struct Match {
+    std::shared_ptr<IPlayer> first;
+    std::shared_ptr<IPlayer> second;
+    int firstRating  = 0;
+    int secondRating = 0;
+    double waitSeconds = 0.0; ///< How long the earlier player waited.
+
+    /** @brief Creates a Game with @c first as user, @c second as opponent. */
+    std::unique_ptr<Game> makeGame() const;
+
+    /** @brief Creates a Session of @p rounds between the two players. */
+    std::unique_ptr<Session> makeSession(int rounds = Session::DEFAULT_ROUNDS) const;
+};
+
+class Matchmaker {
+public:
+    using Clock = std::chrono::steady_clock;
+    using MatchCallback = std::function<void(Match&)>;
+
+    /** @param config Bucketing and gap parameters. */
+    explicit Matchmaker(MatchmakerConfig config = MatchmakerConfig());
+
+    /** @brief Stops the background matcher, if running. */
+    ~Matchmaker();
+
+    Matchmaker(const Matchmaker&) = delete;
+    Matchmaker& operator=(const Matchmaker&) = delete;
+
+    /**
+     * @brief Queues a player.  Thread-safe.
+     * @param player The player to match.
+     * @param rating The player's rating (clamped to the configured range).
+     * @param now    Join time (injectable for tests).
+     * @return A ticket number, increasing in join order.
+     * @throws std::invalid_argument if @p player is null.
+     */
+    std::uint64_t join(std::shared_ptr<IPlayer> player, int rating,
+                       Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Runs one matching pass.
+     *
+     * Safe to call from any thread; passes are serialised.  Each match
+     * is returned by exactly one pass, so while the background matcher
+     * runs, matches it forms go to its callback instead.
+     *
+     * @param now Time used for wait-based gap widening.
+     * @return The matches formed, oldest ticket first within a bucket.
+     */
+    std::vector<Match> pump(Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Starts a background thread that pumps every @p interval and
+     *        hands each match to the callback set with onMatch().
+     *
+     * The callback runs on the matcher thread without locks held; it
+     * must not call stop().  While no callback is set the thread does not
+     * pump, so joined players stay queued until one is.
+     * @return false if already running.
+     */
+    bool start(std::chrono::milliseconds interval = std::chrono::milliseconds(5));
+
+    /** @brief Stops the background thread (pending joins stay queued). */
+    void stop();
+
+    /** @brief Sets the callback used by the background matcher. */
+    void onMatch(MatchCallback cb);
+
+    /** @brief Returns the number of players waiting (joined, not matched). */
+    std::size_t getWaitingCount() const;
+
+    /** @brief Returns the total number of joins. */
+    std::uint64_t getJoinCount() const;
+
+    /** @brief Returns the total number of matches formed. */
+    std::uint64_t getMatchCount() const;
+
+    /** @brief Returns the configuration. */
+    const MatchmakerConfig& getConfig() const;
+
+private:
+    struct Entry {
+        std::uint64_t ticket;
+        std::shared_ptr<IPlayer> player;
+        int rating;
+        Clock::time_point joined;
+    };
+
+    /// Per-thread inbox slot of one bucket.
+    struct alignas(64) Inbox {
+        std::mutex mutex;
+        std::vector<Entry> entries;
+    };
+
+    std::size_t bucketOf(int rating) const;
+    int allowedGap(const Entry& older, Clock::time_point now) const;
+    static Match makeMatch(Entry& a, Entry& b, Clock::time_point now);
+
+    MatchmakerConfig config_;
+    std::size_t bucketCount_;
+    std::unique_ptr<Inbox[]> inboxes_;          ///< bucketCount_ × METRIC_SHARDS.
+    std::vector<std::vector<Entry>> waiting_;   ///< Matcher-owned, per bucket.
+    std::mutex pumpMutex_;                      ///< Serialises pump().
+
+    std::atomic<std::uint64_t> nextTicket_{0};
+    std::atomic<std::uint64_t> joins_{0};
+    std::atomic<std::uint64_t> matches_{0};
+
+    std::mutex threadMutex_;                    ///< Guards the fields below.
+    std::condition_variable wake_;
+    std::thread matcher_;
+    bool stopping_ = false;
+    MatchCallback callback_;
+};
+
+#endif // MATCHMAKER_H
@@ -0,0 +1,178 @@
+#include "kernel/MetaAI.h"
+#include "kernel/Combination.h"
+#include <algorithm>
+
+namespace {
+
+std::uint8_t argmax(const std::array<std::uint32_t, 3>& counts) {
+    std::uint8_t best = 0;
+    for (std::uint8_t i = 1; i < 3; ++i) {
+        if (counts[i] > counts[best]) best = i;
+    }
+    return best;
+}
+
+/// counterTo() on a gesture index.
+std::uint8_t counterIndex(std::uint8_t m) {
+    return static_cast<std::uint8_t>(counterTo(static_cast<Combination>(m)));
+}
+
+} // namespace
+
+MetaAI::MetaAI(const std::string& name,
+               std::chrono::nanoseconds budget,
+               std::size_t lookback)
+    : name_(name)
+    , budget_(budget)
+    , lookback_(std::max<std::size_t>(lookback, 1))
+    , lastEvaluated_(0)
+    , proposalsFresh_(false)
+{
+    proposed_.fill(NONE);
+    score_.fill(0.0f);
+}
+
+std::string MetaAI::getName() const {
+    return name_;
+}
+
+std::string_view MetaAI::getNameView() const {
+    return name_;
+}
+
+Hand MetaAI::chooseHand() {
+    const Clock::time_point deadline = Clock::now() + budget_;
+
+    std::array<std::uint8_t, BASE_COUNT> base;
+    base.fill(NONE);
+
+    if (!opp_.empty()) {
+        // Constant-time predictors always run.
+        base[Repeat]        = opp_.back();
+        base[Mirror]        = own_.back();
+        base[FreqAll]       = argmax(oppAll_);
+        base[FreqShort]     = argmax(oppShort_);
+        base[FreqLong]      = argmax(oppLong_);
+        base[CounterMyFreq] = counterIndex(argmax(ownAll_));
+
+        // History matchers are bounded by the deadline.
+        if (std::size_t j = matchPosition(opp_, deadline)) {
+            base[MatchOpponent] = opp_[j];
+        }
+        if (std::size_t j = matchPosition(own_, deadline)) {
+            base[MatchOwn] = counterIndex(own_[j]);
+        }
+        if (std::size_t j = matchPosition(joint_, deadline)) {
+            base[MatchBoth] = static_cast<std::uint8_t>(joint_[j] % 3);
+        }
+    }
+
+    // Expand each prediction p into its rotations: counter(p),
+    // counter(counter(p)), counter(counter(counter(p))).
+    for (std::size_t b = 0; b < BASE_COUNT; ++b) {
+        std::uint8_t p = base[b];
+        for (std::size_t r = 0; r < ROTATIONS; ++r) {
+            if (p != NONE) p = counterIndex(p);
+            proposed_[b * ROTATIONS + r] = p;
+        }
+    }
+    proposalsFresh_ = true;
+
+    std::size_t best = CANDIDATES;
+    lastEvaluated_ = 0;
+    for (std::size_t i = 0; i < CANDIDATES; ++i) {
+        if (proposed_[i] == NONE) continue;
+        ++lastEvaluated_;
+        if (best == CANDIDATES || score_[i] > score_[best]) best = i;
+    }
+
+    if (best == CANDIDATES) {
+        return Hand::generateCombination();
+    }
+    return Hand(static_cast<Combination>(proposed_[best]));
+}
+
+void MetaAI::observeRound(const Hand& own, const Hand& opponent) {
+    const auto me = static_cast<std::uint8_t>(own.getCombination());
+    const auto op = static_cast<std::uint8_t>(opponent.getCombination());
+
+    // Score every candidate against what the opponent actually played.
+    // payoff[m] is +1 if m beats op, -1 if it loses, 0 on draw / NONE.
+    std::array<float, 4> payoff{};
+    for (std::uint8_t m = 0; m < 3; ++m) {
+        payoff[m] = (m == op) ? 0.0f : (m == counterIndex(op) ? 1.0f : -1.0f);
+    }
+    // Only proposals made for this very round may be scored; without a
+    // chooseHand() since the last round they are stale.
+    if (proposalsFresh_) {
+        for (std::size_t i = 0; i < CANDIDATES; ++i) {
+            score_[i] = score_[i] * DECAY + payoff[proposed_[i]];
+        }
+        proposalsFresh_ = false;
+    }
+
+    own_.push_back(me);
+    opp_.push_back(op);
+    joint_.push_back(static_cast<std::uint8_t>(me * 3 + op));
+
+    ++oppAll_[op];
+    ++ownAll_[me];
+    ++oppShort_[op];
+    ++oppLong_[op];
+    const std::size_t n = opp_.size();
+    if (n > SHORT_WINDOW) --oppShort_[opp_[n - 1 - SHORT_WINDOW]];
+    if (n > LONG_WINDOW)  --oppLong_[opp_[n - 1 - LONG_WINDOW]];
+
+    trimHistory();
+}
+
+std::size_t MetaAI::matchPosition(const std::vector<std::uint8_t>& seq,
+                                  Clock::time_point deadline) const {
+    const std::size_t n = seq.size();
+    if (n < 2) return 0;
+
+    const std::size_t stop = n > lookback_ ? n - lookback_ : 0;
+    std::size_t bestLen = 0;
+    std::size_t bestPos = 0;
+
+    // j is the candidate "next move"; compare the moves before j with
+    // the moves at the end of the history.
+    for (std::size_t j = n - 1; j > stop; --j) {
+        if ((n - 1 - j) % 64 == 0 && Clock::now() >= deadline) break;
+
+        std::size_t len = 0;
+        while (len < MAX_MATCH && len < j && seq[j - 1 - len] == seq[n - 1 - len]) {
+            ++len;
+        }
+        if (len > bestLen) {
+            bestLen = len;
+            bestPos = j;
+            if (len == MAX_MATCH) break;
+        }
+    }
+    return bestPos;
+}
+
+void MetaAI::trimHistory() {
+    // Keep everything the matchers and the long window can still see;
+    // erase in bulk so the cost is amortised O(1) per round.
+    const std::size_t keep = lookback_ + MAX_MATCH + LONG_WINDOW;
+    if (opp_.size() < 2 * keep) return;
+
+    const auto drop = static_cast<std::ptrdiff_t>(opp_.size() - keep);
+    own_.erase(own_.begin(), own_.begin() + drop);
+    opp_.erase(opp_.begin(), opp_.begin() + drop);
+    joint_.erase(joint_.begin(), joint_.begin() + drop);
+}
+
+std::size_t MetaAI::getPredictorCount() const {
+    return CANDIDATES;
+}
+
+std::size_t MetaAI::getLastEvaluatedCount() const {
+    return lastEvaluated_;
+}
+
+std::chrono::nanoseconds MetaAI::getBudget() const {
+    return budget_;
+}
@@ -0,0 +1,138 @@
+#ifndef META_AI_H
+#define META_AI_H
+
+#include "IPlayer.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file MetaAI.h
+ * @brief Ensemble opponent that picks the best of many predictors each move.
+ *
+ * MetaAI follows the "Iocaine Powder" recipe: a set of base predictors
+ * each guess the opponent's next gesture (repeat, mirror, frequency,
+ * history matching, …).  Every guess is expanded into three rotations
+ * ("they will play p", "they expect me to counter p", …), giving
+ * dozens of candidate moves.  Each candidate is scored on the rounds
+ * already played and the best-scoring one is played.
+ *
+ * Candidate state is kept structure-of-arrays (one array of proposed
+ * moves, one array of scores), so scoring all candidates after a round
+ * is a single branch-free loop the compiler can vectorise.
+ *
+ * chooseHand() runs under a per-move time budget: the constant-time
+ * predictors always run, the history-matching scans stop when the
+ * budget is spent, and candidates that did not get evaluated simply sit
+ * out that round.
+ *
+ * @par Design Patterns
+ * - **Strategy** – adaptive hand-selection strategy.
+ * - **Composite (light)** – many predictors behind one IPlayer.
+ *
+ * @par SOLID
+ * - **Liskov Substitution** – drop-in replacement for any IPlayer.
+ * - **Open/Closed** – new predictors extend the table, not the callers.
+ */
+class MetaAI : public IPlayer {
+public:
+    /** @brief Default per-move time budget for chooseHand(). */
+    static constexpr std::chrono::microseconds DEFAULT_BUDGET{50};
+
+    /** @brief Default number of past rounds the matchers may scan. */
+    static constexpr std::size_t DEFAULT_LOOKBACK = 2048;
+
+    /**
+     * @brief Constructs the AI.
+     * @param name     Display name (defaults to "MetaAI").
+     * @param budget   Hard time budget for one chooseHand() call.
+     * @param lookback Maximum history length scanned by the matchers.
+     */
+    explicit MetaAI(const std::string& name = "MetaAI",
+                    std::chrono::nanoseconds budget = DEFAULT_BUDGET,
+                    std::size_t lookback = DEFAULT_LOOKBACK);
+
+    /** @copydoc IPlayer::getName */
+    std::string getName() const override;
+
+    /** @copydoc IPlayer::getNameView */
+    std::string_view getNameView() const override;
+
+    /** @copydoc IPlayer::chooseHand */
+    Hand chooseHand() override;
+
+    /** @copydoc IPlayer::observeRound */
+    void observeRound(const Hand& own, const Hand& opponent) override;
+
+    /** @brief Returns the number of candidate predictors. */
+    std::size_t getPredictorCount() const;
+
+    /** @brief Returns how many candidates were evaluated on the last move. */
+    std::size_t getLastEvaluatedCount() const;
+
+    /** @brief Returns the configured per-move time budget. */
+    std::chrono::nanoseconds getBudget() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /// Base predictors; each one is expanded into ROTATIONS candidates.
+    enum Base : std::size_t {
+        Repeat,        ///< Opponent repeats their last gesture.
+        Mirror,        ///< Opponent copies my last gesture.
+        FreqAll,       ///< Opponent's most frequent gesture overall.
+        FreqShort,     ///< … over the last SHORT_WINDOW rounds.
+        FreqLong,      ///< … over the last LONG_WINDOW rounds.
+        CounterMyFreq, ///< Opponent counters my most frequent gesture.
+        MatchOpponent, ///< History match on the opponent's sequence.
+        MatchOwn,      ///< History match on my own sequence.
+        MatchBoth,     ///< History match on the joint sequence.
+        BASE_COUNT
+    };
+
+    static constexpr std::size_t ROTATIONS    = 3;
+    static constexpr std::size_t CANDIDATES   = BASE_COUNT * ROTATIONS;
+    static constexpr std::size_t SHORT_WINDOW = 10;
+    static constexpr std::size_t LONG_WINDOW  = 50;
+    static constexpr std::size_t MAX_MATCH    = 32;
+    static constexpr std::uint8_t NONE        = 3;  ///< "No proposal" marker.
+    static constexpr float        DECAY       = 0.95f;
+
+    using Counts = std::array<std::uint32_t, 3>;
+
+    /**
+     * @brief Finds the most recent earlier point whose preceding moves
+     *        best match the end of @p seq.
+     * @return Index of the element that followed the match, or 0 if none.
+     */
+    std::size_t matchPosition(const std::vector<std::uint8_t>& seq,
+                              Clock::time_point deadline) const;
+
+    /// Drops history the matchers and windows can no longer reach.
+    void trimHistory();
+
+    std::string name_;
+    std::chrono::nanoseconds budget_;
+    std::size_t lookback_;
+
+    // History (gesture indices 0..2; joint_ holds own*3 + opponent).
+    std::vector<std::uint8_t> own_;
+    std::vector<std::uint8_t> opp_;
+    std::vector<std::uint8_t> joint_;
+
+    // Incrementally maintained frequency tables.
+    Counts oppAll_{};
+    Counts oppShort_{};
+    Counts oppLong_{};
+    Counts ownAll_{};
+
+    // Candidate state – structure of arrays.
+    std::array<std::uint8_t, CANDIDATES> proposed_;
+    std::array<float, CANDIDATES> score_;
+    std::size_t lastEvaluated_;
+    bool proposalsFresh_; ///< proposed_ belongs to the round being observed.
+};
+
+#endif // META_AI_H
@@ -0,0 +1,187 @@
+#include "kernel/Metrics.h"
+#include "kernel/FileReplace.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace {
+    std::atomic<std::size_t> g_nextShard{0};
+    std::atomic<bool> g_timingEnabled{false};
+
+    /// Writes `name{labels} value` (labels may be empty).
+    void writeSample(std::ostringstream& out, const std::string& name,
+                     const std::string& labels, const std::string& extraLabel,
+                     const std::string& value) {
+        out << name;
+        if (!labels.empty() || !extraLabel.empty()) {
+            out << '{' << labels;
+            if (!labels.empty() && !extraLabel.empty()) out << ',';
+            out << extraLabel << '}';
+        }
+        out << ' ' << value << '\n';
+    }
+}
+
+std::size_t metricShard() noexcept {
+    static thread_local const std::size_t shard =
+        g_nextShard.fetch_add(1, std::memory_order_relaxed) % METRIC_SHARDS;
+    return shard;
+}
+
+// ── MetricCounter / MetricHistogram ────────────────────────────────
+
+std::uint64_t MetricCounter::value() const noexcept {
+    std::uint64_t total = 0;
+    for (const Shard& s : shards_) {
+        total += s.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+MetricHistogram::Snapshot MetricHistogram::snapshot() const {
+    Snapshot snap;
+    snap.buckets.assign(LatencyHistogram::BUCKETS, 0);
+    for (const Shard& s : *shards_) {
+        for (std::size_t i = 0; i < LatencyHistogram::BUCKETS; ++i) {
+            const std::uint64_t c = s.buckets[i].load(std::memory_order_relaxed);
+            snap.buckets[i] += c;
+            snap.count += c;
+        }
+        snap.sum += s.sum.load(std::memory_order_relaxed);
+    }
+    return snap;
+}
+
+std::uint64_t MetricHistogram::Snapshot::quantile(double q) const {
+    if (count == 0) return 0;
+    q = std::min(std::max(q, 0.0), 1.0);
+    auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count) + 0.5);
+    rank = std::max<std::uint64_t>(rank, 1);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) return LatencyHistogram::bucketUpperBound(i);
+    }
+    return 0;
+}
+
+// ── MetricsRegistry ────────────────────────────────────────────────
+
+MetricsRegistry& MetricsRegistry::global() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+MetricsRegistry::Entry& MetricsRegistry::findOrAdd(Kind kind, const std::string& name,
+                                                   const std::string& help,
+                                                   const std::string& labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& e : entries_) {
+        if (e->name == name && e->labels == labels && e->kind == kind) {
+            return *e;
+        }
+    }
+    auto e = std::make_unique<Entry>();
+    e->kind = kind;
+    e->name = name;
+    e->help = help;
+    e->labels = labels;
+    switch (kind) {
+        case Kind::Counter:   e->counter   = std::make_unique<MetricCounter>();   break;
+        case Kind::Gauge:     e->gauge     = std::make_unique<MetricGauge>();     break;
+        case Kind::Histogram: e->histogram = std::make_unique<MetricHistogram>(); break;
+    }
+    entries_.push_back(std::move(e));
+    return *entries_.back();
+}
+
+MetricCounter& MetricsRegistry::counter(const std::string& name, const std::string& help,
+                                        const std::string& labels) {
+    return *findOrAdd(Kind::Counter, name, help, labels).counter;
+}
+
+MetricGauge& MetricsRegistry::gauge(const std::string& name, const std::string& help,
+                                    const std::string& labels) {
+    return *findOrAdd(Kind::Gauge, name, help, labels).gauge;
+}
+
+MetricHistogram& MetricsRegistry::histogram(const std::string& name, const std::string& help,
+                                            const std::string& labels) {
+    return *findOrAdd(Kind::Histogram, name, help, labels).histogram;
+}
+
+std::string MetricsRegistry::renderPrometheus() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream out;
+    std::vector<std::string> described;
+
+    for (const auto& e : entries_) {
+        // HELP / TYPE once per family, at its first appearance.
+        if (std::find(described.begin(), described.end(), e->name) == described.end()) {
+            described.push_back(e->name);
+            const char* type = e->kind == Kind::Counter ? "counter"
+                             : e->kind == Kind::Gauge   ? "gauge" : "summary";
+            out << "# HELP " << e->name << ' ' << e->help << '\n'
+                << "# TYPE " << e->name << ' ' << type << '\n';
+        }
+        switch (e->kind) {
+            case Kind::Counter:
+                writeSample(out, e->name, e->labels, "", std::to_string(e->counter->value()));
+                break;
+            case Kind::Gauge:
+                writeSample(out, e->name, e->labels, "", std::to_string(e->gauge->value()));
+                break;
+            case Kind::Histogram: {
+                const MetricHistogram::Snapshot snap = e->histogram->snapshot();
+                for (const char* q : {"0.5", "0.9", "0.99", "0.999"}) {
+                    writeSample(out, e->name, e->labels, std::string("quantile=\"") + q + "\"",
+                                std::to_string(snap.quantile(std::stod(q))));
+                }
+                writeSample(out, e->name + "_sum", e->labels, "", std::to_string(snap.sum));
+                writeSample(out, e->name + "_count", e->labels, "", std::to_string(snap.count));
+                break;
+            }
+        }
+    }
+    return out.str();
+}
+
+bool MetricsRegistry::writeToFile(const std::string& path) const {
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream file(tmp, std::ios::trunc);
+        if (!file) return false;
+        file << renderPrometheus();
+        if (!file.flush()) return false;
+    }
+    return replaceFile(tmp, path);
+}
+
+// ── KernelMetrics ──────────────────────────────────────────────────
+
+KernelMetrics& KernelMetrics::get() {
+    static KernelMetrics metrics = [] {
+        MetricsRegistry& r = MetricsRegistry::global();
+        const char* results = "Rounds played, by outcome.";
+        return KernelMetrics{
+            r.counter("rsp_sessions_started_total", "Sessions whose first round began."),
+            r.counter("rsp_sessions_finished_total", "Sessions that played all their rounds."),
+            r.counter("rsp_rounds_total", "Rounds played."),
+            r.counter("rsp_round_results_total", results, "result=\"user_wins\""),
+            r.counter("rsp_round_results_total", results, "result=\"computer_wins\""),
+            r.counter("rsp_round_results_total", results, "result=\"draw\""),
+            r.gauge("rsp_active_games", "Games with a session in progress."),
+            r.histogram("rsp_round_latency_nanoseconds",
+                        "Wall time of Session::playRound (when timing is enabled)."),
+        };
+    }();
+    return metrics;
+}
+
+void KernelMetrics::setTimingEnabled(bool enabled) noexcept {
+    g_timingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool KernelMetrics::isTimingEnabled() noexcept {
+    return g_timingEnabled.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,200 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "LatencyHistogram.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @file Metrics.h
+ * @brief Low-overhead operational metrics with Prometheus text export.
+ *
+ * Counters and histograms are sharded: every thread writes to its own
+ * cache-line-aligned slot with a relaxed atomic add (a few nanoseconds,
+ * no sharing between threads), and the shards are only summed when the
+ * registry is scraped.  Gauges are a single atomic.
+ *
+ * The kernel records into KernelMetrics (sessions, rounds, results,
+ * active games and, when timing is enabled, round latency).  Export
+ * with MetricsRegistry::renderPrometheus(), writeToFile(), or the
+ * MetricsHttpServer.
+ *
+ * @par Design Patterns
+ * - **Registry** – metrics are created once and looked up by reference.
+ * - **Singleton (light)** – MetricsRegistry::global() for the kernel.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – recording vs. exposition are separate.
+ */
+
+/// @brief Number of per-thread shards in counters and histograms.
+constexpr std::size_t METRIC_SHARDS = 16;
+
+/**
+ * @brief Returns the calling thread's shard index (0..METRIC_SHARDS-1).
+ */
+std::size_t metricShard() noexcept;
+
+/**
+ * @class MetricCounter
+ * @brief Monotonic counter, sharded per thread.
+ */
+class MetricCounter {
+public:
+    /** @brief Adds @p n to the counter. */
+    void inc(std::uint64_t n = 1) noexcept {
+        shards_[metricShard()].value.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    /** @brief Returns the sum over all shards. */
+    std::uint64_t value() const noexcept;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<std::uint64_t> value{0};
+    };
+    std::array<Shard, METRIC_SHARDS> shards_;
+};
+
+/**
+ * @class MetricGauge
+ * @brief Value that can go up and down.
+ */
+class MetricGauge {
+public:
+    void add(std::int64_t n) noexcept { value_.fetch_add(n, std::memory_order_relaxed); }
+    void set(std::int64_t v) noexcept { value_.store(v, std::memory_order_relaxed); }
+    std::int64_t value() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::int64_t> value_{0};
+};
+
+/**
+ * @class MetricHistogram
+ * @brief Sharded log-linear histogram (same buckets as LatencyHistogram).
+ */
+class MetricHistogram {
+public:
+    /** @brief Records one observation. */
+    void record(std::uint64_t value) noexcept {
+        Shard& s = (*shards_)[metricShard()];
+        s.buckets[LatencyHistogram::bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        s.sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /** @brief Merges all shards into a plain snapshot. */
+    struct Snapshot {
+        std::vector<std::uint64_t> buckets; ///< LatencyHistogram::BUCKETS counts.
+        std::uint64_t count = 0;
+        std::uint64_t sum = 0;
+
+        /** @brief Upper bucket bound of quantile @p q (0 if empty). */
+        std::uint64_t quantile(double q) const;
+    };
+
+    /** @brief Returns the merged distribution. */
+    Snapshot snapshot() const;
+
+private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<std::uint64_t>, LatencyHistogram::BUCKETS> buckets{};
+        std::atomic<std::uint64_t> sum{0};
+    };
+    // ~125 KB, so it lives on the heap.
+    std::unique_ptr<std::array<Shard, METRIC_SHARDS>> shards_ =
+        std::make_unique<std::array<Shard, METRIC_SHARDS>>();
+};
+
+/**
+ * @class MetricsRegistry
+ * @brief Owns named metrics and renders them for scraping.
+ */
+class MetricsRegistry {
+public:
+    /** @brief The process-wide registry used by the kernel. */
+    static MetricsRegistry& global();
+
+    /**
+     * @brief Registers (or returns the existing) counter.
+     * @param name   Metric family name, e.g. "rsp_rounds_total".
+     * @param help   One-line description.
+     * @param labels Prometheus label set without braces, e.g. result="draw".
+     */
+    MetricCounter& counter(const std::string& name, const std::string& help,
+                           const std::string& labels = "");
+
+    /** @brief Registers (or returns the existing) gauge. */
+    MetricGauge& gauge(const std::string& name, const std::string& help,
+                       const std::string& labels = "");
+
+    /**
+     * @brief Registers (or returns the existing) histogram, exported as a
+     *        Prometheus summary with quantiles, _sum and _count.
+     */
+    MetricHistogram& histogram(const std::string& name, const std::string& help,
+                               const std::string& labels = "");
+
+    /** @brief Renders every metric in Prometheus text format 0.0.4. */
+    std::string renderPrometheus() const;
+
+    /**
+     * @brief Writes renderPrometheus() to @p path atomically (temp file
+     *        + rename), e.g. for the node-exporter textfile collector.
+     * @return false on I/O failure.
+     */
+    bool writeToFile(const std::string& path) const;
+
+private:
+    enum class Kind { Counter, Gauge, Histogram };
+
+    struct Entry {
+        Kind kind;
+        std::string name;
+        std::string help;
+        std::string labels;
+        std::unique_ptr<MetricCounter> counter;
+        std::unique_ptr<MetricGauge> gauge;
+        std::unique_ptr<MetricHistogram> histogram;
+    };
+
+    Entry& findOrAdd(Kind kind, const std::string& name, const std::string& help,
+                     const std::string& labels);
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Entry>> entries_;
+};
+
+/**
+ * @brief Metrics recorded by Session and Game.
+ */
+struct KernelMetrics {
+    MetricCounter&   sessionsStarted;  ///< Sessions whose first round began.
+    MetricCounter&   sessionsFinished; ///< Sessions that played all rounds.
+    MetricCounter&   rounds;           ///< Rounds played.
+    MetricCounter&   userWins;         ///< Rounds won by the user side.
+    MetricCounter&   computerWins;     ///< Rounds won by the computer side.
+    MetricCounter&   draws;            ///< Drawn rounds.
+    MetricGauge&     activeGames;      ///< Games currently Running.
+    MetricHistogram& roundLatency;     ///< Round wall time (ns), if timing on.
+
+    /** @brief Returns the kernel metrics in MetricsRegistry::global(). */
+    static KernelMetrics& get();
+
+    /**
+     * @brief Enables round-latency timing (two clock reads per round).
+     *        Counters are always recorded.
+     */
+    static void setTimingEnabled(bool enabled) noexcept;
+
+    /** @brief Returns true when round-latency timing is enabled. */
+    static bool isTimingEnabled() noexcept;
+};
+
+#endif // METRICS_H
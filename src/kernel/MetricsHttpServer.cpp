@@ -0,0 +1,138 @@
+#include "kernel/MetricsHttpServer.h"
+#include <string>
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace {
+#if defined(MSG_NOSIGNAL)
+    constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    constexpr int SEND_FLAGS = 0; // SO_NOSIGPIPE is set on each client instead
+#endif
+}
+#endif
+
+namespace {
+    /// A scraper that does not send its request (or read the reply)
+    /// within this time is dropped, so it cannot stall the serve loop.
+    constexpr int CLIENT_TIMEOUT_MS = 500;
+}
+
+MetricsHttpServer::MetricsHttpServer(const MetricsRegistry& registry)
+    : registry_(registry)
+    , running_(false)
+    , listenFd_(-1)
+    , port_(0)
+{}
+
+MetricsHttpServer::~MetricsHttpServer() {
+    stop();
+}
+
+std::uint16_t MetricsHttpServer::getPort() const {
+    return port_;
+}
+
+#if defined(_WIN32)
+
+bool MetricsHttpServer::start(std::uint16_t) { return false; }
+void MetricsHttpServer::stop() {}
+void MetricsHttpServer::serve() {}
+
+#else
+
+bool MetricsHttpServer::start(std::uint16_t port) {
+    if (running_) return false;
+
+    const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return false;
+    const int yes = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    socklen_t len = sizeof(addr);
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(fd, 16) != 0 ||
+        ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    listenFd_ = fd;
+    port_ = ntohs(addr.sin_port);
+    running_ = true;
+    thread_ = std::thread(&MetricsHttpServer::serve, this);
+    return true;
+}
+
+void MetricsHttpServer::stop() {
+    if (!running_.exchange(false)) return;
+    if (thread_.joinable()) thread_.join();
+    ::close(listenFd_);
+    listenFd_ = -1;
+    port_ = 0;
+}
+
+void MetricsHttpServer::serve() {
+    while (running_) {
+        // Wake up periodically to notice stop().
+        pollfd pfd{listenFd_, POLLIN, 0};
+        if (::poll(&pfd, 1, 100) <= 0) continue;
+
+        const int client = ::accept(listenFd_, nullptr, nullptr);
+        if (client < 0) continue;
+
+        pollfd cfd{client, POLLIN, 0};
+        if (::poll(&cfd, 1, CLIENT_TIMEOUT_MS) <= 0) {
+            ::close(client); // silent client
+            continue;
+        }
+        timeval sendTimeout{0, CLIENT_TIMEOUT_MS * 1000};
+        ::setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+#if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+        const int one = 1;
+        ::setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+
+        char buf[1024];
+        const ssize_t n = ::recv(client, buf, sizeof(buf) - 1, MSG_DONTWAIT);
+        const std::string request(buf, n > 0 ? static_cast<std::size_t>(n) : 0);
+
+        std::string status = "404 Not Found";
+        std::string body = "not found\n";
+        if (request.compare(0, 13, "GET /metrics ") == 0 ||
+            request.compare(0, 13, "GET /metrics?") == 0) {
+            status = "200 OK";
+            body = registry_.renderPrometheus();
+        }
+        const std::string response =
+            "HTTP/1.1 " + status + "\r\n"
+            "Content-Type: text/plain; version=0.0.4\r\n"
+            "Content-Length: " + std::to_string(body.size()) + "\r\n"
+            "Connection: close\r\n\r\n" + body;
+
+        // A scraper that hangs up early (EPIPE / ECONNRESET) is just
+        // dropped; it must not raise SIGPIPE in the host process.
+        std::size_t sent = 0;
+        while (sent < response.size()) {
+            const ssize_t w = ::send(client, response.data() + sent, response.size() - sent,
+                                     SEND_FLAGS);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) break;
+            sent += static_cast<std::size_t>(w);
+        }
+        ::close(client);
+    }
+}
+
+#endif
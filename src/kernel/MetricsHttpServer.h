@@ -0,0 +1,63 @@
+#ifndef METRICS_HTTP_SERVER_H
+#define METRICS_HTTP_SERVER_H
+
+#include "Metrics.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+/**
+ * @file MetricsHttpServer.h
+ * @brief Minimal loopback HTTP endpoint serving `GET /metrics`.
+ *
+ * Runs one background thread that accepts connections on 127.0.0.1,
+ * answers `/metrics` with MetricsRegistry::renderPrometheus() and
+ * anything else with 404.  Scrapes are rare, so a blocking,
+ * one-connection-at-a-time loop is sufficient and keeps the kernel free
+ * of an HTTP dependency.
+ *
+ * Implemented with POSIX sockets; on other platforms start() returns
+ * false (use MetricsRegistry::writeToFile() instead).
+ *
+ * @par SOLID
+ * - **Single Responsibility** – transport only; content comes from the
+ *   registry.
+ */
+class MetricsHttpServer {
+public:
+    /**
+     * @brief Creates a server for @p registry (not started).
+     * @param registry Registry to expose; must outlive the server.
+     */
+    explicit MetricsHttpServer(const MetricsRegistry& registry = MetricsRegistry::global());
+
+    /** @brief Stops the server if running. */
+    ~MetricsHttpServer();
+
+    MetricsHttpServer(const MetricsHttpServer&) = delete;
+    MetricsHttpServer& operator=(const MetricsHttpServer&) = delete;
+
+    /**
+     * @brief Binds 127.0.0.1:@p port and starts serving.
+     * @param port TCP port; 0 picks a free one (see getPort()).
+     * @return false if already running or the socket could not be bound.
+     */
+    bool start(std::uint16_t port = 0);
+
+    /** @brief Stops serving and joins the background thread. */
+    void stop();
+
+    /** @brief Returns the bound port (0 if not running). */
+    std::uint16_t getPort() const;
+
+private:
+    void serve();
+
+    const MetricsRegistry& registry_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    int listenFd_;
+    std::uint16_t port_;
+};
+
+#endif // METRICS_HTTP_SERVER_H
@@ -3,6 +3,7 @@
 
 #include "Hand.h"
 #include <string>
+#include <string_view>
 
 /**
  * @file Move.h
@@ -31,11 +32,11 @@ enum class MoveResult {
 };
 
 /**
- * @brief Converts a MoveResult to a human-readable string.
- * @param result The result to convert.
- * @return "User Wins", "Computer Wins", or "Draw".
+ * @brief Returns the human-readable label of a MoveResult.
+ * @param result The result to label.
+ * @return "User Wins", "Computer Wins", or "Draw" (static storage).
  */
-inline std::string moveResultToString(MoveResult result) {
+constexpr std::string_view moveResultLabel(MoveResult result) {
     switch (result) {
         case MoveResult::UserWins:     return "User Wins";
         case MoveResult::ComputerWins: return "Computer Wins";
@@ -44,6 +45,16 @@ inline std::string moveResultToString(MoveResult result) {
     return "Unknown";
 }
 
+/**
+ * @brief Converts a MoveResult to a human-readable string.
+ * @param result The result to convert.
+ * @return "User Wins", "Computer Wins", or "Draw".
+ * @note Compatibility wrapper; prefer moveResultLabel().
+ */
+inline std::string moveResultToString(MoveResult result) {
+    return std::string(moveResultLabel(result));
+}
+
 /**
  * @class Move
  * @brief One round of the game – two hands and a result.
@@ -0,0 +1,149 @@
+#include "kernel/MoveHistory.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    /// A round packed into one nibble: user * 3 + computer (0..8).
+    std::uint8_t packRound(const Move& m) {
+        return static_cast<std::uint8_t>(
+            static_cast<int>(m.getUserHand().getCombination()) * 3 +
+            static_cast<int>(m.getComputerHand().getCombination()));
+    }
+
+    Move unpackRound(std::uint8_t code) {
+        return Move(Hand(static_cast<Combination>(code / 3)),
+                    Hand(static_cast<Combination>(code % 3)));
+    }
+
+    bool seekTo(std::FILE* f, std::uint64_t offset) {
+#if defined(_WIN32)
+        return _fseeki64(f, static_cast<long long>(offset), SEEK_SET) == 0;
+#else
+        return fseeko(f, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    }
+}
+
+void MoveHistory::FileCloser::operator()(std::FILE* f) const {
+    std::fclose(f);
+}
+
+MoveHistory::MoveHistory(std::size_t memoryLimit, std::string spillPath)
+    : memoryLimit_(std::max<std::size_t>(memoryLimit, 2))
+    , segmentRounds_(memoryLimit_ / 2)
+    , spillPath_(std::move(spillPath))
+{}
+
+MoveHistory::~MoveHistory() {
+    if (file_ && !spillPath_.empty()) {
+        file_.reset();
+        std::remove(spillPath_.c_str());
+    }
+}
+
+void MoveHistory::reserve(std::size_t rounds) {
+    recent_.reserve(std::min(rounds, memoryLimit_));
+}
+
+void MoveHistory::push_back(const Move& move) {
+    if (recent_.size() >= memoryLimit_) {
+        spillSegment();
+    }
+    recent_.push_back(move);
+}
+
+void MoveHistory::spillSegment() {
+    if (!file_) {
+        std::FILE* f = spillPath_.empty() ? std::tmpfile()
+                                          : std::fopen(spillPath_.c_str(), "w+b");
+        if (!f) {
+            throw std::runtime_error("MoveHistory: cannot create spill file");
+        }
+        file_.reset(f);
+    }
+
+    const std::size_t segmentBytes = (segmentRounds_ + 1) / 2;
+    std::vector<std::uint8_t> packed(segmentBytes, 0);
+    for (std::size_t i = 0; i < segmentRounds_; ++i) {
+        packed[i / 2] |= static_cast<std::uint8_t>(packRound(recent_[i]) << ((i % 2) * 4));
+    }
+
+    const std::uint64_t segment = spilled_ / segmentRounds_;
+    if (!seekTo(file_.get(), segment * segmentBytes) ||
+        std::fwrite(packed.data(), 1, segmentBytes, file_.get()) != segmentBytes ||
+        std::fflush(file_.get()) != 0) {
+        throw std::runtime_error("MoveHistory: cannot write spill file");
+    }
+
+    recent_.erase(recent_.begin(), recent_.begin() + static_cast<std::ptrdiff_t>(segmentRounds_));
+    spilled_ += segmentRounds_;
+}
+
+Move MoveHistory::loadSpilled(std::uint64_t index) const {
+    const std::uint64_t segment = index / segmentRounds_;
+    const std::size_t offset = static_cast<std::size_t>(index % segmentRounds_);
+    if (segment != cachedSegment_) {
+        const std::size_t segmentBytes = (segmentRounds_ + 1) / 2;
+        cache_.resize(segmentBytes);
+        if (!seekTo(file_.get(), segment * segmentBytes) ||
+            std::fread(cache_.data(), 1, segmentBytes, file_.get()) != segmentBytes) {
+            cachedSegment_ = UINT64_MAX;
+            throw std::runtime_error("MoveHistory: cannot read spill file");
+        }
+        cachedSegment_ = segment;
+    }
+    return unpackRound(static_cast<std::uint8_t>((cache_[offset / 2] >> ((offset % 2) * 4)) & 0x0F));
+}
+
+std::uint64_t MoveHistory::size() const {
+    return spilled_ + recent_.size();
+}
+
+bool MoveHistory::empty() const {
+    return size() == 0;
+}
+
+Move MoveHistory::operator[](std::uint64_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("MoveHistory: round index out of range");
+    }
+    if (index < spilled_) {
+        return loadSpilled(index);
+    }
+    return recent_[static_cast<std::size_t>(index - spilled_)];
+}
+
+Move MoveHistory::at(std::uint64_t index) const {
+    return (*this)[index];
+}
+
+Move MoveHistory::back() const {
+    if (empty()) {
+        throw std::out_of_range("MoveHistory: empty history");
+    }
+    return recent_.back();
+}
+
+MoveHistory::const_iterator MoveHistory::begin() const {
+    return const_iterator(this, 0);
+}
+
+MoveHistory::const_iterator MoveHistory::end() const {
+    return const_iterator(this, size());
+}
+
+std::size_t MoveHistory::getInMemoryCount() const {
+    return recent_.size();
+}
+
+std::uint64_t MoveHistory::getSpilledCount() const {
+    return spilled_;
+}
+
+std::size_t MoveHistory::getSegmentRounds() const {
+    return segmentRounds_;
+}
+
+std::size_t MoveHistory::getMemoryLimit() const {
+    return memoryLimit_;
+}
@@ -0,0 +1,149 @@
+#ifndef MOVE_HISTORY_H
+#define MOVE_HISTORY_H
+
+#include "Move.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @file MoveHistory.h
+ * @brief Append-only round history that spills old rounds to disk.
+ *
+ * A session of billions of rounds cannot keep every Move in RAM.  The
+ * history keeps at most @c memoryLimit recent rounds in memory; when the
+ * limit is reached, the oldest half is packed (4 bits per round: the
+ * pair of gestures) into a fixed-size segment and appended to a spill
+ * file.  Indexing an old round pages its segment back in; the last
+ * segment read stays cached, so sequential scans read each segment once.
+ *
+ * With the default limit (unlimited) nothing is ever written to disk and
+ * the history behaves like the std::vector<Move> it replaces.
+ *
+ * Not thread-safe: like Session's other getters, for the game thread.
+ *
+ * @par Design Patterns
+ * - **Proxy** – old rounds are materialised lazily on access.
+ * - **Iterator** – const_iterator walks memory and disk uniformly.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – storage of played rounds only.
+ */
+class MoveHistory {
+public:
+    /** @brief memoryLimit value that disables spilling. */
+    static constexpr std::size_t UNLIMITED = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Input iterator yielding Moves by value.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Move;
+        using difference_type   = std::int64_t;
+        using pointer           = void;
+        using reference         = Move;
+
+        const_iterator(const MoveHistory* history, std::uint64_t index)
+            : history_(history), index_(index) {}
+
+        Move operator*() const { return (*history_)[index_]; }
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++index_; return old; }
+        bool operator==(const const_iterator& o) const { return index_ == o.index_; }
+        bool operator!=(const const_iterator& o) const { return index_ != o.index_; }
+
+    private:
+        const MoveHistory* history_;
+        std::uint64_t index_;
+    };
+
+    /**
+     * @brief Creates an empty history.
+     * @param memoryLimit Rounds kept in RAM before spilling (minimum 2).
+     * @param spillPath   Spill file, created on first spill and removed
+     *                    on destruction; empty for an anonymous temp file.
+     */
+    explicit MoveHistory(std::size_t memoryLimit = UNLIMITED, std::string spillPath = {});
+
+    ~MoveHistory();
+
+    MoveHistory(const MoveHistory&) = delete;
+    MoveHistory& operator=(const MoveHistory&) = delete;
+
+    /**
+     * @brief Pre-allocates room for @p rounds in-memory rounds (capped
+     *        by the memory limit).
+     */
+    void reserve(std::size_t rounds);
+
+    /**
+     * @brief Appends a round, spilling the oldest rounds if needed.
+     * @throws std::runtime_error if the spill file cannot be written.
+     */
+    void push_back(const Move& move);
+
+    /** @brief Returns the total number of rounds recorded. */
+    std::uint64_t size() const;
+
+    /** @brief Returns true if no round has been recorded. */
+    bool empty() const;
+
+    /**
+     * @brief Returns round @p index (0-based), paging it in if spilled.
+     * @throws std::out_of_range if @p index >= size().
+     * @throws std::runtime_error if the spill file cannot be read.
+     */
+    Move operator[](std::uint64_t index) const;
+
+    /** @brief Same as operator[]. */
+    Move at(std::uint64_t index) const;
+
+    /** @brief Returns the most recent round. @throws std::out_of_range if empty. */
+    Move back() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /** @brief Returns the number of rounds currently held in RAM. */
+    std::size_t getInMemoryCount() const;
+
+    /** @brief Returns the number of rounds stored in the spill file. */
+    std::uint64_t getSpilledCount() const;
+
+    /** @brief Returns the number of rounds per on-disk segment. */
+    std::size_t getSegmentRounds() const;
+
+    /** @brief Returns the configured memory limit. */
+    std::size_t getMemoryLimit() const;
+
+private:
+    struct FileCloser {
+        void operator()(std::FILE* f) const;
+    };
+
+    /// Packs the oldest segment of recent_ and appends it to the file.
+    void spillSegment();
+
+    /// Decodes round @p index (< spilled_) from its segment.
+    Move loadSpilled(std::uint64_t index) const;
+
+    std::size_t memoryLimit_;
+    std::size_t segmentRounds_;   ///< Rounds per segment (memoryLimit_ / 2).
+    std::string spillPath_;
+
+    std::vector<Move> recent_;    ///< Rounds [spilled_, size()).
+    std::uint64_t spilled_ = 0;   ///< Rounds [0, spilled_) are on disk.
+    std::unique_ptr<std::FILE, FileCloser> file_;
+
+    mutable std::vector<std::uint8_t> cache_;         ///< Packed segment.
+    mutable std::uint64_t cachedSegment_ = UINT64_MAX; ///< Its index.
+};
+
+#endif // MOVE_HISTORY_H
@@ -0,0 +1,88 @@
+#include "kernel/MultiMove.h"
+#include <stdexcept>
+
+MultiMove::MultiMove(std::vector<Hand> hands, std::vector<std::size_t> seats)
+    : hands_(std::move(hands))
+    , seats_(std::move(seats))
+{
+    if (!seats_.empty() && seats_.size() != hands_.size()) {
+        throw std::invalid_argument("MultiMove: seats and hands differ in size");
+    }
+    for (const Hand& h : hands_) {
+        ++counts_[static_cast<std::size_t>(h.getCombination())];
+    }
+    judge();
+}
+
+void MultiMove::clear() {
+    hands_.clear();
+    seats_.clear();
+    counts_ = {};
+    draw_ = true;
+}
+
+void MultiMove::add(Hand hand, std::size_t seat) {
+    // Materialise an identity mapping before mixing in explicit seats.
+    for (std::size_t i = seats_.size(); i < hands_.size(); ++i) {
+        seats_.push_back(i);
+    }
+    hands_.push_back(hand);
+    seats_.push_back(seat);
+    ++counts_[static_cast<std::size_t>(hand.getCombination())];
+    judge();
+}
+
+void MultiMove::judge() {
+    // Exactly two gestures present: the one that beats the other wins.
+    const bool rock     = counts_[static_cast<std::size_t>(Combination::Rock)] > 0;
+    const bool scissors = counts_[static_cast<std::size_t>(Combination::Scissors)] > 0;
+    const bool paper    = counts_[static_cast<std::size_t>(Combination::Paper)] > 0;
+    draw_ = rock + scissors + paper != 2;
+    if (!draw_) {
+        if (!paper)         winner_ = Combination::Rock;
+        else if (!rock)     winner_ = Combination::Scissors;
+        else                winner_ = Combination::Paper;
+    }
+}
+
+bool MultiMove::isDraw() const {
+    return draw_;
+}
+
+Combination MultiMove::getWinningCombination() const {
+    if (draw_) {
+        throw std::logic_error("MultiMove: a drawn round has no winner");
+    }
+    return winner_;
+}
+
+bool MultiMove::isWinner(std::size_t i) const {
+    return !draw_ && hands_.at(i).getCombination() == winner_;
+}
+
+int MultiMove::getWinnerCount() const {
+    return draw_ ? 0 : counts_[static_cast<std::size_t>(winner_)];
+}
+
+int MultiMove::getCount(Combination c) const {
+    return counts_[static_cast<std::size_t>(c)];
+}
+
+std::size_t MultiMove::getParticipantCount() const {
+    return hands_.size();
+}
+
+Hand MultiMove::getHand(std::size_t i) const {
+    return hands_.at(i);
+}
+
+std::size_t MultiMove::getSeat(std::size_t i) const {
+    if (i >= hands_.size()) {
+        throw std::out_of_range("MultiMove: participant index out of range");
+    }
+    return seats_.empty() ? i : seats_[i];
+}
+
+const std::vector<Hand>& MultiMove::getHands() const {
+    return hands_;
+}
@@ -0,0 +1,88 @@
+#ifndef MULTI_MOVE_H
+#define MULTI_MOVE_H
+
+#include "Hand.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @file MultiMove.h
+ * @brief One free-for-all round: any number of Hands thrown at once.
+ *
+ * With N players the outcome does not need N² pairwise comparisons:
+ * only the set of gestures present matters.  If exactly two gestures
+ * were thrown, everyone holding the one that beats the other wins and
+ * the rest lose; if one or all three were thrown, the round is a draw.
+ * A single pass counting gestures decides the round in O(N).
+ *
+ * @par Design Patterns
+ * - **Value Object** – judged from its hands; clear() and add() refill
+ *   one instance in place so a session can reuse its buffers.
+ * - **Information Expert** – the round knows how to judge itself.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – outcome logic for one N-player round.
+ */
+class MultiMove {
+public:
+    /**
+     * @brief Constructs and evaluates a round.
+     * @param hands The hands thrown, one per participant.
+     * @param seats Optional player index of each participant (same size
+     *              as @p hands); when empty, participant i is seat i.
+     * @throws std::invalid_argument if @p seats is non-empty and its
+     *         size differs from @p hands.
+     */
+    explicit MultiMove(std::vector<Hand> hands, std::vector<std::size_t> seats = {});
+
+    /** @brief Constructs an empty round (a draw with no participants). */
+    MultiMove() = default;
+
+    /** @brief Removes every participant, keeping the buffers' capacity. */
+    void clear();
+
+    /** @brief Adds a participant throwing @p hand from seat @p seat. */
+    void add(Hand hand, std::size_t seat);
+
+    /** @brief Returns true if nobody won (one or all three gestures thrown). */
+    bool isDraw() const;
+
+    /**
+     * @brief Returns the gesture that won the round.
+     * @throws std::logic_error if the round is a draw.
+     */
+    Combination getWinningCombination() const;
+
+    /** @brief Returns true if participant @p i threw the winning gesture. */
+    bool isWinner(std::size_t i) const;
+
+    /** @brief Returns how many participants won (0 for a draw). */
+    int getWinnerCount() const;
+
+    /** @brief Returns how many participants threw @p c. */
+    int getCount(Combination c) const;
+
+    /** @brief Returns the number of participants. */
+    std::size_t getParticipantCount() const;
+
+    /** @brief Returns the hand of participant @p i. */
+    Hand getHand(std::size_t i) const;
+
+    /** @brief Returns the player index (seat) of participant @p i. */
+    std::size_t getSeat(std::size_t i) const;
+
+    /** @brief Returns all hands, in participant order. */
+    const std::vector<Hand>& getHands() const;
+
+private:
+    void judge();
+
+    std::vector<Hand> hands_;
+    std::vector<std::size_t> seats_;  ///< Empty: identity mapping.
+    std::array<int, 3> counts_{};     ///< Participants per Combination.
+    bool draw_ = true;
+    Combination winner_ = Combination::Rock; ///< Valid when !draw_.
+};
+
+#endif // MULTI_MOVE_H
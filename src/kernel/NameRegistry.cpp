@@ -0,0 +1,33 @@
+#include "kernel/NameRegistry.h"
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace {
+    std::atomic<NameRegistry::InternFn> g_host{nullptr};
+}
+
+std::string_view NameRegistry::intern(std::string_view name) {
+    if (const InternFn host = g_host.load(std::memory_order_acquire)) {
+        return host(name);
+    }
+
+    // Node-based container: element addresses never move, and
+    // std::less<> allows lookup by string_view without a temporary.
+    static std::mutex mutex;
+    static std::set<std::string, std::less<>> names;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = names.find(name);
+    if (it == names.end()) {
+        it = names.emplace(name).first;
+    }
+    return *it;
+}
+
+void NameRegistry::forwardTo(InternFn host) {
+    if (host != &NameRegistry::intern) { // a shared copy must not forward to itself
+        g_host.store(host, std::memory_order_release);
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef NAME_REGISTRY_H
+#define NAME_REGISTRY_H
+
+#include <string_view>
+
+/**
+ * @file NameRegistry.h
+ * @brief Process-wide interning of player names.
+ *
+ * Names are stored once and handed out as std::string_view.  The views
+ * stay valid for the lifetime of the process, and nothing is ever freed,
+ * so intern only a bounded set of names (strategy labels, not user
+ * names); players own their names and hand out views (IPlayer).
+ *
+ * @par Design Patterns
+ * - **Flyweight** – one shared copy per distinct name.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – owns name storage only.
+ */
+class NameRegistry {
+public:
+    /**
+     * @brief Returns the interned copy of @p name, storing it if new.
+     * @param name The name to intern.
+     * @return A view that remains valid until the process exits.
+     *
+     * Thread-safe.  Only the first call for a given name allocates.
+     */
+    static std::string_view intern(std::string_view name);
+
+    /// Signature of intern(), as handed to plugins.
+    using InternFn = std::string_view (*)(std::string_view);
+
+    /**
+     * @brief Routes this copy's intern() calls to @p host.
+     *
+     * A strategy plugin embeds its own copy of the kernel, and names
+     * interned there would vanish when the plugin is unloaded.
+     * PluginLoader points the plugin's copy at the host registry instead.
+     */
+    static void forwardTo(InternFn host);
+};
+
+#endif // NAME_REGISTRY_H
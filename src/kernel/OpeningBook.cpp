@@ -0,0 +1,195 @@
+#include "kernel/OpeningBook.h"
+#include "kernel/FileReplace.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr char MAGIC[8] = {'R', 'S', 'P', 'B', 'O', 'O', 'K', '1'};
+    constexpr std::uint32_t VERSION = 1;
+
+    /// File header, padded so the node array starts on a cache line.
+    struct BookHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t nodeCount;
+        std::uint32_t maxDepth;
+        std::uint8_t reserved[44];
+    };
+    static_assert(sizeof(BookHeader) == 64, "BookHeader is 64 bytes");
+
+    /// Validates @p size bytes at @p data; returns the header or nullptr.
+    const BookHeader* checkHeader(const void* data, std::size_t size) {
+        if (size < sizeof(BookHeader)) return nullptr;
+        const auto* h = static_cast<const BookHeader*>(data);
+        if (std::memcmp(h->magic, MAGIC, sizeof MAGIC) != 0 || h->version != VERSION ||
+            (size - sizeof(BookHeader)) / sizeof(BookNode) != h->nodeCount ||
+            (size - sizeof(BookHeader)) % sizeof(BookNode) != 0) {
+            return nullptr;
+        }
+        return h;
+    }
+
+    struct FileCloser {
+        void operator()(std::FILE* f) const { if (f) std::fclose(f); }
+    };
+    using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+}
+
+// ---- OpeningBook ----
+
+std::shared_ptr<const OpeningBook> OpeningBook::open(const std::string& path) {
+    std::shared_ptr<OpeningBook> book(new OpeningBook());
+#if defined(_WIN32)
+    FilePtr file(std::fopen(path.c_str(), "rb"));
+    if (!file || std::fseek(file.get(), 0, SEEK_END) != 0) return nullptr;
+    const long size = std::ftell(file.get());
+    if (size < 0 || std::fseek(file.get(), 0, SEEK_SET) != 0) return nullptr;
+    book->buffer_.resize((static_cast<std::size_t>(size) + 7) / 8);
+    if (std::fread(book->buffer_.data(), 1, static_cast<std::size_t>(size), file.get()) !=
+        static_cast<std::size_t>(size)) {
+        return nullptr;
+    }
+    const void* data = book->buffer_.data();
+    const std::size_t bytes = static_cast<std::size_t>(size);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return nullptr;
+    struct stat st;
+    void* mem = MAP_FAILED;
+    if (::fstat(fd, &st) == 0 && st.st_size >= static_cast<off_t>(sizeof(BookHeader))) {
+        mem = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (mem == MAP_FAILED) return nullptr;
+    book->mapping_ = mem;
+    book->mappingSize_ = static_cast<std::size_t>(st.st_size);
+    ::madvise(mem, book->mappingSize_, MADV_RANDOM); // a walk touches one line per level
+    const void* data = mem;
+    const std::size_t bytes = book->mappingSize_;
+#endif
+    const BookHeader* header = checkHeader(data, bytes);
+    if (!header) return nullptr;
+    book->nodes_ = reinterpret_cast<const BookNode*>(static_cast<const char*>(data) + sizeof(BookHeader));
+    book->count_ = header->nodeCount;
+    book->maxDepth_ = header->maxDepth;
+    return book;
+}
+
+OpeningBook::~OpeningBook() {
+#if !defined(_WIN32)
+    if (mapping_) ::munmap(mapping_, mappingSize_);
+#endif
+}
+
+// ---- OpeningBookBuilder ----
+
+OpeningBookBuilder::OpeningBookBuilder(std::size_t maxDepth)
+    : maxDepth_(maxDepth)
+    , nodes_(1) // the root
+{}
+
+void OpeningBookBuilder::add(const Combination* prefix, std::size_t length,
+                             Combination response, std::uint32_t weight) {
+    if (length > maxDepth_) {
+        throw std::invalid_argument("OpeningBookBuilder::add: prefix longer than maxDepth");
+    }
+    std::uint32_t node = 0;
+    for (std::size_t i = 0; i < length; ++i) {
+        const auto g = static_cast<std::size_t>(prefix[i]);
+        if (!nodes_[node].child[g]) {
+            nodes_[node].child[g] = static_cast<std::uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+        node = nodes_[node].child[g];
+    }
+    nodes_[node].responses[static_cast<std::size_t>(response)] += weight;
+}
+
+void OpeningBookBuilder::addSession(const Move* moves, std::size_t count) {
+    std::uint32_t node = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Combination user = moves[i].getUserHand().getCombination();
+        ++nodes_[node].responses[static_cast<std::size_t>(counterTo(user))];
+        if (i == maxDepth_) break;
+        const auto g = static_cast<std::size_t>(user);
+        if (!nodes_[node].child[g]) {
+            nodes_[node].child[g] = static_cast<std::uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+        node = nodes_[node].child[g];
+    }
+}
+
+std::size_t OpeningBookBuilder::getNodeCount() const {
+    return nodes_.size();
+}
+
+bool OpeningBookBuilder::write(const std::string& path) const {
+    // Breadth-first order puts every node's children next to each other.
+    std::vector<std::uint32_t> order{0};
+    std::vector<std::uint32_t> depth{0};
+    std::vector<std::uint32_t> position(nodes_.size(), 0);
+    std::uint32_t maxDepth = 0;
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        position[order[k]] = static_cast<std::uint32_t>(k);
+        for (std::uint32_t c : nodes_[order[k]].child) {
+            if (!c) continue;
+            order.push_back(c);
+            depth.push_back(depth[k] + 1);
+            maxDepth = std::max(maxDepth, depth[k] + 1);
+        }
+    }
+
+    std::vector<BookNode> out(order.size());
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        const Node& in = nodes_[order[k]];
+        BookNode& n = out[k];
+        std::memset(&n, 0, sizeof n);
+        for (unsigned g = 0; g < 3; ++g) {
+            if (!in.child[g]) continue;
+            if (!n.childMask) n.firstChild = position[in.child[g]];
+            n.childMask |= static_cast<std::uint8_t>(1u << g);
+        }
+        const std::uint64_t top = std::max({in.responses[0], in.responses[1], in.responses[2]});
+        const std::uint64_t total = in.responses[0] + in.responses[1] + in.responses[2];
+        n.weight = static_cast<std::uint32_t>(
+            std::min<std::uint64_t>(total, std::numeric_limits<std::uint32_t>::max()));
+        for (unsigned r = 0; r < 3; ++r) {
+            std::uint64_t v = in.responses[r];
+            if (top > 0xFFFF) v = v ? std::max<std::uint64_t>(1, v * 0xFFFF / top) : 0;
+            n.responses[r] = static_cast<std::uint16_t>(v);
+        }
+    }
+
+    BookHeader header;
+    std::memset(&header, 0, sizeof header);
+    std::memcpy(header.magic, MAGIC, sizeof MAGIC);
+    header.version = VERSION;
+    header.nodeCount = static_cast<std::uint32_t>(out.size());
+    header.maxDepth = maxDepth;
+
+    const std::string tmp = path + ".tmp";
+    {
+        FilePtr file(std::fopen(tmp.c_str(), "wb"));
+        if (!file) return false;
+        const bool ok = std::fwrite(&header, sizeof header, 1, file.get()) == 1 &&
+                        std::fwrite(out.data(), sizeof(BookNode), out.size(), file.get()) == out.size() &&
+                        std::fflush(file.get()) == 0;
+        if (!ok) {
+            file.reset();
+            std::remove(tmp.c_str());
+            return false;
+        }
+    }
+    return replaceFile(tmp, path);
+}
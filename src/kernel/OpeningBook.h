@@ -0,0 +1,166 @@
+#ifndef OPENING_BOOK_H
+#define OPENING_BOOK_H
+
+#include "Combination.h"
+#include "Move.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @file OpeningBook.h
+ * @brief Memory-mapped trie of opponent openings and our best responses.
+ *
+ * The book is a trie keyed on the opponent's gestures since the start of
+ * a session.  Every node stores how often each response was the right
+ * one after that prefix.  On disk it is a 64-byte header followed by an
+ * array of 16-byte BookNodes in breadth-first order:
+ * - the children of a node are contiguous and ordered by gesture, so a
+ *   node needs only the index of its first child and a 3-bit child
+ *   mask – child g sits at firstChild + popcount(mask below g);
+ * - four nodes share a cache line and no node straddles one, so each
+ *   step down the trie touches a single line.
+ *
+ * OpeningBook::open() maps the file read-only and only checks the
+ * header, so loading is O(1) regardless of size, and every process that
+ * opens the same book shares its pages through the page cache.  Child
+ * indices are bounds-checked as they are followed, so a corrupt file
+ * ends the walk instead of reading outside the mapping.  Numbers are
+ * stored in host byte order.
+ *
+ * OpeningBookBuilder mines the book from played sessions or explicit
+ * (prefix, response) pairs and writes it atomically.
+ *
+ * On platforms without mmap the file is read into memory instead.
+ *
+ * @par Design Patterns
+ * - **Flyweight** – one mapped book is shared by every OpeningBookAI.
+ * - **Builder** – OpeningBookBuilder assembles and serialises the trie.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – storage and lookup only; move choice
+ *   lives in OpeningBookAI.
+ */
+
+/** @brief One trie node as stored in the file (16 bytes). */
+struct BookNode {
+    std::uint32_t firstChild;   ///< Index of the first child (children are contiguous).
+    std::uint32_t weight;       ///< Observations that reached this node (saturating).
+    std::uint16_t responses[3]; ///< Relative frequency of each response, by Combination.
+    std::uint8_t  childMask;    ///< Bit g set if opponent gesture g has a child.
+    std::uint8_t  reserved;
+};
+
+static_assert(sizeof(BookNode) == 16, "BookNode is a 16-byte file record");
+
+/**
+ * @class OpeningBook
+ * @brief Read-only view of a book file.
+ */
+class OpeningBook {
+public:
+    /// Returned by child() when the book has no continuation.
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    /**
+     * @brief Maps the book at @p path.
+     * @return The book, or nullptr if the file is missing or not a book.
+     */
+    static std::shared_ptr<const OpeningBook> open(const std::string& path);
+
+    ~OpeningBook();
+
+    OpeningBook(const OpeningBook&) = delete;
+    OpeningBook& operator=(const OpeningBook&) = delete;
+
+    /** @brief Returns the root node (the empty prefix), or NONE if empty. */
+    std::uint32_t root() const { return count_ ? 0 : NONE; }
+
+    /**
+     * @brief Returns the child of @p node for opponent gesture @p gesture,
+     *        or NONE if the book stops there.
+     */
+    std::uint32_t child(std::uint32_t node, Combination gesture) const {
+        if (node >= count_) return NONE;
+        const BookNode& n = nodes_[node];
+        const unsigned g = static_cast<unsigned>(gesture);
+        if (g > 2 || !(n.childMask & (1u << g))) return NONE;
+        static constexpr std::uint8_t BELOW[3][8] = { // popcount(mask & ((1 << g) - 1))
+            {0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 1, 0, 1, 0, 1}, {0, 1, 1, 2, 0, 1, 1, 2}};
+        const std::uint64_t index = std::uint64_t{n.firstChild} + BELOW[g][n.childMask & 7];
+        // Breadth-first order: a valid child always comes after its parent.
+        return (index > node && index < count_) ? static_cast<std::uint32_t>(index) : NONE;
+    }
+
+    /** @brief Returns node @p index (must be < getNodeCount()). */
+    const BookNode& node(std::uint32_t index) const { return nodes_[index]; }
+
+    /** @brief Returns the number of nodes. */
+    std::size_t getNodeCount() const { return count_; }
+
+    /** @brief Returns the longest prefix stored. */
+    std::uint32_t getMaxDepth() const { return maxDepth_; }
+
+private:
+    OpeningBook() = default;
+
+    const BookNode* nodes_ = nullptr;
+    std::uint32_t count_ = 0;
+    std::uint32_t maxDepth_ = 0;
+    void* mapping_ = nullptr;            ///< mmap base (POSIX).
+    std::size_t mappingSize_ = 0;
+    std::vector<std::uint64_t> buffer_;  ///< File contents where mmap is unavailable.
+};
+
+/**
+ * @class OpeningBookBuilder
+ * @brief Accumulates openings in memory and writes a book file.
+ */
+class OpeningBookBuilder {
+public:
+    /**
+     * @brief Creates an empty builder.
+     * @param maxDepth Longest opponent prefix kept (deeper data is ignored).
+     */
+    explicit OpeningBookBuilder(std::size_t maxDepth = 8);
+
+    /**
+     * @brief Records that @p response was good after the opponent opened
+     *        with @p prefix.
+     * @param prefix   The opponent's first @p length gestures.
+     * @param length   Prefix length (must not exceed maxDepth).
+     * @param response Our answer to the next opponent gesture.
+     * @param weight   How many times to count it.
+     */
+    void add(const Combination* prefix, std::size_t length, Combination response,
+             std::uint32_t weight = 1);
+
+    /**
+     * @brief Mines one session played from the computer's seat: after
+     *        every user prefix up to maxDepth, the counter to the user's
+     *        next gesture is recorded.
+     */
+    void addSession(const Move* moves, std::size_t count);
+
+    /** @brief Returns the number of trie nodes so far. */
+    std::size_t getNodeCount() const;
+
+    /**
+     * @brief Writes the book to @p path (via a temporary file).
+     * @return false on I/O failure.
+     */
+    bool write(const std::string& path) const;
+
+private:
+    struct Node {
+        std::uint32_t child[3] = {0, 0, 0}; ///< 0 = none (the root is never a child).
+        std::uint64_t responses[3] = {0, 0, 0};
+    };
+
+    std::size_t maxDepth_;
+    std::vector<Node> nodes_;
+};
+
+#endif // OPENING_BOOK_H
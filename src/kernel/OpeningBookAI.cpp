@@ -0,0 +1,83 @@
+#include "kernel/OpeningBookAI.h"
+#include "kernel/ComputerAI.h"
+#include <random>
+
+namespace {
+    std::uint64_t splitMix64(std::uint64_t& state) {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+}
+
+OpeningBookAI::OpeningBookAI(std::shared_ptr<const OpeningBook> book,
+                             std::shared_ptr<IPlayer> fallback,
+                             const std::string& name,
+                             std::uint32_t minWeight,
+                             std::uint64_t seed)
+    : book_(std::move(book))
+    , fallback_(std::move(fallback))
+    , name_(name)
+    , minWeight_(minWeight)
+    , node_(book_ ? book_->root() : OpeningBook::NONE)
+    , rng_(seed ? seed : (std::uint64_t{std::random_device{}()} << 32) ^ std::random_device{}())
+    , bookMoves_(0)
+    , fallbackMoves_(0)
+{
+    if (!fallback_) {
+        fallback_ = std::make_shared<ComputerAI>();
+    }
+}
+
+std::string OpeningBookAI::getName() const {
+    return name_;
+}
+
+std::string_view OpeningBookAI::getNameView() const {
+    return name_;
+}
+
+Hand OpeningBookAI::chooseHand() {
+    if (node_ != OpeningBook::NONE) {
+        const BookNode& n = book_->node(node_);
+        const std::uint32_t total = std::uint32_t{n.responses[0]} + n.responses[1] + n.responses[2];
+        if (total > 0 && n.weight >= minWeight_) {
+            ++bookMoves_;
+            const auto pick = static_cast<std::uint32_t>(splitMix64(rng_) % total);
+            if (pick < n.responses[0]) return Hand(Combination::Rock);
+            if (pick < std::uint32_t{n.responses[0]} + n.responses[1]) return Hand(Combination::Scissors);
+            return Hand(Combination::Paper);
+        }
+    }
+    ++fallbackMoves_;
+    return fallback_->chooseHand();
+}
+
+void OpeningBookAI::observeRound(const Hand& own, const Hand& opponent) {
+    if (node_ != OpeningBook::NONE) {
+        node_ = book_->child(node_, opponent.getCombination());
+    }
+    fallback_->observeRound(own, opponent);
+}
+
+void OpeningBookAI::onSessionStart() {
+    reset();
+    fallback_->onSessionStart();
+}
+
+void OpeningBookAI::reset() {
+    node_ = book_ ? book_->root() : OpeningBook::NONE;
+}
+
+bool OpeningBookAI::isInBook() const {
+    return node_ != OpeningBook::NONE;
+}
+
+std::uint64_t OpeningBookAI::getBookMoves() const {
+    return bookMoves_;
+}
+
+std::uint64_t OpeningBookAI::getFallbackMoves() const {
+    return fallbackMoves_;
+}
@@ -0,0 +1,88 @@
+#ifndef OPENING_BOOK_AI_H
+#define OPENING_BOOK_AI_H
+
+#include "IPlayer.h"
+#include "OpeningBook.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * @file OpeningBookAI.h
+ * @brief Opponent that plays from an OpeningBook, then a fallback.
+ *
+ * The AI keeps its position in the book between rounds: observeRound()
+ * follows one child link for the opponent's gesture, so each move costs
+ * a single node read – one or two cache misses – however deep the
+ * opening.  chooseHand() samples a response in proportion to the
+ * node's frequencies (a mixed strategy is harder to exploit than always
+ * playing the favourite).  Nodes with fewer than @c minWeight
+ * observations, and everything after the book runs out, are handed to
+ * the fallback player, which observes every round so it is ready to
+ * take over.
+ *
+ * Every new Session returns the AI to the root (onSessionStart()).
+ *
+ * @par Design Patterns
+ * - **Strategy** – book-driven hand selection.
+ * - **Decorator (light)** – wraps a fallback IPlayer.
+ *
+ * @par SOLID
+ * - **Liskov Substitution** – drop-in replacement for any IPlayer.
+ * - **Single Responsibility** – lookup lives in OpeningBook.
+ */
+class OpeningBookAI : public IPlayer {
+public:
+    /**
+     * @brief Constructs the AI.
+     * @param book      The (shared) book; may be nullptr to always fall back.
+     * @param fallback  Player used outside the book (default: ComputerAI).
+     * @param name      Display name.
+     * @param minWeight Observations a node needs before it is trusted.
+     * @param seed      Seed for sampling responses (0 = random).
+     */
+    explicit OpeningBookAI(std::shared_ptr<const OpeningBook> book,
+                           std::shared_ptr<IPlayer> fallback = nullptr,
+                           const std::string& name = "OpeningBook",
+                           std::uint32_t minWeight = 1,
+                           std::uint64_t seed = 0);
+
+    /** @copydoc IPlayer::getName */
+    std::string getName() const override;
+
+    /** @copydoc IPlayer::getNameView */
+    std::string_view getNameView() const override;
+
+    /** @copydoc IPlayer::chooseHand */
+    Hand chooseHand() override;
+
+    /** @copydoc IPlayer::observeRound */
+    void observeRound(const Hand& own, const Hand& opponent) override;
+
+    /** @brief Returns to the root and forwards the call to the fallback. */
+    void onSessionStart() override;
+
+    /** @brief Returns to the start of the book. */
+    void reset();
+
+    /** @brief Returns true while the current position is in the book. */
+    bool isInBook() const;
+
+    /** @brief Returns how many moves came from the book. */
+    std::uint64_t getBookMoves() const;
+
+    /** @brief Returns how many moves came from the fallback. */
+    std::uint64_t getFallbackMoves() const;
+
+private:
+    std::shared_ptr<const OpeningBook> book_;
+    std::shared_ptr<IPlayer> fallback_;
+    std::string name_;
+    std::uint32_t minWeight_;
+    std::uint32_t node_;
+    std::uint64_t rng_;
+    std::uint64_t bookMoves_;
+    std::uint64_t fallbackMoves_;
+};
+
+#endif // OPENING_BOOK_AI_H
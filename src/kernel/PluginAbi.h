@@ -0,0 +1,92 @@
+#ifndef PLUGIN_ABI_H
+#define PLUGIN_ABI_H
+
+#include "IPlayer.h"
+#include "NameRegistry.h"
+#include <cstdint>
+
+/**
+ * @file PluginAbi.h
+ * @brief Contract between the kernel and strategy plugins.
+ *
+ * A strategy plugin is a shared object (.so / .dylib / .dll) that
+ * exports one C symbol, @c rsp_plugin_info, returning a static
+ * RspPluginInfo.  The PluginLoader checks the ABI fields before it
+ * calls anything else, hands the plugin the host's name registry
+ * (attachHost) and then creates players through the factory pointers.
+ * Players are destroyed by the plugin that created them.
+ *
+ * Plugin authors only need:
+ * @code
+ *   #include "kernel/PluginAbi.h"
+ *   class MyStrategy : public IPlayer { ... };
+ *   RSP_DEFINE_STRATEGY_PLUGIN(MyStrategy, "my-strategy", "1.0")
+ * @endcode
+ * and link the plugin against @c kernel (see add_strategy_plugin() in
+ * CMakeLists.txt).  Plugins are native code: no scripting layer.
+ *
+ * @par Design Patterns
+ * - **Abstract Factory** – the plugin exports create/destroy functions.
+ *
+ * @par SOLID
+ * - **Open/Closed** – new strategies ship without relinking the host.
+ */
+
+/** @brief Bumped whenever IPlayer or RspPluginInfo changes incompatibly. */
+#define RSP_PLUGIN_ABI_VERSION 3u
+
+/** @brief Compiler ABI tag; plugins must be built with a compatible compiler. */
+#if defined(_MSC_VER)
+#  define RSP_PLUGIN_CXX_ABI static_cast<std::uint32_t>(_MSC_VER / 100)
+#elif defined(__GXX_ABI_VERSION)
+#  define RSP_PLUGIN_CXX_ABI static_cast<std::uint32_t>(__GXX_ABI_VERSION)
+#else
+#  define RSP_PLUGIN_CXX_ABI 0u
+#endif
+
+#if defined(_WIN32)
+#  define RSP_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#  define RSP_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+/** @brief Name of the symbol every plugin exports. */
+#define RSP_PLUGIN_ENTRY_SYMBOL "rsp_plugin_info"
+
+/**
+ * @brief Describes a strategy plugin.  Field order is part of the ABI.
+ */
+struct RspPluginInfo {
+    std::uint32_t abiVersion;  ///< RSP_PLUGIN_ABI_VERSION at build time.
+    std::uint32_t cxxAbi;      ///< RSP_PLUGIN_CXX_ABI at build time.
+    std::uint32_t playerSize;  ///< sizeof(IPlayer) at build time.
+    const char* name;          ///< Strategy name (registry key).
+    const char* version;       ///< Free-form plugin version.
+    IPlayer* (*create)();      ///< Creates a player.
+    void (*destroy)(IPlayer*); ///< Destroys a player made by create().
+    /// Routes the plugin's NameRegistry to the host's, so interned names
+    /// stay valid after the plugin is unloaded.
+    void (*attachHost)(NameRegistry::InternFn hostIntern);
+};
+
+/// Signature of the exported entry point.
+using RspPluginEntry = const RspPluginInfo* (*)();
+
+/**
+ * @brief Defines the plugin entry point for strategy @p Type.
+ * @param Type    An IPlayer subclass with a default constructor.
+ * @param NAME    Strategy name (string literal).
+ * @param VERSION Plugin version (string literal).
+ */
+#define RSP_DEFINE_STRATEGY_PLUGIN(Type, NAME, VERSION)                       \
+    extern "C" RSP_PLUGIN_EXPORT const RspPluginInfo* rsp_plugin_info() {     \
+        static const RspPluginInfo info{                                      \
+            RSP_PLUGIN_ABI_VERSION, RSP_PLUGIN_CXX_ABI,                       \
+            static_cast<std::uint32_t>(sizeof(IPlayer)), NAME, VERSION,       \
+            []() -> IPlayer* { return new Type(); },                          \
+            [](IPlayer* p) { delete p; },                                     \
+            [](NameRegistry::InternFn fn) { NameRegistry::forwardTo(fn); }};  \
+        return &info;                                                         \
+    }
+
+#endif // PLUGIN_ABI_H
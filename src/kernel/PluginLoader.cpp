@@ -0,0 +1,229 @@
+#include "kernel/PluginLoader.h"
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+
+#if defined(_WIN32)
+    void* openLibrary(const fs::path& p) {
+        return reinterpret_cast<void*>(LoadLibraryW(p.wstring().c_str()));
+    }
+    void* findSymbol(void* handle, const char* name) {
+        return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle), name));
+    }
+    void closeLibrary(void* handle) {
+        FreeLibrary(static_cast<HMODULE>(handle));
+    }
+    std::string lastLoadError() {
+        return "LoadLibrary error " + std::to_string(GetLastError());
+    }
+    unsigned long processId() {
+        return static_cast<unsigned long>(GetCurrentProcessId());
+    }
+#else
+    void* openLibrary(const fs::path& p) {
+        return dlopen(p.c_str(), RTLD_NOW | RTLD_LOCAL);
+    }
+    void* findSymbol(void* handle, const char* name) {
+        return dlsym(handle, name);
+    }
+    void closeLibrary(void* handle) {
+        dlclose(handle);
+    }
+    std::string lastLoadError() {
+        const char* e = dlerror();
+        return e ? e : "unknown dlopen error";
+    }
+    unsigned long processId() {
+        return static_cast<unsigned long>(getpid());
+    }
+#endif
+
+    /// A fresh path in the temp directory for a private copy of @p source.
+    fs::path privateCopyPath(const fs::path& source) {
+        static std::atomic<unsigned> counter{0};
+        return fs::temp_directory_path() /
+               ("rsp-plugin-" + std::to_string(processId()) + "-" +
+                std::to_string(counter.fetch_add(1)) + "-" + source.filename().string());
+    }
+
+} // namespace
+
+// ── StrategyPlugin ──────────────────────────────────────────────────
+
+StrategyPlugin::~StrategyPlugin() {
+    if (handle_) {
+        closeLibrary(handle_);
+    }
+    if (!loadedCopy_.empty()) {
+        std::error_code ec;
+        fs::remove(loadedCopy_, ec);
+    }
+}
+
+const std::string& StrategyPlugin::getName() const {
+    return name_;
+}
+
+const std::string& StrategyPlugin::getVersion() const {
+    return version_;
+}
+
+const std::string& StrategyPlugin::getPath() const {
+    return path_;
+}
+
+std::shared_ptr<IPlayer> StrategyPlugin::createPlayer() {
+    IPlayer* raw = info_->create();
+    if (!raw) {
+        throw PluginError("Plugin '" + name_ + "' failed to create a player");
+    }
+    // The deleter owns a reference to this plugin, so the code of the
+    // player outlives every session still using it.
+    std::shared_ptr<StrategyPlugin> self = shared_from_this();
+    return std::shared_ptr<IPlayer>(raw, [self](IPlayer* p) { self->info_->destroy(p); });
+}
+
+// ── PluginLoader ────────────────────────────────────────────────────
+
+bool PluginLoader::isPluginFile(const fs::path& path) {
+    const std::string ext = path.extension().string();
+    return ext == ".so" || ext == ".dylib" || ext == ".dll";
+}
+
+std::shared_ptr<StrategyPlugin> PluginLoader::load(const std::string& path) {
+    std::shared_ptr<StrategyPlugin> plugin(new StrategyPlugin());
+    plugin->path_ = path;
+
+    // Map a private copy so that a plugin rebuilt at the same path is
+    // really reloaded (the dynamic loader caches libraries by path).
+    std::error_code ec;
+    const fs::path copy = privateCopyPath(path);
+    fs::copy_file(path, copy, fs::copy_options::overwrite_existing, ec);
+    if (ec) {
+        throw PluginError("Cannot read plugin " + path + ": " + ec.message());
+    }
+    plugin->loadedCopy_ = copy;
+
+    plugin->handle_ = openLibrary(copy);
+    if (!plugin->handle_) {
+        throw PluginError("Cannot load plugin " + path + ": " + lastLoadError());
+    }
+#if !defined(_WIN32)
+    // The mapping stays valid; drop the copy right away.
+    fs::remove(copy, ec);
+    plugin->loadedCopy_.clear();
+#endif
+
+    auto entry = reinterpret_cast<RspPluginEntry>(findSymbol(plugin->handle_, RSP_PLUGIN_ENTRY_SYMBOL));
+    if (!entry) {
+        throw PluginError("Plugin " + path + " does not export " RSP_PLUGIN_ENTRY_SYMBOL);
+    }
+    const RspPluginInfo* info = entry();
+    if (!info) {
+        throw PluginError("Plugin " + path + " returned no plugin info");
+    }
+    if (info->abiVersion != RSP_PLUGIN_ABI_VERSION) {
+        throw PluginError("Plugin " + path + " has ABI version " + std::to_string(info->abiVersion) +
+                          ", expected " + std::to_string(RSP_PLUGIN_ABI_VERSION));
+    }
+    if (info->cxxAbi != RSP_PLUGIN_CXX_ABI || info->playerSize != sizeof(IPlayer)) {
+        throw PluginError("Plugin " + path + " was built with an incompatible compiler ABI");
+    }
+    if (!info->name || !*info->name || !info->create || !info->destroy || !info->attachHost) {
+        throw PluginError("Plugin " + path + " has incomplete plugin info");
+    }
+    info->attachHost(&NameRegistry::intern);
+
+    plugin->info_ = info;
+    plugin->name_ = info->name;
+    plugin->version_ = info->version ? info->version : "";
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    plugins_[plugin->name_] = plugin;
+    return plugin;
+}
+
+std::size_t PluginLoader::refresh(const std::string& directory) {
+    std::vector<std::pair<std::string, fs::file_time_type>> candidates;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        if (!entry.is_regular_file(ec) || !isPluginFile(entry.path())) {
+            continue;
+        }
+        const fs::file_time_type mtime = entry.last_write_time(ec);
+        const std::string path = entry.path().string();
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = seen_.find(path);
+        if (it == seen_.end() || it->second != mtime) {
+            candidates.emplace_back(path, mtime);
+        }
+    }
+    if (ec) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        errors_.push_back("Cannot scan " + directory + ": " + ec.message());
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    std::size_t loaded = 0;
+    for (const auto& [path, mtime] : candidates) {
+        try {
+            load(path);
+            ++loaded;
+        } catch (const PluginError& e) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            errors_.push_back(e.what());
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        seen_[path] = mtime;
+    }
+    return loaded;
+}
+
+std::shared_ptr<IPlayer> PluginLoader::createPlayer(std::string_view name) const {
+    std::shared_ptr<StrategyPlugin> plugin = find(name);
+    if (!plugin) {
+        throw std::invalid_argument("Unknown strategy: " + std::string(name));
+    }
+    return plugin->createPlayer();
+}
+
+std::shared_ptr<StrategyPlugin> PluginLoader::find(std::string_view name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = plugins_.find(name);
+    return it == plugins_.end() ? nullptr : it->second;
+}
+
+std::vector<std::string> PluginLoader::getStrategyNames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> names;
+    for (const auto& entry : plugins_) {
+        names.push_back(entry.first);
+    }
+    return names;
+}
+
+bool PluginLoader::unload(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = plugins_.find(name);
+    if (it == plugins_.end()) {
+        return false;
+    }
+    plugins_.erase(it);
+    return true;
+}
+
+std::vector<std::string> PluginLoader::getErrors() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return errors_;
+}
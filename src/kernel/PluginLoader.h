@@ -0,0 +1,141 @@
+#ifndef PLUGIN_LOADER_H
+#define PLUGIN_LOADER_H
+
+#include "PluginAbi.h"
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file PluginLoader.h
+ * @brief Discovers, version-checks and hot-swaps strategy plugins.
+ *
+ * The loader maps strategy names to loaded plugins.  Loading a plugin
+ * whose name is already registered replaces the registration, so the
+ * next createPlayer() call – and therefore the next session – uses the
+ * new code, while the process keeps running.
+ *
+ * Every player holds a reference to the library it came from, so a
+ * session that started with an older version keeps running it until
+ * the session drops its players; only then is the library unloaded.
+ *
+ * Each load maps a private copy of the file, so rebuilding a plugin in
+ * place and loading it again yields the new code even though the path
+ * is unchanged.
+ *
+ * @par Design Patterns
+ * - **Registry** – strategies are looked up by name.
+ * - **Proxy (light)** – players keep their library alive.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – loading and lifetime only; strategies
+ *   themselves live in the plugins.
+ */
+
+/** @brief Raised when a plugin cannot be loaded or fails the ABI check. */
+class PluginError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @class StrategyPlugin
+ * @brief One loaded plugin library.
+ */
+class StrategyPlugin : public std::enable_shared_from_this<StrategyPlugin> {
+public:
+    ~StrategyPlugin();
+
+    StrategyPlugin(const StrategyPlugin&) = delete;
+    StrategyPlugin& operator=(const StrategyPlugin&) = delete;
+
+    /** @brief Returns the strategy name declared by the plugin. */
+    const std::string& getName() const;
+
+    /** @brief Returns the plugin's version string. */
+    const std::string& getVersion() const;
+
+    /** @brief Returns the file the plugin was loaded from. */
+    const std::string& getPath() const;
+
+    /**
+     * @brief Creates a player; the library stays loaded while it lives.
+     * @throws PluginError if the plugin's factory returns null.
+     */
+    std::shared_ptr<IPlayer> createPlayer();
+
+private:
+    friend class PluginLoader;
+    StrategyPlugin() = default;
+
+    void* handle_ = nullptr;             ///< dlopen / LoadLibrary handle.
+    const RspPluginInfo* info_ = nullptr;
+    std::string name_;
+    std::string version_;
+    std::string path_;
+    std::filesystem::path loadedCopy_;   ///< Private copy that was mapped.
+};
+
+/**
+ * @class PluginLoader
+ * @brief Registry of strategy plugins.  All methods are thread-safe.
+ */
+class PluginLoader {
+public:
+    /**
+     * @brief Loads one plugin file and registers its strategy.
+     * @param path Shared object to load.
+     * @return The loaded plugin.
+     * @throws PluginError if the file cannot be loaded, lacks the entry
+     *         symbol, or was built against a different ABI.
+     */
+    std::shared_ptr<StrategyPlugin> load(const std::string& path);
+
+    /**
+     * @brief Loads every plugin in @p directory that is new or changed
+     *        since the previous refresh.
+     *
+     * Files that fail to load are skipped and reported by getErrors().
+     *
+     * @return The number of plugins loaded by this call.
+     */
+    std::size_t refresh(const std::string& directory);
+
+    /**
+     * @brief Creates a player from the current version of @p name.
+     * @throws std::invalid_argument if no such strategy is registered.
+     */
+    std::shared_ptr<IPlayer> createPlayer(std::string_view name) const;
+
+    /** @brief Returns the current plugin for @p name, or nullptr. */
+    std::shared_ptr<StrategyPlugin> find(std::string_view name) const;
+
+    /** @brief Returns the registered strategy names, sorted. */
+    std::vector<std::string> getStrategyNames() const;
+
+    /**
+     * @brief Removes @p name from the registry (existing players keep
+     *        their library loaded).
+     * @return true if it was registered.
+     */
+    bool unload(std::string_view name);
+
+    /** @brief Returns the messages of failed loads during refresh(). */
+    std::vector<std::string> getErrors() const;
+
+    /** @brief Returns true if @p path has a shared-library extension. */
+    static bool isPluginFile(const std::filesystem::path& path);
+
+private:
+    mutable std::mutex mutex_;
+    std::map<std::string, std::shared_ptr<StrategyPlugin>, std::less<>> plugins_;
+    std::map<std::string, std::filesystem::file_time_type> seen_; ///< Path → mtime.
+    std::vector<std::string> errors_;
+};
+
+#endif // PLUGIN_LOADER_H
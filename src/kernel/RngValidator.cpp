@@ -0,0 +1,251 @@
+#include "kernel/RngValidator.h"
+#include "kernel/CounterRng.h"
+#include "kernel/Hand.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    /// Counters of one worker thread.
+    struct Tally {
+        std::array<std::uint64_t, 3> counts{};
+        std::array<std::uint64_t, 9> pairs{};
+        std::array<std::uint64_t, RngReport::MAX_RUN + 1> runs{};
+        double generationSeconds = 0.0;
+    };
+
+    /// Frequencies of single gestures and adjacent pairs in x[0..n).
+    /// Branch-free compare-and-add into locals, so the loops vectorize.
+    void countBlock(const std::uint8_t* x, std::size_t n, Tally& t) {
+        std::uint32_t s0 = 0, s1 = 0, s2 = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            s0 += x[i] == 0;
+            s1 += x[i] == 1;
+            s2 += x[i] == 2;
+        }
+        t.counts[0] += s0;
+        t.counts[1] += s1;
+        t.counts[2] += s2;
+
+        std::uint32_t p0 = 0, p1 = 0, p2 = 0, p3 = 0, p4 = 0, p5 = 0, p6 = 0, p7 = 0, p8 = 0;
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            const unsigned v = 3u * x[i] + x[i + 1];
+            p0 += v == 0; p1 += v == 1; p2 += v == 2;
+            p3 += v == 3; p4 += v == 4; p5 += v == 5;
+            p6 += v == 6; p7 += v == 7; p8 += v == 8;
+        }
+        const std::uint32_t p[9] = {p0, p1, p2, p3, p4, p5, p6, p7, p8};
+        for (int k = 0; k < 9; ++k) t.pairs[k] += p[k];
+    }
+
+    void worker(const RngGenerator& generator, unsigned stream, std::uint64_t samples,
+                Tally& t) {
+        std::vector<std::uint8_t> buffer(RngValidator::BUFFER);
+        int previous = -1;
+        std::uint64_t runLength = 0;
+
+        for (std::uint64_t done = 0; done < samples;) {
+            const auto n = static_cast<std::size_t>(
+                std::min<std::uint64_t>(RngValidator::BUFFER, samples - done));
+            const auto t0 = Clock::now();
+            generator.fill(stream, done, buffer.data(), n);
+            t.generationSeconds += std::chrono::duration<double>(Clock::now() - t0).count();
+
+            countBlock(buffer.data(), n, t);
+            if (previous >= 0 && previous <= 2 && buffer[0] <= 2) {
+                ++t.pairs[3 * previous + buffer[0]]; // pair across the buffer edge
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                if (buffer[i] == previous) {
+                    ++runLength;
+                } else {
+                    if (runLength) ++t.runs[std::min<std::uint64_t>(runLength, RngReport::MAX_RUN)];
+                    previous = buffer[i];
+                    runLength = 1;
+                }
+            }
+            done += n;
+        }
+        if (runLength) ++t.runs[std::min<std::uint64_t>(runLength, RngReport::MAX_RUN)];
+    }
+
+    /// Regularized upper incomplete gamma function Q(a, x).
+    double gammaQ(double a, double x) {
+        if (x <= 0.0) return 1.0;
+        const double logPrefix = -x + a * std::log(x) - std::lgamma(a);
+        if (x < a + 1.0) {
+            // Series for P(a, x).
+            double term = 1.0 / a;
+            double sum = term;
+            for (int n = 1; n < 1000; ++n) {
+                term *= x / (a + n);
+                sum += term;
+                if (std::fabs(term) < std::fabs(sum) * 1e-15) break;
+            }
+            return std::max(0.0, 1.0 - sum * std::exp(logPrefix));
+        }
+        // Continued fraction for Q(a, x) (modified Lentz).
+        constexpr double TINY = 1e-300;
+        double b = x + 1.0 - a;
+        double c = 1.0 / TINY;
+        double d = 1.0 / b;
+        double h = d;
+        for (int i = 1; i < 1000; ++i) {
+            const double an = -i * (i - a);
+            b += 2.0;
+            d = an * d + b;
+            if (std::fabs(d) < TINY) d = TINY;
+            c = b + an / c;
+            if (std::fabs(c) < TINY) c = TINY;
+            d = 1.0 / d;
+            const double delta = d * c;
+            h *= delta;
+            if (std::fabs(delta - 1.0) < 1e-15) break;
+        }
+        return std::exp(logPrefix) * h;
+    }
+}
+
+double RngValidator::chiSquareP(double statistic, double df) {
+    return gammaQ(df / 2.0, statistic / 2.0);
+}
+
+bool RngReport::passed(double alpha) const {
+    return chiSquareP >= alpha && serialP >= alpha && serialCorrelationP >= alpha &&
+           runsP >= alpha;
+}
+
+RngReport RngValidator::run(const RngGenerator& generator, std::uint64_t samples,
+                            unsigned threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::max<std::uint64_t>(1, std::min<std::uint64_t>(threads, samples)));
+
+    RngReport r;
+    r.generator = generator.name;
+    r.samples = samples;
+    r.threads = threads;
+
+    const auto start = Clock::now();
+    std::vector<Tally> tallies(threads);
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) {
+        const std::uint64_t share = samples / threads + (t < samples % threads ? 1 : 0);
+        pool.emplace_back(worker, std::cref(generator), t, share, std::ref(tallies[t]));
+    }
+    worker(generator, 0, samples / threads + (samples % threads ? 1 : 0), tallies[0]);
+    for (auto& th : pool) th.join();
+    r.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    for (const Tally& t : tallies) {
+        for (int k = 0; k < 3; ++k) r.counts[k] += t.counts[k];
+        for (int k = 0; k < 9; ++k) r.pairs[k] += t.pairs[k];
+        for (std::size_t k = 0; k < r.runs.size(); ++k) r.runs[k] += t.runs[k];
+        r.generationSeconds += t.generationSeconds;
+    }
+    if (r.seconds > 0.0) r.samplesPerSecond = static_cast<double>(samples) / r.seconds;
+    if (r.generationSeconds > 0.0) {
+        r.generatedPerSecond = static_cast<double>(samples) / r.generationSeconds;
+    }
+
+    // Frequency test.
+    const double n = static_cast<double>(r.counts[0] + r.counts[1] + r.counts[2]);
+    if (n > 0) {
+        for (std::uint64_t c : r.counts) {
+            const double e = n / 3.0;
+            r.chiSquare += (c - e) * (c - e) / e;
+        }
+        r.chiSquareP = chiSquareP(r.chiSquare, 2);
+    }
+
+    // Overlapping serial test and lag-1 correlation, from the pair table.
+    double m = 0.0;
+    std::array<double, 3> firsts{}, seconds{};
+    double sumXY = 0.0;
+    for (int a = 0; a < 3; ++a) {
+        for (int b = 0; b < 3; ++b) {
+            const double c = static_cast<double>(r.pairs[3 * a + b]);
+            m += c;
+            firsts[a] += c;
+            seconds[b] += c;
+            sumXY += a * b * c;
+        }
+    }
+    if (m > 0) {
+        double psi2 = 0.0, psi1 = 0.0;
+        for (std::uint64_t c : r.pairs) psi2 += (c - m / 9.0) * (c - m / 9.0) / (m / 9.0);
+        for (double c : firsts) psi1 += (c - m / 3.0) * (c - m / 3.0) / (m / 3.0);
+        r.serialChiSquare = std::max(0.0, psi2 - psi1);
+        r.serialP = chiSquareP(r.serialChiSquare, 6);
+
+        const double sx = firsts[1] + 2 * firsts[2], sy = seconds[1] + 2 * seconds[2];
+        const double sxx = firsts[1] + 4 * firsts[2], syy = seconds[1] + 4 * seconds[2];
+        const double den = std::sqrt((m * sxx - sx * sx) * (m * syy - sy * sy));
+        if (den > 0) {
+            r.serialCorrelation = (m * sumXY - sx * sy) / den;
+            r.serialCorrelationP = std::erfc(std::fabs(r.serialCorrelation) * std::sqrt(m / 2.0));
+        } else {
+            r.serialCorrelation = 1.0;
+            r.serialCorrelationP = 0.0; // constant sequence
+        }
+    }
+
+    // Run lengths: buckets 1..K-1 plus a tail ≥ K with ≥ 5 expected runs.
+    double runs = 0.0;
+    for (std::uint64_t c : r.runs) runs += static_cast<double>(c);
+    std::size_t k = 1;
+    while (k < RngReport::MAX_RUN && runs * std::pow(1.0 / 3.0, static_cast<double>(k)) >= 5.0) ++k;
+    if (k >= 2) {
+        double tailObserved = 0.0;
+        for (std::size_t len = 1; len < r.runs.size(); ++len) {
+            const double observed = static_cast<double>(r.runs[len]);
+            if (len < k) {
+                const double e = runs * (2.0 / 3.0) * std::pow(1.0 / 3.0, static_cast<double>(len - 1));
+                r.runsChiSquare += (observed - e) * (observed - e) / e;
+            } else {
+                tailObserved += observed;
+            }
+        }
+        const double tailExpected = runs * std::pow(1.0 / 3.0, static_cast<double>(k - 1));
+        r.runsChiSquare += (tailObserved - tailExpected) * (tailObserved - tailExpected) / tailExpected;
+        r.runsDf = static_cast<int>(k - 1);
+        r.runsP = chiSquareP(r.runsChiSquare, r.runsDf);
+    }
+    return r;
+}
+
+RngGenerator RngValidator::handGenerator() {
+    return {"Hand::generateCombination",
+            [](std::uint64_t, std::uint64_t, std::uint8_t* out, std::size_t count) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = static_cast<std::uint8_t>(Hand::generateCombination().getCombination());
+                }
+            }};
+}
+
+RngGenerator RngValidator::handBulkGenerator() {
+    return {"Hand::generateCombinations",
+            [](std::uint64_t, std::uint64_t, std::uint8_t* out, std::size_t count) {
+                Combination chunk[4096];
+                for (std::size_t i = 0; i < count; i += 4096) {
+                    const std::size_t n = std::min<std::size_t>(4096, count - i);
+                    Hand::generateCombinations(chunk, n);
+                    for (std::size_t j = 0; j < n; ++j) {
+                        out[i + j] = static_cast<std::uint8_t>(chunk[j]);
+                    }
+                }
+            }};
+}
+
+RngGenerator RngValidator::counterGenerator(std::uint64_t seed) {
+    return {"CounterRng::combinationAt",
+            [seed](std::uint64_t stream, std::uint64_t first, std::uint8_t* out, std::size_t count) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = static_cast<std::uint8_t>(
+                        CounterRng::combinationAt(seed, stream, first + i));
+                }
+            }};
+}
@@ -0,0 +1,117 @@
+#ifndef RNG_VALIDATOR_H
+#define RNG_VALIDATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * @file RngValidator.h
+ * @brief Statistical and throughput validation of gesture generators.
+ *
+ * A generator is streamed through fixed-size buffers on several
+ * threads (one independent stream per thread).  Each buffer is reduced
+ * by branch-free compare-and-add counters over adjacent pairs, which
+ * the compiler turns into SIMD code, plus one sequential pass for run
+ * lengths.  Per-thread counters are merged at the end, so only a few
+ * hundred integers cross threads no matter how many samples are drawn.
+ *
+ * From those counters the report derives:
+ * - a chi-square frequency test (2 degrees of freedom);
+ * - Good's overlapping serial test on pairs (6 degrees of freedom) and
+ *   Knuth's lag-1 serial correlation coefficient;
+ * - a chi-square test of run lengths against the geometric law
+ *   P(run = k) = (2/3)(1/3)^(k-1) of independent uniform gestures;
+ * - generation throughput (generator time only) and end-to-end
+ *   throughput.
+ *
+ * @par Design Patterns
+ * - **Strategy** – generators are plugged in as RngGenerator functions.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – measurement only; generators live in
+ *   Hand and CounterRng.
+ */
+
+/**
+ * @brief A gesture source under test.
+ *
+ * fill(stream, first, out, count) writes gestures first .. first+count-1
+ * of stream @p stream as values 0..2.  Each validation thread reads its
+ * own stream sequentially, so stateful generators may keep per-thread
+ * state and ignore @p first.
+ */
+struct RngGenerator {
+    std::string name;
+    std::function<void(std::uint64_t stream, std::uint64_t first,
+                       std::uint8_t* out, std::size_t count)> fill;
+};
+
+/** @brief Results of one validation run. */
+struct RngReport {
+    static constexpr std::size_t MAX_RUN = 24; ///< Longer runs share the last bucket.
+
+    std::string generator;
+    std::uint64_t samples = 0;
+    unsigned threads = 0;
+
+    std::array<std::uint64_t, 3> counts{};        ///< Per gesture.
+    std::array<std::uint64_t, 9> pairs{};         ///< counts[3 * a + b] of a followed by b.
+    std::array<std::uint64_t, MAX_RUN + 1> runs{}; ///< runs[k] = runs of length k.
+
+    double chiSquare = 0.0;          ///< Frequency test statistic (df 2).
+    double chiSquareP = 1.0;
+    double serialChiSquare = 0.0;    ///< Overlapping pairs statistic (df 6).
+    double serialP = 1.0;
+    double serialCorrelation = 0.0;  ///< Lag-1 coefficient, ~0 for a good RNG.
+    double serialCorrelationP = 1.0;
+    double runsChiSquare = 0.0;      ///< Run-length statistic.
+    int runsDf = 0;
+    double runsP = 1.0;
+
+    double seconds = 0.0;            ///< Wall time of the whole run.
+    double generationSeconds = 0.0;  ///< Time inside fill(), summed over threads.
+    double samplesPerSecond = 0.0;   ///< End-to-end (wall clock).
+    double generatedPerSecond = 0.0; ///< Per generating thread, generation only.
+
+    /** @brief True if no p-value is below @p alpha. */
+    bool passed(double alpha = 1e-4) const;
+};
+
+/**
+ * @class RngValidator
+ * @brief Runs the validation suite on a generator.
+ */
+class RngValidator {
+public:
+    static constexpr std::size_t BUFFER = 1 << 16; ///< Gestures per fill() call.
+
+    /**
+     * @brief Streams @p samples gestures from @p generator and tests them.
+     * @param generator The source under test.
+     * @param samples   Total gestures (split evenly over the threads).
+     * @param threads   Worker threads (0 = hardware concurrency).
+     */
+    static RngReport run(const RngGenerator& generator, std::uint64_t samples,
+                         unsigned threads = 0);
+
+    /** @brief Hand::generateCombination(), one call per gesture. */
+    static RngGenerator handGenerator();
+
+    /** @brief Hand::generateCombinations(), bulk draws. */
+    static RngGenerator handBulkGenerator();
+
+    /** @brief CounterRng::combinationAt() keyed by @p seed, session = stream. */
+    static RngGenerator counterGenerator(std::uint64_t seed = 1);
+
+    /**
+     * @brief Upper tail probability of the chi-square distribution.
+     * @param statistic Observed statistic.
+     * @param df        Degrees of freedom.
+     */
+    static double chiSquareP(double statistic, double df);
+};
+
+#endif // RNG_VALIDATOR_H
@@ -0,0 +1,107 @@
+#include "kernel/RoundBroadcaster.h"
+#include "kernel/Game.h"
+
+std::shared_ptr<RoundBroadcaster> RoundBroadcaster::create(std::size_t capacity) {
+    return std::shared_ptr<RoundBroadcaster>(new RoundBroadcaster(capacity));
+}
+
+RoundBroadcaster::RoundBroadcaster(std::size_t capacity)
+    : mask_(0)
+    , ring_()
+    , head_(0)
+{
+    std::size_t size = 1;
+    while (size < capacity) size <<= 1;
+    mask_ = size - 1;
+    ring_ = std::vector<Seqlock<RoundFrame>>(size);
+}
+
+void RoundBroadcaster::publish(std::int64_t roundIndex, const Move& move,
+                               std::int64_t userScore, std::int64_t computerScore,
+                               std::int64_t drawCount) {
+    const MoveResult result = move.getWhoWins();
+    RoundFrame frame;
+    frame.sequence      = head_.load(std::memory_order_relaxed) + 1;
+    frame.roundIndex    = static_cast<std::uint64_t>(roundIndex);
+    frame.userHand      = static_cast<std::uint8_t>(move.getUserHand().getCombination());
+    frame.computerHand  = static_cast<std::uint8_t>(move.getComputerHand().getCombination());
+    frame.result        = static_cast<std::uint8_t>(result);
+    frame.userScore     = static_cast<std::uint64_t>(userScore);
+    frame.computerScore = static_cast<std::uint64_t>(computerScore);
+    frame.drawCount     = static_cast<std::uint64_t>(drawCount);
+
+    ring_[frame.sequence & mask_].store(frame);
+    head_.store(frame.sequence, std::memory_order_release);
+}
+
+Session::RoundCallback RoundBroadcaster::asRoundCallback(const Session& session) {
+    std::shared_ptr<RoundBroadcaster> self = shared_from_this();
+    return [self, &session](std::int64_t roundIndex, const Move& move) {
+        self->publish(roundIndex, move, session.getUserScore(), session.getComputerScore(),
+                      session.getDrawCount());
+    };
+}
+
+Session::RoundCallback RoundBroadcaster::asRoundCallback(const Game& game) {
+    std::shared_ptr<RoundBroadcaster> self = shared_from_this();
+    return [self, &game](std::int64_t roundIndex, const Move& move) {
+        const Session& session = *game.getCurrentSession();
+        self->publish(roundIndex, move, session.getUserScore(), session.getComputerScore(),
+                      session.getDrawCount());
+    };
+}
+
+RoundBroadcaster::Subscription RoundBroadcaster::subscribe() {
+    return Subscription(shared_from_this(), head_.load(std::memory_order_acquire) + 1);
+}
+
+std::uint64_t RoundBroadcaster::getPublishedCount() const {
+    return head_.load(std::memory_order_acquire);
+}
+
+std::size_t RoundBroadcaster::getCapacity() const {
+    return mask_ + 1;
+}
+
+// ── Subscription ───────────────────────────────────────────────────
+
+RoundBroadcaster::Subscription::Subscription(std::shared_ptr<const RoundBroadcaster> hub,
+                                             std::uint64_t next)
+    : hub_(std::move(hub))
+    , next_(next)
+    , dropped_(0)
+{}
+
+std::size_t RoundBroadcaster::Subscription::poll(RoundFrame* out, std::size_t max) {
+    const std::uint64_t capacity = hub_->mask_ + 1;
+    std::size_t count = 0;
+
+    while (count < max) {
+        const std::uint64_t head = hub_->head_.load(std::memory_order_acquire);
+        if (next_ > head) break;
+
+        // Lapped: the frames we wanted have been overwritten.
+        if (head - next_ >= capacity) {
+            const std::uint64_t oldest = head - capacity + 1;
+            dropped_ += oldest - next_;
+            next_ = oldest;
+        }
+
+        RoundFrame frame = hub_->ring_[next_ & hub_->mask_].load();
+        if (frame.sequence != next_) {
+            continue; // overwritten while reading – re-evaluate the head
+        }
+        out[count++] = frame;
+        ++next_;
+    }
+    return count;
+}
+
+std::uint64_t RoundBroadcaster::Subscription::getDroppedCount() const {
+    return dropped_;
+}
+
+std::uint64_t RoundBroadcaster::Subscription::getBacklog() const {
+    const std::uint64_t head = hub_->head_.load(std::memory_order_acquire);
+    return head >= next_ ? head - next_ + 1 : 0;
+}
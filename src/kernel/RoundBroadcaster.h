@@ -0,0 +1,158 @@
+#ifndef ROUND_BROADCASTER_H
+#define ROUND_BROADCASTER_H
+
+#include "Move.h"
+#include "Seqlock.h"
+#include "Session.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Game;
+
+/**
+ * @file RoundBroadcaster.h
+ * @brief One-writer, many-reader fan-out of round events to spectators.
+ *
+ * Each round is encoded exactly once into a fixed-size RoundFrame and
+ * written into a shared ring buffer.  Spectators do not get a copy
+ * pushed to them; each Subscription owns a cursor into the ring and
+ * pulls frames at its own pace.  The game thread's cost is therefore
+ * independent of the number of watchers, and a slow watcher that falls
+ * more than one ring behind simply skips ahead (its drops are counted)
+ * without slowing the match or the other watchers.
+ *
+ * The broadcaster is shared (std::shared_ptr): every Subscription and
+ * every callback returned by asRoundCallback() holds a reference, so
+ * the ring lives as long as anyone still reads or writes it.  Scores
+ * are not tallied here: each frame carries the totals the session
+ * reports, so a broadcaster may join mid-session or carry several
+ * sessions.
+ *
+ * @par Design Patterns
+ * - **Observer** – publish / subscribe without coupling.
+ * - **Ring Buffer** – bounded memory, overwrite-oldest.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – distribution only; formatting for a
+ *   particular transport is the subscriber's concern.
+ */
+
+/**
+ * @brief Fixed-size encoded round event (the wire format).
+ *
+ * Trivially copyable and 48 bytes, so a subscriber may hand it to a
+ * socket or shared-memory transport as-is.  Round index and tallies are
+ * 64-bit like Session's, so long sessions never wrap.
+ */
+struct RoundFrame {
+    std::uint64_t sequence      = 0; ///< 1-based publication number.
+    std::uint64_t roundIndex    = 0; ///< 0-based round within the session.
+    std::uint64_t userScore     = 0; ///< User wins after this round.
+    std::uint64_t computerScore = 0; ///< Computer wins after this round.
+    std::uint64_t drawCount     = 0; ///< Draws after this round.
+    std::uint8_t  userHand      = 0; ///< Combination as integer.
+    std::uint8_t  computerHand  = 0; ///< Combination as integer.
+    std::uint8_t  result        = 0; ///< MoveResult as integer.
+    std::uint8_t  reserved[5]   = {}; ///< Padding, always zero.
+};
+
+static_assert(sizeof(RoundFrame) == 48, "RoundFrame is a 48-byte wire format");
+
+/**
+ * @class RoundBroadcaster
+ * @brief Shared ring of encoded round events with per-subscriber cursors.
+ */
+class RoundBroadcaster : public std::enable_shared_from_this<RoundBroadcaster> {
+public:
+    class Subscription;
+
+    /** @brief Default ring capacity (frames). */
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    /**
+     * @brief Creates a broadcaster.
+     * @param capacity Ring size in frames; rounded up to a power of two.
+     */
+    static std::shared_ptr<RoundBroadcaster> create(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Encodes and publishes one round.  Single writer only.
+     * @param roundIndex    0-based round index.
+     * @param move          The move just played.
+     * @param userScore     User wins after this round.
+     * @param computerScore Computer wins after this round.
+     * @param drawCount     Draws after this round.
+     */
+    void publish(std::int64_t roundIndex, const Move& move, std::int64_t userScore,
+                 std::int64_t computerScore, std::int64_t drawCount);
+
+    /**
+     * @brief Returns a callback for @p session that publishes each round
+     *        with the session's scores.
+     *
+     * The callback keeps the broadcaster alive; @p session must outlive
+     * it (register it on @p session itself).
+     */
+    Session::RoundCallback asRoundCallback(const Session& session);
+
+    /**
+     * @brief Returns a callback for Game::setRoundObserver() that
+     *        publishes each round with the current session's scores.
+     *
+     * The callback keeps the broadcaster alive; @p game must outlive it.
+     */
+    Session::RoundCallback asRoundCallback(const Game& game);
+
+    /** @brief Opens a subscription that starts at the next published frame. */
+    Subscription subscribe();
+
+    /** @brief Returns the number of frames published so far. */
+    std::uint64_t getPublishedCount() const;
+
+    /** @brief Returns the ring capacity in frames. */
+    std::size_t getCapacity() const;
+
+    /**
+     * @class Subscription
+     * @brief One watcher's cursor into the ring.  Not thread-safe itself;
+     *        give each consumer thread its own Subscription.
+     */
+    class Subscription {
+    public:
+        /**
+         * @brief Copies up to @p max pending frames into @p out.
+         * @return Number of frames written; 0 if nothing new.
+         *
+         * If this subscriber fell behind by more than the ring
+         * capacity, it skips to the oldest retained frame and the skipped
+         * frames are added to getDroppedCount().
+         */
+        std::size_t poll(RoundFrame* out, std::size_t max);
+
+        /** @brief Returns how many frames this subscriber missed. */
+        std::uint64_t getDroppedCount() const;
+
+        /** @brief Returns how many frames are waiting to be polled. */
+        std::uint64_t getBacklog() const;
+
+    private:
+        friend class RoundBroadcaster;
+        Subscription(std::shared_ptr<const RoundBroadcaster> hub, std::uint64_t next);
+
+        std::shared_ptr<const RoundBroadcaster> hub_;
+        std::uint64_t next_;    ///< Sequence number of the next frame to read.
+        std::uint64_t dropped_; ///< Frames lost to overwrite.
+    };
+
+private:
+    explicit RoundBroadcaster(std::size_t capacity);
+
+    std::size_t mask_;
+    std::vector<Seqlock<RoundFrame>> ring_;
+    std::atomic<std::uint64_t> head_; ///< Sequence of the last published frame.
+};
+
+#endif // ROUND_BROADCASTER_H
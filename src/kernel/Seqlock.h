@@ -0,0 +1,97 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @file Seqlock.h
+ * @brief Single-writer / many-reader sequence lock for small value types.
+ *
+ * The writer never blocks: it bumps a sequence counter to an odd value,
+ * copies the value into atomic words, then bumps the counter to even.
+ * Readers copy the words and retry if the counter was odd or changed
+ * meanwhile, so every load() returns a value that was stored as a whole.
+ *
+ * All shared words are std::atomic (accessed relaxed, ordered by
+ * fences), so concurrent use is free of data races under the C++
+ * memory model.
+ *
+ * @tparam T A trivially-copyable, default-constructible value type.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – publication of one value only.
+ */
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Seqlock requires a trivially copyable type");
+
+public:
+    Seqlock() noexcept {
+        store(T{});
+    }
+
+    Seqlock(const Seqlock&) = delete;
+    Seqlock& operator=(const Seqlock&) = delete;
+
+    /**
+     * @brief Publishes a new value.  Must only be called by one thread
+     *        at a time (the owner / writer thread).
+     */
+    void store(const T& value) noexcept {
+        std::uint64_t buf[WORDS] = {};
+        std::memcpy(buf, &value, sizeof(T));
+
+        const std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            words_[i].store(buf[i], std::memory_order_relaxed);
+        }
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns a consistent copy of the last published value.
+     *        Safe to call from any number of threads.
+     */
+    T load() const noexcept {
+        std::uint64_t buf[WORDS];
+        for (;;) {
+            const std::uint64_t before = seq_.load(std::memory_order_acquire);
+            if (before & 1u) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (std::size_t i = 0; i < WORDS; ++i) {
+                buf[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+        T value;
+        std::memcpy(&value, buf, sizeof(T));
+        return value;
+    }
+
+    /** @brief Returns how many values have been stored (the initial
+     *         default value counts as the first). */
+    std::uint64_t version() const noexcept {
+        return seq_.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    static constexpr std::size_t WORDS = (sizeof(T) + 7) / 8;
+
+    std::atomic<std::uint64_t> seq_{0};
+    std::atomic<std::uint64_t> words_[WORDS];
+};
+
+#endif // SEQLOCK_H
@@ -1,117 +1,353 @@
 #include "kernel/Session.h"
+#include "kernel/Metrics.h"
+#include "kernel/Tracer.h"
+#include <algorithm>
 #include <stdexcept>
 
+namespace {
+    /// Upper bound on the history reserved by the constructor.
+    constexpr std::int64_t MAX_RESERVED_ROUNDS = 1 << 16;
+
+    std::int64_t nowTicks() {
+        return static_cast<std::int64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    double ticksToSeconds(std::int64_t ticks) {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::duration(ticks)).count();
+    }
+}
+
+double SessionSnapshot::elapsedSeconds() const {
+    return ticksToSeconds((running ? nowTicks() : endTicks) - startTicks);
+}
+
 Session::Session(std::shared_ptr<IPlayer> user,
                  std::shared_ptr<IPlayer> computer,
-                 int rounds)
+                 std::int64_t rounds,
+                 std::size_t historyLimit)
     : user_(std::move(user))
     , computer_(std::move(computer))
+    , moves_(historyLimit)
     , totalRounds_(rounds)
     , userScore_(0)
     , computerScore_(0)
     , drawCount_(0)
     , running_(false)
+    , stopRequested_(false)
+    , inStart_(false)
+    , startTicks_(0)
+    , endTicks_(0)
 {
-    moves_.reserve(static_cast<size_t>(totalRounds_));
+    // Reserve up front so short sessions never reallocate, but do not
+    // commit memory for soak runs of billions of rounds.
+    moves_.reserve(static_cast<std::size_t>(
+        std::max<std::int64_t>(0, std::min<std::int64_t>(totalRounds_, MAX_RESERVED_ROUNDS))));
+    if (user_) user_->onSessionStart();
+    if (computer_) computer_->onSessionStart();
+    publish();
 }
 
 void Session::start() {
-    running_ = true;
-    startTime_ = std::chrono::steady_clock::now();
+    inStart_ = true;
+    markStarted();
 
-    while (running_ && static_cast<int>(moves_.size()) < totalRounds_) {
-        playRound();
+    try {
+        while (!stopRequested_.load(std::memory_order_acquire) &&
+               static_cast<std::int64_t>(moves_.size()) < totalRounds_) {
+            playRound();
+        }
+    } catch (...) {
+        inStart_ = false;
+        throw;
     }
 
-    running_ = false;
-    endTime_ = std::chrono::steady_clock::now();
+    stopRequested_.store(false, std::memory_order_relaxed);
+    inStart_ = false;
+    markEnded();
 }
 
 void Session::stop() {
-    running_ = false;
-    endTime_ = std::chrono::steady_clock::now();
+    stopRequested_.store(true, std::memory_order_release);
+    endTicks_.store(nowTicks(), std::memory_order_release);
+    running_.store(false, std::memory_order_release); // after endTicks_ (see snapshot())
+}
+
+SessionSnapshot Session::snapshot() const {
+    SessionSnapshot snap = published_.load();
+    // Only the game thread publishes; a stop() from another thread shows
+    // up here right away instead of after the round in progress.
+    if (snap.running && !running_.load(std::memory_order_acquire)) {
+        snap.running = false;
+        snap.endTicks = endTicks_.load(std::memory_order_acquire);
+    }
+    return snap;
+}
+
+void Session::markStarted() {
+    startTicks_.store(nowTicks(), std::memory_order_relaxed);
+    running_.store(true, std::memory_order_release);
+    publish();
+}
+
+void Session::markEnded() {
+    running_.store(false, std::memory_order_relaxed);
+    endTicks_.store(nowTicks(), std::memory_order_release);
+    publish();
+}
+
+void Session::publish() {
+    SessionSnapshot snap;
+    snap.userScore     = userScore_;
+    snap.computerScore = computerScore_;
+    snap.drawCount     = drawCount_;
+    snap.roundsPlayed  = static_cast<std::int64_t>(moves_.size());
+    snap.totalRounds   = totalRounds_;
+    snap.running       = running_.load(std::memory_order_relaxed);
+    snap.startTicks    = startTicks_.load(std::memory_order_relaxed);
+    snap.endTicks      = endTicks_.load(std::memory_order_relaxed);
+    published_.store(snap);
 }
 
 Move Session::playRound() {
-    if (static_cast<int>(moves_.size()) >= totalRounds_) {
+    if (static_cast<std::int64_t>(moves_.size()) >= totalRounds_) {
         throw std::runtime_error("All rounds have already been played.");
     }
 
-    if (!running_) {
-        running_ = true;
-        startTime_ = std::chrono::steady_clock::now();
-    }
+    TraceScope traceRound("Session::playRound", "session");
+    KernelMetrics& metrics = KernelMetrics::get();
+    const bool timed = KernelMetrics::isTimingEnabled();
+    const auto roundStart = timed ? std::chrono::steady_clock::now()
+                                  : std::chrono::steady_clock::time_point();
+    beginRounds();
 
-    Hand userHand     = user_->chooseHand();
-    Hand computerHand = computer_->chooseHand();
+    Hand userHand;
+    Hand computerHand;
+    {
+        TraceScope trace("user.chooseHand", "player");
+        userHand = user_->chooseHand();
+    }
+    {
+        TraceScope trace("computer.chooseHand", "player");
+        computerHand = computer_->chooseHand();
+    }
 
     Move move(userHand, computerHand);
     moves_.push_back(move);
 
+    {
+        TraceScope trace("observeRound", "player");
+        user_->observeRound(userHand, computerHand);
+        computer_->observeRound(computerHand, userHand);
+    }
+
     switch (move.getWhoWins()) {
-        case MoveResult::UserWins:     ++userScore_;     break;
-        case MoveResult::ComputerWins: ++computerScore_; break;
-        case MoveResult::Draw:         ++drawCount_;     break;
+        case MoveResult::UserWins:     ++userScore_;     metrics.userWins.inc();     break;
+        case MoveResult::ComputerWins: ++computerScore_; metrics.computerWins.inc(); break;
+        case MoveResult::Draw:         ++drawCount_;     metrics.draws.inc();        break;
     }
+    metrics.rounds.inc();
 
     if (roundCallback_) {
-        roundCallback_(static_cast<int>(moves_.size()) - 1, move);
+        TraceScope trace("roundCallback", "callback");
+        roundCallback_(static_cast<std::int64_t>(moves_.size()) - 1, move);
     }
 
-    if (static_cast<int>(moves_.size()) >= totalRounds_) {
-        running_ = false;
-        endTime_ = std::chrono::steady_clock::now();
-    }
+    endRounds();
 
+    if (timed) {
+        metrics.roundLatency.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - roundStart).count()));
+    }
     return move;
 }
 
+std::int64_t Session::playBatch(std::int64_t rounds) {
+    const std::int64_t remaining = totalRounds_ - static_cast<std::int64_t>(moves_.size());
+    if (remaining <= 0) {
+        throw std::runtime_error("All rounds have already been played.");
+    }
+    if (rounds <= 0) {
+        return 0;
+    }
+    const std::size_t count = static_cast<std::size_t>(std::min(rounds, remaining));
+
+    TraceScope traceBatch("Session::playBatch", "session");
+    KernelMetrics& metrics = KernelMetrics::get();
+    const bool timed = KernelMetrics::isTimingEnabled();
+    const auto batchStart = timed ? std::chrono::steady_clock::now()
+                                  : std::chrono::steady_clock::time_point();
+    const std::int64_t firstRound = static_cast<std::int64_t>(moves_.size());
+    beginRounds();
+
+    userBatch_.resize(count);
+    computerBatch_.resize(count);
+    const bool userBulk = user_->isBatchable();
+    const bool computerBulk = computer_->isBatchable();
+    if (userBulk) {
+        TraceScope trace("user.chooseHands", "player");
+        user_->chooseHands(userBatch_.data(), count);
+    }
+    if (computerBulk) {
+        TraceScope trace("computer.chooseHands", "player");
+        computer_->chooseHands(computerBatch_.data(), count);
+    }
+    if (!userBulk || !computerBulk) {
+        // Adaptive players see every round before choosing the next one.
+        TraceScope trace("chooseHand/observeRound", "player");
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!userBulk) userBatch_[i] = user_->chooseHand();
+            if (!computerBulk) computerBatch_[i] = computer_->chooseHand();
+            user_->observeRound(userBatch_[i], computerBatch_[i]);
+            computer_->observeRound(computerBatch_[i], userBatch_[i]);
+        }
+    }
+
+    // Score and record the whole batch in one pass.
+    std::int64_t tally[3] = {0, 0, 0};
+    batchMoves_.clear();
+    batchMoves_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        batchMoves_.emplace_back(userBatch_[i], computerBatch_[i]);
+        moves_.push_back(batchMoves_.back());
+        ++tally[static_cast<int>(batchMoves_.back().getWhoWins())];
+    }
+    metrics.userWins.inc(static_cast<std::uint64_t>(tally[static_cast<int>(MoveResult::UserWins)]));
+    metrics.computerWins.inc(static_cast<std::uint64_t>(tally[static_cast<int>(MoveResult::ComputerWins)]));
+    metrics.draws.inc(static_cast<std::uint64_t>(tally[static_cast<int>(MoveResult::Draw)]));
+    metrics.rounds.inc(count);
+
+    if (userBulk && computerBulk) {
+        TraceScope trace("observeRound", "player");
+        for (std::size_t i = 0; i < count; ++i) {
+            user_->observeRound(userBatch_[i], computerBatch_[i]);
+            computer_->observeRound(computerBatch_[i], userBatch_[i]);
+        }
+    }
+
+    if (roundCallback_) {
+        // Advance the scores round by round so each callback sees the
+        // session as of the round it reports.
+        TraceScope trace("roundCallback", "callback");
+        for (std::size_t i = 0; i < count; ++i) {
+            switch (batchMoves_[i].getWhoWins()) {
+                case MoveResult::UserWins:     ++userScore_;     break;
+                case MoveResult::ComputerWins: ++computerScore_; break;
+                case MoveResult::Draw:         ++drawCount_;     break;
+            }
+            roundCallback_(firstRound + static_cast<std::int64_t>(i), batchMoves_[i]);
+        }
+    } else {
+        userScore_     += tally[static_cast<int>(MoveResult::UserWins)];
+        computerScore_ += tally[static_cast<int>(MoveResult::ComputerWins)];
+        drawCount_     += tally[static_cast<int>(MoveResult::Draw)];
+    }
+    if (batchCallback_) {
+        TraceScope trace("batchCallback", "callback");
+        batchCallback_(firstRound, batchMoves_.data(), count);
+    }
+
+    endRounds();
+
+    if (timed) {
+        // One sample per batch: the mean cost of its rounds.
+        metrics.roundLatency.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - batchStart).count()) / count);
+    }
+    return static_cast<std::int64_t>(count);
+}
+
+void Session::beginRounds() {
+    if (moves_.empty()) {
+        KernelMetrics::get().sessionsStarted.inc();
+    }
+
+    if (!running_.load(std::memory_order_acquire)) {
+        // Outside start(), a new round resumes a stopped session.  Inside
+        // start(), a concurrent stop() must not restart the clock.
+        if (!inStart_) {
+            stopRequested_.store(false, std::memory_order_relaxed);
+        }
+        if (!stopRequested_.load(std::memory_order_acquire)) {
+            markStarted();
+        }
+    }
+}
+
+void Session::endRounds() {
+    if (static_cast<std::int64_t>(moves_.size()) >= totalRounds_) {
+        KernelMetrics::get().sessionsFinished.inc();
+        markEnded();
+    } else {
+        publish();
+    }
+}
+
 std::string Session::whoWins() const {
+    return std::string(whoWinsView());
+}
+
+std::string_view Session::whoWinsView() const {
     if (userScore_ > computerScore_) {
-        return user_->getName();
+        return user_->getNameView();
     }
     if (computerScore_ > userScore_) {
-        return computer_->getName();
+        return computer_->getNameView();
     }
     return "Draw";
 }
 
-int Session::getUserScore() const {
+const std::shared_ptr<IPlayer>& Session::getUser() const {
+    return user_;
+}
+
+const std::shared_ptr<IPlayer>& Session::getComputer() const {
+    return computer_;
+}
+
+std::int64_t Session::getUserScore() const {
     return userScore_;
 }
 
-int Session::getComputerScore() const {
+std::int64_t Session::getComputerScore() const {
     return computerScore_;
 }
 
-int Session::getDrawCount() const {
+std::int64_t Session::getDrawCount() const {
     return drawCount_;
 }
 
-const std::vector<Move>& Session::getMoves() const {
+const MoveHistory& Session::getMoves() const {
     return moves_;
 }
 
-int Session::getTotalRounds() const {
+std::int64_t Session::getTotalRounds() const {
     return totalRounds_;
 }
 
-int Session::getRoundsPlayed() const {
-    return static_cast<int>(moves_.size());
+std::int64_t Session::getRoundsPlayed() const {
+    return static_cast<std::int64_t>(moves_.size());
 }
 
 bool Session::isRunning() const {
-    return running_;
+    return running_.load(std::memory_order_acquire);
 }
 
 void Session::onRoundCompleted(RoundCallback cb) {
     roundCallback_ = std::move(cb);
 }
 
+void Session::onBatchCompleted(BatchCallback cb) {
+    batchCallback_ = std::move(cb);
+}
+
 double Session::getElapsedSeconds() const {
-    if (running_) {
-        auto now = std::chrono::steady_clock::now();
-        return std::chrono::duration<double>(now - startTime_).count();
+    const std::int64_t start = startTicks_.load(std::memory_order_relaxed);
+    if (running_.load(std::memory_order_acquire)) {
+        return ticksToSeconds(nowTicks() - start);
     }
-    return std::chrono::duration<double>(endTime_ - startTime_).count();
+    return ticksToSeconds(endTicks_.load(std::memory_order_acquire) - start);
 }
@@ -2,9 +2,13 @@
 #define SESSION_H
 
 #include "Move.h"
+#include "MoveHistory.h"
 #include "IPlayer.h"
+#include "Seqlock.h"
+#include <atomic>
 #include <vector>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <functional>
 
@@ -28,7 +32,33 @@
  * - **Open/Closed** – new player types plug in without changes.
  * - **Dependency Inversion** – depends on IPlayer, not concrete types.
  * - **Interface Segregation** – exposes only what consumers need.
+ *
+ * @par Threading
+ * A Session is driven by one game thread.  Other threads may call
+ * snapshot(), getElapsedSeconds(), isRunning() and stop() at any time;
+ * the remaining getters are for the game thread only.
+ */
+
+/**
+ * @brief Consistent point-in-time view of a Session for spectators.
+ *
+ * Published by the game thread after every round through a Seqlock, so
+ * readers always see scores, round count and state from the same round.
  */
+struct SessionSnapshot {
+    std::int64_t userScore     = 0; ///< User wins so far.
+    std::int64_t computerScore = 0; ///< Computer wins so far.
+    std::int64_t drawCount     = 0; ///< Draws so far.
+    std::int64_t roundsPlayed  = 0; ///< Rounds completed.
+    std::int64_t totalRounds   = 0; ///< Rounds configured.
+    bool running      = false; ///< True while the session is in progress.
+    std::int64_t startTicks = 0; ///< steady_clock ticks at start.
+    std::int64_t endTicks   = 0; ///< steady_clock ticks at end (if stopped).
+
+    /** @brief Wall-clock duration, measured up to now while running. */
+    double elapsedSeconds() const;
+};
+
 class Session {
 public:
     /**
@@ -36,20 +66,33 @@ public:
      *
      * Parameters: round index (0-based), the Move just played.
      */
-    using RoundCallback = std::function<void(int roundIndex, const Move& move)>;
+    using RoundCallback = std::function<void(std::int64_t roundIndex, const Move& move)>;
+
+    /**
+     * @brief Type alias for the batch-completed notification.
+     *
+     * Parameters: index of the batch's first round, the batch's moves
+     * (contiguous, valid only during the call) and their count.
+     */
+    using BatchCallback = std::function<void(std::int64_t firstRound,
+                                             const Move* moves, std::size_t count)>;
 
     /** @brief Default number of rounds per session (from the UML: 10). */
     static constexpr int DEFAULT_ROUNDS = 10;
 
     /**
-     * @brief Constructs a Session.
+     * @brief Constructs a Session and tells both players a session is
+     *        starting (IPlayer::onSessionStart).
      * @param user     Shared pointer to the human player.
      * @param computer Shared pointer to the AI player.
-     * @param rounds   Number of rounds (defaults to 10).
+     * @param rounds   Number of rounds (defaults to 10; 64-bit for soak runs).
+     * @param historyLimit Rounds of history kept in RAM; older rounds
+     *                 spill to a temporary file (see MoveHistory).
      */
     Session(std::shared_ptr<IPlayer> user,
             std::shared_ptr<IPlayer> computer,
-            int rounds = DEFAULT_ROUNDS);
+            std::int64_t rounds = DEFAULT_ROUNDS,
+            std::size_t historyLimit = MoveHistory::UNLIMITED);
 
     /**
      * @brief Starts the session and plays all rounds sequentially.
@@ -57,48 +100,88 @@ public:
      * Each round:
      * 1. Both players choose a Hand.
      * 2. A Move is created and evaluated.
-     * 3. The optional RoundCallback is invoked.
+     * 3. Both players observe the round (IPlayer::observeRound).
+     * 4. The optional RoundCallback is invoked.
      */
     void start();
 
     /**
      * @brief Stops the session prematurely (sets running flag to false).
+     *
+     * Thread-safe: when called from another thread while start() is
+     * running, start() returns after the round in progress.  A stop
+     * requested before start() cancels that start() call.
      */
     void stop();
 
+    /**
+     * @brief Returns a consistent snapshot of scores, round and state.
+     *
+     * Thread-safe and wait-free for the game thread; readers retry only
+     * while a round is being published.  A stop() is reflected at once
+     * (running false, endTicks set), even while a round is in progress.
+     */
+    SessionSnapshot snapshot() const;
+
     /**
      * @brief Determines the overall winner based on cumulative score.
      * @return Name of the winning player, or "Draw" if tied.
      */
     std::string whoWins() const;
 
+    /**
+     * @brief Same as whoWins() without copying the name.
+     * @return The winner's name (valid while this Session holds its
+     *         players), or "Draw" if tied.
+     */
+    std::string_view whoWinsView() const;
+
+    /** @brief Returns the user-side player. */
+    const std::shared_ptr<IPlayer>& getUser() const;
+
+    /** @brief Returns the computer-side player. */
+    const std::shared_ptr<IPlayer>& getComputer() const;
+
     /** @brief Returns the user's total wins. */
-    int getUserScore() const;
+    std::int64_t getUserScore() const;
 
     /** @brief Returns the computer's total wins. */
-    int getComputerScore() const;
+    std::int64_t getComputerScore() const;
 
     /** @brief Returns the number of draws. */
-    int getDrawCount() const;
+    std::int64_t getDrawCount() const;
 
-    /** @brief Returns a read-only reference to all played moves. */
-    const std::vector<Move>& getMoves() const;
+    /**
+     * @brief Returns a read-only view of all played moves.
+     *
+     * Rounds beyond the history limit are paged in from disk on access.
+     */
+    const MoveHistory& getMoves() const;
 
     /** @brief Returns the total number of rounds configured. */
-    int getTotalRounds() const;
+    std::int64_t getTotalRounds() const;
 
     /** @brief Returns the number of rounds played so far. */
-    int getRoundsPlayed() const;
+    std::int64_t getRoundsPlayed() const;
 
     /** @brief Returns true while the session is in progress. */
     bool isRunning() const;
 
     /**
      * @brief Registers a callback invoked after each round.
+     *
+     * During the call the session's scores include the reported round
+     * and no later one, also when the round was played by playBatch().
      * @param cb The callback function.
      */
     void onRoundCompleted(RoundCallback cb);
 
+    /**
+     * @brief Registers a callback invoked once after each playBatch().
+     * @param cb The callback function.
+     */
+    void onBatchCompleted(BatchCallback cb);
+
     /**
      * @brief Returns the wall-clock duration of the session.
      * @return Duration in seconds (0 if not yet started).
@@ -116,21 +199,65 @@ public:
      */
     Move playRound();
 
+    /**
+     * @brief Plays up to @p rounds rounds in one pass.
+     *
+     * Batchable players (IPlayer::isBatchable) are asked for all hands at
+     * once (IPlayer::chooseHands) and observe the batch's rounds after
+     * they are all chosen.  Other players choose one hand at a time and
+     * observe each round before choosing the next, exactly as in
+     * playRound(), so adaptive strategies keep adapting inside a batch.
+     * The rounds are then scored and recorded in a single loop.  The
+     * per-round callback, if any, still fires for every round; the batch
+     * callback fires once.
+     *
+     * @param rounds Rounds to play; clipped to the rounds remaining.
+     * @return The number of rounds played (0 if @p rounds <= 0).
+     * @throws std::runtime_error if all rounds are already played.
+     */
+    std::int64_t playBatch(std::int64_t rounds);
+
 private:
     std::shared_ptr<IPlayer> user_;
     std::shared_ptr<IPlayer> computer_;
 
-    std::vector<Move> moves_;  ///< Recorded moves (up to totalRounds_).
-    int totalRounds_;          ///< Number of rounds to play.
-    int userScore_;            ///< Cumulative user wins.
-    int computerScore_;        ///< Cumulative computer wins.
-    int drawCount_;            ///< Cumulative draws.
-    bool running_;             ///< True while the session is in progress.
+    MoveHistory moves_;           ///< Recorded moves (up to totalRounds_).
+    std::int64_t totalRounds_;    ///< Number of rounds to play.
+    std::int64_t userScore_;      ///< Cumulative user wins.
+    std::int64_t computerScore_;  ///< Cumulative computer wins.
+    std::int64_t drawCount_;      ///< Cumulative draws.
+    std::atomic<bool> running_;       ///< True while the session is in progress.
+    std::atomic<bool> stopRequested_; ///< Set by stop(), consumed by start().
+    bool inStart_;                    ///< True while start() is looping.
 
     RoundCallback roundCallback_; ///< Optional per-round notification.
+    BatchCallback batchCallback_; ///< Optional per-batch notification.
+
+    // Scratch space reused by playBatch().
+    std::vector<Hand> userBatch_;
+    std::vector<Hand> computerBatch_;
+    std::vector<Move> batchMoves_;
+
+    // steady_clock tick counts, atomic so other threads can read them.
+    std::atomic<std::int64_t> startTicks_;
+    std::atomic<std::int64_t> endTicks_;
+
+    Seqlock<SessionSnapshot> published_; ///< Spectator view.
+
+    /// Marks the session as started now.
+    void markStarted();
+
+    /// Marks the session as ended now.
+    void markEnded();
+
+    /// Publishes the current state to snapshot() readers.
+    void publish();
+
+    /// Bookkeeping before the first round of a playRound()/playBatch().
+    void beginRounds();
 
-    std::chrono::steady_clock::time_point startTime_;
-    std::chrono::steady_clock::time_point endTime_;
+    /// Ends the session or publishes progress after rounds were played.
+    void endRounds();
 };
 
 #endif // SESSION_H
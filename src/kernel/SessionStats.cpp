@@ -0,0 +1,157 @@
+#include "kernel/SessionStats.h"
+#include "kernel/Session.h"
+#include <cstring>
+
+namespace {
+    constexpr char MAGIC[8] = {'R', 'S', 'P', 'S', 'K', '0', '0', '1'};
+
+    void putCounts(std::vector<std::uint8_t>& out, const std::array<std::uint64_t, 3>& a) {
+        const auto* p = reinterpret_cast<const std::uint8_t*>(a.data());
+        out.insert(out.end(), p, p + sizeof a);
+    }
+
+    bool getCounts(const std::vector<std::uint8_t>& in, std::size_t& pos,
+                   std::array<std::uint64_t, 3>& a) {
+        if (in.size() - pos < sizeof a) return false;
+        std::memcpy(a.data(), in.data() + pos, sizeof a);
+        pos += sizeof a;
+        return true;
+    }
+
+    void add(std::array<std::uint64_t, 3>& into, const std::array<std::uint64_t, 3>& from) {
+        for (std::size_t i = 0; i < 3; ++i) into[i] += from[i];
+    }
+}
+
+// ---- SessionSketch ----
+
+void SessionSketch::record(const Session& session) {
+    const std::int64_t user = session.getUserScore();
+    const std::int64_t computer = session.getComputerScore();
+    const MoveResult outcome = user > computer ? MoveResult::UserWins
+                             : user < computer ? MoveResult::ComputerWins
+                                               : MoveResult::Draw;
+    ++sessions_;
+    ++sessionResults_[static_cast<std::size_t>(outcome)];
+    roundResults_[static_cast<std::size_t>(MoveResult::UserWins)] += static_cast<std::uint64_t>(user);
+    roundResults_[static_cast<std::size_t>(MoveResult::ComputerWins)] += static_cast<std::uint64_t>(computer);
+    roundResults_[static_cast<std::size_t>(MoveResult::Draw)] +=
+        static_cast<std::uint64_t>(session.getDrawCount());
+
+    for (const Move& move : session.getMoves()) {
+        ++userGestures_[static_cast<std::size_t>(move.getUserHand().getCombination())];
+        ++computerGestures_[static_cast<std::size_t>(move.getComputerHand().getCombination())];
+    }
+
+    durations_.add(session.getElapsedSeconds());
+    players_.add(session.getUser()->getNameView());
+    players_.add(session.getComputer()->getNameView());
+}
+
+void SessionSketch::merge(const SessionSketch& other) {
+    sessions_ += other.sessions_;
+    add(sessionResults_, other.sessionResults_);
+    add(roundResults_, other.roundResults_);
+    add(userGestures_, other.userGestures_);
+    add(computerGestures_, other.computerGestures_);
+    durations_.merge(other.durations_);
+    players_.merge(other.players_);
+}
+
+void SessionSketch::reset() {
+    *this = SessionSketch();
+}
+
+std::uint64_t SessionSketch::getSessions() const {
+    return sessions_;
+}
+
+std::uint64_t SessionSketch::getSessions(MoveResult result) const {
+    return sessionResults_[static_cast<std::size_t>(result)];
+}
+
+std::uint64_t SessionSketch::getRounds() const {
+    return roundResults_[0] + roundResults_[1] + roundResults_[2];
+}
+
+std::uint64_t SessionSketch::getRounds(MoveResult result) const {
+    return roundResults_[static_cast<std::size_t>(result)];
+}
+
+std::uint64_t SessionSketch::getUserGestures(Combination gesture) const {
+    return userGestures_[static_cast<std::size_t>(gesture)];
+}
+
+std::uint64_t SessionSketch::getComputerGestures(Combination gesture) const {
+    return computerGestures_[static_cast<std::size_t>(gesture)];
+}
+
+const TDigest& SessionSketch::getDurations() const {
+    return durations_;
+}
+
+double SessionSketch::getDistinctPlayers() const {
+    return players_.estimate();
+}
+
+std::vector<std::uint8_t> SessionSketch::serialize() const {
+    std::vector<std::uint8_t> out(MAGIC, MAGIC + sizeof MAGIC);
+    const auto* p = reinterpret_cast<const std::uint8_t*>(&sessions_);
+    out.insert(out.end(), p, p + sizeof sessions_);
+    putCounts(out, sessionResults_);
+    putCounts(out, roundResults_);
+    putCounts(out, userGestures_);
+    putCounts(out, computerGestures_);
+    durations_.serialize(out);
+    players_.serialize(out);
+    return out;
+}
+
+bool SessionSketch::deserialize(const std::vector<std::uint8_t>& data) {
+    if (data.size() < sizeof MAGIC + sizeof(std::uint64_t) ||
+        std::memcmp(data.data(), MAGIC, sizeof MAGIC) != 0) {
+        return false;
+    }
+    SessionSketch s;
+    std::size_t pos = sizeof MAGIC;
+    std::memcpy(&s.sessions_, data.data() + pos, sizeof s.sessions_);
+    pos += sizeof s.sessions_;
+    if (!getCounts(data, pos, s.sessionResults_) || !getCounts(data, pos, s.roundResults_) ||
+        !getCounts(data, pos, s.userGestures_) || !getCounts(data, pos, s.computerGestures_) ||
+        !s.durations_.deserialize(data, pos) || !s.players_.deserialize(data, pos) ||
+        pos != data.size()) {
+        return false;
+    }
+    *this = s;
+    return true;
+}
+
+// ---- SessionStatsCollector ----
+
+void SessionStatsCollector::record(const Session& session) {
+    Shard& shard = (*shards_)[metricShard()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.sketch.record(session);
+}
+
+void SessionStatsCollector::merge(const SessionSketch& sketch) {
+    Shard& shard = (*shards_)[metricShard()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.sketch.merge(sketch);
+}
+
+SessionSketch SessionStatsCollector::snapshot() const {
+    SessionSketch total;
+    for (Shard& shard : *shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total.merge(shard.sketch);
+    }
+    return total;
+}
+
+void SessionStatsCollector::reset() {
+    for (Shard& shard : *shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.sketch.reset();
+    }
+}
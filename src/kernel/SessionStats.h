@@ -0,0 +1,136 @@
+#ifndef SESSION_STATS_H
+#define SESSION_STATS_H
+
+#include "Combination.h"
+#include "HyperLogLog.h"
+#include "Metrics.h"
+#include "Move.h"
+#include "TDigest.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Session;
+
+/**
+ * @file SessionStats.h
+ * @brief Mergeable aggregate statistics over finished sessions.
+ *
+ * A SessionSketch summarises any number of sessions in constant space:
+ * - session and round outcome counts;
+ * - per-gesture frequencies for both sides;
+ * - a TDigest of session duration (Session::getElapsedSeconds());
+ * - a HyperLogLog of distinct player names.
+ *
+ * Every part merges associatively, so sketches built on separate
+ * threads (or in separate processes, via serialize()) combine into
+ * the sketch of all their sessions.  A merge costs O(compression +
+ * HyperLogLog::REGISTERS) whatever the number of sessions summarised.
+ *
+ * SessionStatsCollector gives each thread its own cache-line-aligned
+ * sketch (sharded like MetricCounter), so concurrent recorders never
+ * touch each other's lines; snapshot() merges the shards on demand.
+ *
+ * @par Design Patterns
+ * - **Value Object** – SessionSketch is copyable and mergeable.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – aggregation only; sessions are read,
+ *   never modified.
+ */
+
+/**
+ * @class SessionSketch
+ * @brief Constant-size summary of a set of sessions.
+ *
+ * Aligned to a cache line so per-thread sketches held in an array do
+ * not share one.
+ */
+class alignas(64) SessionSketch {
+public:
+    /** @brief Adds one (normally finished) session. */
+    void record(const Session& session);
+
+    /** @brief Adds every session summarised by @p other. */
+    void merge(const SessionSketch& other);
+
+    /** @brief Removes all sessions. */
+    void reset();
+
+    /** @brief Returns the number of sessions recorded. */
+    std::uint64_t getSessions() const;
+
+    /**
+     * @brief Returns the number of sessions with outcome @p result
+     *        (decided on the final score, equal scores are a Draw).
+     */
+    std::uint64_t getSessions(MoveResult result) const;
+
+    /** @brief Returns the number of rounds recorded. */
+    std::uint64_t getRounds() const;
+
+    /** @brief Returns the number of rounds with outcome @p result. */
+    std::uint64_t getRounds(MoveResult result) const;
+
+    /** @brief Returns how often the user played @p gesture. */
+    std::uint64_t getUserGestures(Combination gesture) const;
+
+    /** @brief Returns how often the computer played @p gesture. */
+    std::uint64_t getComputerGestures(Combination gesture) const;
+
+    /** @brief Returns the session duration distribution (seconds). */
+    const TDigest& getDurations() const;
+
+    /** @brief Returns the estimated number of distinct players. */
+    double getDistinctPlayers() const;
+
+    /** @brief Returns a portable encoding, for merging across processes. */
+    std::vector<std::uint8_t> serialize() const;
+
+    /**
+     * @brief Replaces this sketch with one written by serialize().
+     * @return false (sketch unchanged) if @p data is not a valid sketch.
+     */
+    bool deserialize(const std::vector<std::uint8_t>& data);
+
+private:
+    std::uint64_t sessions_ = 0;
+    std::array<std::uint64_t, 3> sessionResults_{}; ///< By MoveResult.
+    std::array<std::uint64_t, 3> roundResults_{};   ///< By MoveResult.
+    std::array<std::uint64_t, 3> userGestures_{};   ///< By Combination.
+    std::array<std::uint64_t, 3> computerGestures_{};
+    TDigest durations_;
+    HyperLogLog players_;
+};
+
+/**
+ * @class SessionStatsCollector
+ * @brief Thread-safe SessionSketch with one shard per thread.
+ */
+class SessionStatsCollector {
+public:
+    /** @brief Records @p session into the calling thread's shard. */
+    void record(const Session& session);
+
+    /** @brief Merges @p sketch (e.g. from another process) into this thread's shard. */
+    void merge(const SessionSketch& sketch);
+
+    /** @brief Returns the merge of all shards. */
+    SessionSketch snapshot() const;
+
+    /** @brief Clears every shard. */
+    void reset();
+
+private:
+    struct alignas(64) Shard {
+        std::mutex mutex; ///< Uncontended unless two threads share a shard.
+        SessionSketch sketch;
+    };
+    // ~80 KB, so it lives on the heap.
+    std::unique_ptr<std::array<Shard, METRIC_SHARDS>> shards_ =
+        std::make_unique<std::array<Shard, METRIC_SHARDS>>();
+};
+
+#endif // SESSION_STATS_H
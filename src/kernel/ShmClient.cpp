@@ -0,0 +1,139 @@
+#include "kernel/ShmClient.h"
+#include <algorithm>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+ShmClient::ShmClient()
+    : segment_(nullptr)
+    , slot_(nullptr)
+    , pid_(0)
+    , generation_(0)
+{}
+
+ShmClient::~ShmClient() {
+    disconnect();
+}
+
+bool ShmClient::newSession(std::int64_t rounds) {
+    ShmRequest request;
+    request.type = ShmRequestType::NewSession;
+    request.rounds = rounds;
+    return send(request);
+}
+
+bool ShmClient::play(Combination choice) {
+    ShmRequest request;
+    request.type = ShmRequestType::Play;
+    request.gesture = static_cast<std::int32_t>(choice);
+    return send(request);
+}
+
+bool ShmClient::poll(ShmEvent& event) {
+    return ownsSlot() && slot_->events.tryPop(event);
+}
+
+bool ShmClient::waitEvent(ShmEvent& event, std::chrono::microseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (ownsSlot()) {
+        // Sleep in short slices so a dead server is noticed promptly.
+        const auto left = std::max(std::chrono::microseconds(0),
+                                   std::chrono::duration_cast<std::chrono::microseconds>(
+                                       deadline - std::chrono::steady_clock::now()));
+        if (slot_->events.popWait(event, std::min(left, std::chrono::microseconds(100000)))) {
+            return true;
+        }
+        if (left.count() == 0 || !isConnected()) return false;
+    }
+    return false;
+}
+
+#if defined(_WIN32)
+
+bool ShmClient::connect(const std::string&, std::string_view) { return false; }
+void ShmClient::disconnect() {}
+bool ShmClient::isConnected() const { return false; }
+bool ShmClient::ownsSlot() const { return false; }
+bool ShmClient::send(const ShmRequest&) { return false; }
+
+#else
+
+bool ShmClient::connect(const std::string& name, std::string_view userName) {
+    disconnect();
+    const std::string shmName = (!name.empty() && name[0] == '/') ? name : "/" + name;
+    const int fd = ::shm_open(shmName.c_str(), O_RDWR, 0);
+    if (fd < 0) return false;
+    void* mem = ::mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) return false;
+
+    auto* segment = static_cast<ShmSegment*>(mem);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (segment->magic != ShmSegment::MAGIC || segment->version != ShmSegment::VERSION) {
+        ::munmap(mem, sizeof(ShmSegment));
+        return false;
+    }
+
+    const auto pid = static_cast<std::int32_t>(::getpid());
+    for (ShmSlot& slot : segment->slots) {
+        std::int32_t expected = 0;
+        if (!slot.clientPid.compare_exchange_strong(expected, pid, std::memory_order_acq_rel)) {
+            continue;
+        }
+        const std::size_t len = std::min(userName.size(), ShmSlot::NAME_SIZE - 1);
+        std::memcpy(slot.userName, userName.data(), len);
+        slot.userName[len] = '\0';
+        generation_ = slot.generation.load(std::memory_order_acquire);
+        slot.state.store(SHM_SLOT_ACTIVE, std::memory_order_release);
+
+        segment_ = segment;
+        slot_ = &slot;
+        pid_ = pid;
+        return true;
+    }
+    ::munmap(mem, sizeof(ShmSegment));
+    return false;
+}
+
+void ShmClient::disconnect() {
+    if (!segment_) return;
+    if (ownsSlot()) {
+        ShmRequest request;
+        request.type = ShmRequestType::Disconnect;
+        send(request); // the server releases the slot (or reclaims it later)
+    }
+    ::munmap(segment_, sizeof(ShmSegment));
+    segment_ = nullptr;
+    slot_ = nullptr;
+    pid_ = 0;
+}
+
+bool ShmClient::ownsSlot() const {
+    return slot_ && slot_->clientPid.load(std::memory_order_acquire) == pid_ &&
+           slot_->generation.load(std::memory_order_acquire) == generation_ &&
+           segment_->serverPid.load(std::memory_order_acquire) > 0;
+}
+
+bool ShmClient::isConnected() const {
+    if (!ownsSlot()) return false;
+    const std::int32_t server = segment_->serverPid.load(std::memory_order_acquire);
+    return server == pid_ || ::kill(static_cast<pid_t>(server), 0) == 0;
+}
+
+bool ShmClient::send(const ShmRequest& request) {
+    if (!ownsSlot() || !slot_->requests.tryPush(request)) {
+        return false;
+    }
+    segment_->doorbell.fetch_add(1, std::memory_order_seq_cst);
+    if (segment_->serverWaiting.load(std::memory_order_seq_cst)) {
+        shmFutexWake(&segment_->doorbell);
+    }
+    return true;
+}
+
+#endif
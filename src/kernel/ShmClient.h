@@ -0,0 +1,74 @@
+#ifndef SHM_CLIENT_H
+#define SHM_CLIENT_H
+
+#include "Combination.h"
+#include "ShmProtocol.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @file ShmClient.h
+ * @brief Front-end side of the shared-memory transport.
+ *
+ * Maps the segment of a running ShmServer, claims a free slot and then
+ * exchanges ShmRequest / ShmEvent messages with the kernel process.
+ * Requests never block (they fail when the ring is full); waiting for
+ * events sleeps on a futex.
+ *
+ * One ShmClient is one connection and must be used by one thread.
+ * POSIX only; on other platforms connect() returns false.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – front-end transport endpoint only.
+ */
+class ShmClient {
+public:
+    ShmClient();
+
+    /** @brief Disconnects if connected. */
+    ~ShmClient();
+
+    ShmClient(const ShmClient&) = delete;
+    ShmClient& operator=(const ShmClient&) = delete;
+
+    /**
+     * @brief Connects to server segment @p name as player @p userName.
+     * @return false if the segment is missing, incompatible or full.
+     */
+    bool connect(const std::string& name, std::string_view userName);
+
+    /** @brief Releases the slot and unmaps the segment. */
+    void disconnect();
+
+    /** @brief Returns true while the slot is ours and the server is up. */
+    bool isConnected() const;
+
+    /** @brief Requests a new session of @p rounds rounds. */
+    bool newSession(std::int64_t rounds);
+
+    /** @brief Plays one round with @p choice. */
+    bool play(Combination choice);
+
+    /** @brief Pops the next event without blocking. */
+    bool poll(ShmEvent& event);
+
+    /**
+     * @brief Waits up to @p timeout for the next event.
+     * @return false on timeout or if the connection was lost.
+     */
+    bool waitEvent(ShmEvent& event, std::chrono::microseconds timeout);
+
+private:
+    bool send(const ShmRequest& request);
+    bool ownsSlot() const;
+
+    ShmSegment* segment_;
+    ShmSlot* slot_;
+    std::int32_t pid_;
+    std::uint32_t generation_; ///< Slot generation when we claimed it.
+};
+
+#endif // SHM_CLIENT_H
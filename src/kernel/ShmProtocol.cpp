@@ -0,0 +1,50 @@
+#include "kernel/ShmProtocol.h"
+#include <algorithm>
+#include <thread>
+
+#if defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+std::chrono::nanoseconds shmSpinWindow() {
+    static const std::chrono::nanoseconds window =
+        std::thread::hardware_concurrency() > 1 ? std::chrono::microseconds(20)
+                                                : std::chrono::nanoseconds(0);
+    return window;
+}
+
+#if defined(__linux__)
+
+// Shared (not FUTEX_PRIVATE) futexes: the words live in a mapping that
+// other processes share.
+void shmFutexWait(std::atomic<std::uint32_t>* word, std::uint32_t expected,
+                  std::chrono::microseconds timeout) {
+    const long long us = std::max<long long>(timeout.count(), 0);
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(us / 1000000);
+    ts.tv_nsec = static_cast<long>((us % 1000000) * 1000);
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), FUTEX_WAIT, expected, &ts,
+              nullptr, 0);
+}
+
+void shmFutexWake(std::atomic<std::uint32_t>* word) {
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), FUTEX_WAKE, INT_MAX, nullptr,
+              nullptr, 0);
+}
+
+#else
+
+void shmFutexWait(std::atomic<std::uint32_t>* word, std::uint32_t expected,
+                  std::chrono::microseconds timeout) {
+    if (word->load(std::memory_order_acquire) == expected) {
+        std::this_thread::sleep_for(std::min(timeout, std::chrono::microseconds(100)));
+    }
+}
+
+void shmFutexWake(std::atomic<std::uint32_t>*) {}
+
+#endif
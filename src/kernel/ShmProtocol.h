@@ -0,0 +1,202 @@
+#ifndef SHM_PROTOCOL_H
+#define SHM_PROTOCOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @file ShmProtocol.h
+ * @brief Layout of the shared-memory segment between the kernel
+ *        process (ShmServer) and local front-ends (ShmClient).
+ *
+ * The segment holds a header and a fixed array of client slots.  Each
+ * slot carries two single-producer / single-consumer rings: requests
+ * (front-end → kernel) and events (kernel → front-end).  Messages are
+ * fixed-size PODs; ring indices are free-running 32-bit counters.
+ *
+ * Blocking uses futexes on the ring's head word (Linux; other POSIX
+ * systems fall back to short sleeps).  The consumer announces that it
+ * is about to sleep, so a producer only pays for a wake syscall when
+ * somebody is actually waiting.  All front-ends ring a single doorbell
+ * in the header to wake the kernel.
+ *
+ * Everything in the segment is untrusted by the kernel: a front-end may
+ * crash mid-write or scribble over its slot, so the server validates
+ * every index and field it reads and never blocks on a client.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – wire format and ring mechanics only.
+ */
+
+/// Blocks while @p *word == @p expected, for at most @p timeout.
+void shmFutexWait(std::atomic<std::uint32_t>* word, std::uint32_t expected,
+                  std::chrono::microseconds timeout);
+
+/// Wakes every process blocked in shmFutexWait() on @p word.
+void shmFutexWake(std::atomic<std::uint32_t>* word);
+
+/// How long a consumer busy-polls before sleeping in shmFutexWait();
+/// zero on a uniprocessor, where spinning only delays the producer.
+std::chrono::nanoseconds shmSpinWindow();
+
+/// Spin-loop hint (PAUSE / YIELD) for busy-polling a ring.
+inline void shmCpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/** @brief Front-end → kernel command. */
+enum class ShmRequestType : std::uint32_t {
+    NewSession = 1, ///< Start a session of @c rounds rounds.
+    Play       = 2, ///< Play one round with @c gesture.
+    Disconnect = 3  ///< Release the slot.
+};
+
+/** @brief Kernel → front-end event. */
+enum class ShmEventType : std::uint32_t {
+    SessionStarted = 1, ///< @c round holds the configured rounds.
+    Round          = 2, ///< One round was played.
+    SessionOver    = 3, ///< The session finished (scores are final).
+    Error          = 4  ///< The last request was rejected.
+};
+
+/** @brief One request message. */
+struct ShmRequest {
+    ShmRequestType type = ShmRequestType::Play;
+    std::int32_t gesture = 0; ///< Combination value for Play.
+    std::int64_t rounds = 0;  ///< Round count for NewSession.
+};
+
+/** @brief One event message. */
+struct ShmEvent {
+    ShmEventType type = ShmEventType::Round;
+    std::uint8_t userHand = 0;     ///< Combination value.
+    std::uint8_t computerHand = 0; ///< Combination value.
+    std::uint8_t result = 0;       ///< MoveResult value.
+    std::uint8_t reserved = 0;
+    std::int64_t round = 0;        ///< 0-based round index.
+    std::int64_t userScore = 0;
+    std::int64_t computerScore = 0;
+    std::int64_t drawCount = 0;
+};
+
+/**
+ * @brief Lock-free SPSC ring living in shared memory.
+ * @tparam T Trivially copyable message type.
+ * @tparam N Capacity (power of two).
+ */
+template <typename T, std::uint32_t N>
+struct ShmRing {
+    static_assert((N & (N - 1)) == 0, "ShmRing capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "ShmRing needs trivially copyable messages");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+                  "ShmRing needs address-free atomics");
+
+    alignas(64) std::atomic<std::uint32_t> head;    ///< Pushed count (producer); futex word.
+    std::atomic<std::uint32_t> consumerWaiting;      ///< Consumer is (about to be) asleep.
+    alignas(64) std::atomic<std::uint32_t> tail;    ///< Popped count (consumer).
+    alignas(64) T slots[N];
+
+    /// Empties the ring.  Only while neither side is using it.
+    void reset() {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        consumerWaiting.store(0, std::memory_order_release);
+    }
+
+    /// Number of queued messages, or a value > N if the indices are corrupt.
+    std::uint32_t pending() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    /// Producer side; false if full (or corrupt).
+    bool tryPush(const T& value) {
+        const std::uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N) return false;
+        slots[h & (N - 1)] = value;
+        head.store(h + 1, std::memory_order_seq_cst);
+        if (consumerWaiting.load(std::memory_order_seq_cst)) {
+            shmFutexWake(&head);
+        }
+        return true;
+    }
+
+    /// Consumer side; false if empty (or corrupt).
+    bool tryPop(T& out) {
+        const std::uint32_t t = tail.load(std::memory_order_relaxed);
+        const std::uint32_t h = head.load(std::memory_order_acquire);
+        if (h == t || h - t > N) return false;
+        out = slots[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer side: pops, sleeping up to @p timeout for a message.
+    /// Busy-polls for shmSpinWindow() first, so a reply that arrives
+    /// within a few microseconds does not pay for a futex sleep and wake.
+    bool popWait(T& out, std::chrono::microseconds timeout) {
+        if (tryPop(out)) return true;
+        const auto window = std::min<std::chrono::nanoseconds>(shmSpinWindow(), timeout);
+        if (window.count() > 0) {
+            const auto deadline = std::chrono::steady_clock::now() + window;
+            do {
+                for (int spin = 0; spin < 32; ++spin) {
+                    if (tryPop(out)) return true;
+                    shmCpuRelax();
+                }
+            } while (std::chrono::steady_clock::now() < deadline);
+        }
+        consumerWaiting.store(1, std::memory_order_seq_cst);
+        const std::uint32_t h = head.load(std::memory_order_seq_cst);
+        if (h == tail.load(std::memory_order_relaxed)) {
+            shmFutexWait(&head, h, timeout);
+        }
+        consumerWaiting.store(0, std::memory_order_relaxed);
+        return tryPop(out);
+    }
+};
+
+/**
+ * @brief Slot lifecycle, stored in ShmSlot::state.  A front-end claims a
+ *        free slot by CAS-ing ShmSlot::clientPid from 0 to its pid, fills
+ *        in its name and then marks the slot active.
+ */
+enum ShmSlotState : std::uint32_t {
+    SHM_SLOT_FREE   = 0, ///< Not (yet) served.
+    SHM_SLOT_ACTIVE = 1  ///< Connected; the kernel serves it.
+};
+
+/** @brief One front-end connection. */
+struct ShmSlot {
+    static constexpr std::size_t NAME_SIZE = 64;
+
+    std::atomic<std::uint32_t> state;
+    std::atomic<std::int32_t> clientPid;     ///< Owner, 0 when claimable.
+    std::atomic<std::uint32_t> generation;   ///< Bumped on every release.
+    char userName[NAME_SIZE];                ///< NUL-terminated (not trusted).
+    ShmRing<ShmRequest, 64> requests;
+    ShmRing<ShmEvent, 256> events;
+};
+
+/** @brief The whole shared segment. */
+struct ShmSegment {
+    static constexpr std::uint32_t MAGIC = 0x52535053; // "RSPS"
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::uint32_t MAX_SLOTS = 16;
+
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::atomic<std::int32_t> serverPid;             ///< 0 once the server stopped.
+    alignas(64) std::atomic<std::uint32_t> doorbell; ///< Bumped by clients; futex word.
+    std::atomic<std::uint32_t> serverWaiting;
+    ShmSlot slots[MAX_SLOTS];
+};
+
+#endif // SHM_PROTOCOL_H
@@ -0,0 +1,291 @@
+#include "kernel/ShmServer.h"
+#include "kernel/ComputerAI.h"
+#include "kernel/Game.h"
+#include "kernel/User.h"
+#include <chrono>
+#include <cstring>
+#include <new>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr auto IDLE_WAIT   = std::chrono::microseconds(50000);
+    constexpr auto SWEEP_EVERY = std::chrono::milliseconds(100);
+    constexpr int  REQUEST_BUDGET = 64; ///< Requests per slot per pass (fairness).
+
+    ShmEvent errorEvent() {
+        ShmEvent e;
+        e.type = ShmEventType::Error;
+        return e;
+    }
+}
+
+ShmServer::ShmServer(ComputerFactory computerFactory)
+    : computerFactory_(std::move(computerFactory))
+    , segment_(nullptr)
+    , running_(false)
+    , clientCount_(0)
+    , roundsServed_(0)
+{
+    if (!computerFactory_) {
+        computerFactory_ = []() { return std::make_shared<ComputerAI>(); };
+    }
+}
+
+ShmServer::~ShmServer() {
+    stop();
+}
+
+void ShmServer::setBotDetector(std::shared_ptr<BotDetector> detector) {
+    botDetector_ = std::move(detector);
+}
+
+std::size_t ShmServer::getClientCount() const {
+    return clientCount_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ShmServer::getRoundsServed() const {
+    return roundsServed_.load(std::memory_order_relaxed);
+}
+
+#if defined(_WIN32)
+
+bool ShmServer::start(const std::string&) { return false; }
+void ShmServer::stop() {}
+void ShmServer::serve() {}
+bool ShmServer::serveSlot(std::size_t) { return false; }
+bool ShmServer::handle(std::size_t, const ShmRequest&) { return false; }
+void ShmServer::release(std::size_t) {}
+void ShmServer::sweepDeadClients() {}
+
+#else
+
+namespace {
+    /// True if @p name is a published segment whose server process is
+    /// still alive. Anything else (missing, foreign, stale) may be unlinked.
+    bool ownedByLiveServer(const std::string& name) {
+        const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0) return false;
+        struct stat st;
+        void* mem = MAP_FAILED;
+        if (::fstat(fd, &st) == 0 && st.st_size >= static_cast<off_t>(sizeof(ShmSegment))) {
+            mem = ::mmap(nullptr, sizeof(ShmSegment), PROT_READ, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);
+        if (mem == MAP_FAILED) return false;
+
+        const auto* segment = static_cast<const ShmSegment*>(mem);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::int32_t pid = segment->magic == ShmSegment::MAGIC
+            ? segment->serverPid.load(std::memory_order_acquire) : 0;
+        ::munmap(mem, sizeof(ShmSegment));
+        return pid > 0 && (::kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH);
+    }
+}
+
+bool ShmServer::start(const std::string& name) {
+    if (running_) return false;
+
+    name_ = (!name.empty() && name[0] == '/') ? name : "/" + name;
+    if (ownedByLiveServer(name_)) return false; // never steal a running kernel's segment
+    ::shm_unlink(name_.c_str());                // a segment left behind by a crashed server
+    const int fd = ::shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) return false;
+    void* mem = MAP_FAILED;
+    if (::ftruncate(fd, static_cast<off_t>(sizeof(ShmSegment))) == 0) {
+        mem = ::mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        ::shm_unlink(name_.c_str());
+        return false;
+    }
+
+    segment_ = new (mem) ShmSegment();
+    segment_->version = ShmSegment::VERSION;
+    segment_->serverPid.store(static_cast<std::int32_t>(::getpid()), std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    segment_->magic = ShmSegment::MAGIC; // clients reject the segment until now
+
+    clients_.clear();
+    clients_.resize(ShmSegment::MAX_SLOTS);
+    running_ = true;
+    thread_ = std::thread(&ShmServer::serve, this);
+    return true;
+}
+
+void ShmServer::stop() {
+    if (!running_.exchange(false)) return;
+
+    segment_->doorbell.fetch_add(1, std::memory_order_seq_cst);
+    shmFutexWake(&segment_->doorbell);
+    thread_.join();
+
+    for (std::size_t i = 0; i < clients_.size(); ++i) {
+        release(i);
+    }
+    segment_->serverPid.store(0, std::memory_order_release); // clients see the kernel is gone
+    ::munmap(segment_, sizeof(ShmSegment));
+    ::shm_unlink(name_.c_str());
+    segment_ = nullptr;
+}
+
+void ShmServer::serve() {
+    auto lastSweep = std::chrono::steady_clock::now();
+    while (running_.load(std::memory_order_acquire)) {
+        const std::uint32_t bell = segment_->doorbell.load(std::memory_order_acquire);
+
+        bool busy = false;
+        for (std::size_t i = 0; i < clients_.size(); ++i) {
+            busy |= serveSlot(i);
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastSweep >= SWEEP_EVERY) {
+            sweepDeadClients();
+            lastSweep = now;
+        }
+
+        if (!busy) {
+            segment_->serverWaiting.store(1, std::memory_order_seq_cst);
+            if (segment_->doorbell.load(std::memory_order_seq_cst) == bell) {
+                shmFutexWait(&segment_->doorbell, bell, IDLE_WAIT);
+            }
+            segment_->serverWaiting.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool ShmServer::serveSlot(std::size_t index) {
+    ShmSlot& slot = segment_->slots[index];
+    Client& client = clients_[index];
+    if (slot.state.load(std::memory_order_acquire) != SHM_SLOT_ACTIVE) {
+        return false;
+    }
+
+    if (!client.game) {
+        char name[ShmSlot::NAME_SIZE];
+        std::memcpy(name, slot.userName, sizeof name);
+        name[sizeof name - 1] = '\0';
+        const std::string userName = name[0] ? name : "Player";
+
+        client.choice = std::make_shared<Combination>(Combination::Rock);
+        auto choice = client.choice;
+        auto user = std::make_shared<User>(userName, [choice]() { return *choice; });
+        client.game = std::make_unique<Game>(user, computerFactory_());
+        client.pid = slot.clientPid.load(std::memory_order_acquire);
+        client.lastEventAt = std::chrono::steady_clock::now();
+        if (botDetector_) client.botId = botDetector_->addUser(userName);
+        clientCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (slot.requests.pending() > 64) { // corrupt indices
+        release(index);
+        return true;
+    }
+
+    bool busy = false;
+    ShmRequest request;
+    for (int n = 0; n < REQUEST_BUDGET && slot.requests.tryPop(request); ++n) {
+        busy = true;
+        if (!handle(index, request)) {
+            release(index);
+            break;
+        }
+    }
+    return busy;
+}
+
+bool ShmServer::handle(std::size_t index, const ShmRequest& request) {
+    ShmSlot& slot = segment_->slots[index];
+    Client& client = clients_[index];
+    Game& game = *client.game;
+
+    try {
+        switch (request.type) {
+            case ShmRequestType::NewSession: {
+                if (request.rounds < 1) return slot.events.tryPush(errorEvent());
+                game.newSession(request.rounds);
+                ShmEvent e;
+                e.type = ShmEventType::SessionStarted;
+                e.round = request.rounds;
+                client.lastEventAt = std::chrono::steady_clock::now();
+                return slot.events.tryPush(e);
+            }
+            case ShmRequestType::Play: {
+                if (request.gesture < 0 || request.gesture > 2 ||
+                    game.getState() != GameState::Running) {
+                    return slot.events.tryPush(errorEvent());
+                }
+                *client.choice = static_cast<Combination>(request.gesture);
+                const Move move = game.playSingleRound();
+                roundsServed_.fetch_add(1, std::memory_order_relaxed);
+                const auto now = std::chrono::steady_clock::now();
+                if (botDetector_) {
+                    botDetector_->observe(
+                        client.botId, move.getUserHand().getCombination(),
+                        move.getComputerHand().getCombination(),
+                        std::chrono::duration_cast<std::chrono::microseconds>(now - client.lastEventAt));
+                }
+                client.lastEventAt = now;
+
+                const Session& session = *game.getCurrentSession();
+                ShmEvent e;
+                e.type = ShmEventType::Round;
+                e.userHand = static_cast<std::uint8_t>(move.getUserHand().getCombination());
+                e.computerHand = static_cast<std::uint8_t>(move.getComputerHand().getCombination());
+                e.result = static_cast<std::uint8_t>(move.getWhoWins());
+                e.round = session.getRoundsPlayed() - 1;
+                e.userScore = session.getUserScore();
+                e.computerScore = session.getComputerScore();
+                e.drawCount = session.getDrawCount();
+                if (!slot.events.tryPush(e)) return false;
+                if (game.getState() == GameState::Finished) {
+                    e.type = ShmEventType::SessionOver;
+                    return slot.events.tryPush(e);
+                }
+                return true;
+            }
+            case ShmRequestType::Disconnect:
+                return false;
+        }
+        return slot.events.tryPush(errorEvent()); // unknown type
+    } catch (const std::exception&) {
+        return slot.events.tryPush(errorEvent());
+    }
+}
+
+void ShmServer::release(std::size_t index) {
+    Client& client = clients_[index];
+    if (client.game) {
+        if (botDetector_) botDetector_->release(client.botId);
+        clientCount_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    client = Client{};
+
+    ShmSlot& slot = segment_->slots[index];
+    slot.state.store(SHM_SLOT_FREE, std::memory_order_relaxed);
+    slot.requests.reset();
+    slot.events.reset();
+    slot.generation.fetch_add(1, std::memory_order_relaxed);
+    slot.clientPid.store(0, std::memory_order_release); // claimable again
+    shmFutexWake(&slot.events.head);                    // unblock a waiting client
+}
+
+void ShmServer::sweepDeadClients() {
+    for (std::size_t i = 0; i < clients_.size(); ++i) {
+        const std::int32_t pid = segment_->slots[i].clientPid.load(std::memory_order_acquire);
+        if (pid > 0 && ::kill(static_cast<pid_t>(pid), 0) != 0 && errno == ESRCH) {
+            release(i);
+        }
+    }
+}
+
+#endif
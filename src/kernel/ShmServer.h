@@ -0,0 +1,123 @@
+#ifndef SHM_SERVER_H
+#define SHM_SERVER_H
+
+#include "BotDetector.h"
+#include "IPlayer.h"
+#include "ShmProtocol.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Game;
+
+/**
+ * @file ShmServer.h
+ * @brief Kernel side of the shared-memory front-end transport.
+ *
+ * One kernel process creates a named POSIX shared-memory segment (see
+ * ShmProtocol.h) and serves up to ShmSegment::MAX_SLOTS local
+ * front-ends (ShmClient) from a single thread.  Each connected slot
+ * gets its own Game: Play requests drive Game::playSingleRound() and
+ * come back as typed Round / SessionOver events.  The thread sleeps on
+ * the segment doorbell when idle, so a round trip costs two futex
+ * wakeups rather than a trip through the socket stack.
+ *
+ * A front-end cannot take the kernel down with it:
+ * - every request field and ring index read from the segment is
+ *   validated; a corrupt slot is simply released;
+ * - the kernel never waits for a client – if a client stops draining
+ *   its event ring, the slot is released;
+ * - slots whose process has exited are reclaimed on the next liveness
+ *   sweep.
+ *
+ * With a BotDetector attached, every Play is scored together with the
+ * time since the client's previous event, so scripted front-ends that
+ * answer instantly or in a fixed rhythm are flagged.  Each connection
+ * is its own detector user (the client-supplied name is only a label),
+ * released again when the slot is.
+ *
+ * POSIX only; on other platforms start() returns false.
+ *
+ * @par Design Patterns
+ * - **Mediator** – the server routes between front-ends and Games.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – transport only; rules stay in Game.
+ */
+class ShmServer {
+public:
+    /// Creates the opponent for a newly connected front-end.
+    using ComputerFactory = std::function<std::shared_ptr<IPlayer>()>;
+
+    /**
+     * @brief Creates a server (not started).
+     * @param computerFactory Opponent per client (default: ComputerAI).
+     */
+    explicit ShmServer(ComputerFactory computerFactory = nullptr);
+
+    /** @brief Stops the server if running. */
+    ~ShmServer();
+
+    ShmServer(const ShmServer&) = delete;
+    ShmServer& operator=(const ShmServer&) = delete;
+
+    /**
+     * @brief Creates segment @p name (replacing a stale one) and starts
+     *        serving.
+     *
+     * A segment whose recorded server process is still alive is left
+     * untouched; only segments of dead servers are replaced.
+     * @param name Segment name, e.g. "/rsp" (a leading '/' is added).
+     * @return false if already running, another live server owns @p name,
+     *         or the segment could not be created.
+     */
+    bool start(const std::string& name);
+
+    /** @brief Stops serving, drops all clients and unlinks the segment. */
+    void stop();
+
+    /**
+     * @brief Feeds every played round to @p detector (nullptr to stop).
+     *        Call before start(); the detector is then used by the serve
+     *        thread only, so its alert callback runs there.
+     */
+    void setBotDetector(std::shared_ptr<BotDetector> detector);
+
+    /** @brief Returns the number of connected front-ends. */
+    std::size_t getClientCount() const;
+
+    /** @brief Returns the number of rounds played for all clients. */
+    std::uint64_t getRoundsServed() const;
+
+private:
+    struct Client {
+        std::shared_ptr<Combination> choice;
+        std::unique_ptr<Game> game;
+        std::int32_t pid = 0;
+        BotDetector::UserId botId = 0; ///< Per connection (slot generation).
+        std::chrono::steady_clock::time_point lastEventAt; ///< Last event pushed.
+    };
+
+    void serve();
+    bool serveSlot(std::size_t index);
+    bool handle(std::size_t index, const ShmRequest& request);
+    void release(std::size_t index);
+    void sweepDeadClients();
+
+    ComputerFactory computerFactory_;
+    std::shared_ptr<BotDetector> botDetector_;
+    std::string name_;
+    ShmSegment* segment_;
+    std::vector<Client> clients_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    std::atomic<std::size_t> clientCount_;
+    std::atomic<std::uint64_t> roundsServed_;
+};
+
+#endif // SHM_SERVER_H
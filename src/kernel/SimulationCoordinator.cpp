@@ -0,0 +1,263 @@
+#include "kernel/SimulationCoordinator.h"
+#include "kernel/Session.h"
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+std::size_t SimulationJob::getShardCount() const {
+    return strategies.size() * seeds.size();
+}
+
+SimulationCoordinator::SimulationCoordinator(CoordinatorConfig config)
+    : config_(config)
+{
+    if (config_.maxAttempts == 0) config_.maxAttempts = 1;
+}
+
+SessionSketch SimulationCoordinator::runShard(const SimulationJob& job, std::size_t shard) {
+    if (shard >= job.getShardCount()) {
+        throw std::out_of_range("SimulationCoordinator::runShard: no such shard");
+    }
+    const SimulationJob::Strategy& strategy = job.strategies[shard / job.seeds.size()];
+    const std::uint64_t seed = job.seeds[shard % job.seeds.size()];
+
+    SessionSketch sketch;
+    for (std::size_t s = 0; s < job.sessionsPerShard; ++s) {
+        Session session(strategy.make(seed, s), job.opponent(seed, s), job.roundsPerSession);
+        session.start();
+        sketch.record(session);
+    }
+    return sketch;
+}
+
+namespace {
+    void validate(const SimulationJob& job) {
+        if (job.strategies.empty() || job.seeds.empty() || !job.opponent) {
+            throw std::invalid_argument(
+                "SimulationCoordinator::run: job needs strategies, seeds and an opponent");
+        }
+        for (const auto& s : job.strategies) {
+            if (!s.make) {
+                throw std::invalid_argument("SimulationCoordinator::run: strategy without factory");
+            }
+        }
+    }
+}
+
+#if defined(_WIN32)
+
+SimulationResult SimulationCoordinator::run(const SimulationJob& job) {
+    validate(job);
+    SimulationResult result;
+    result.byStrategy.resize(job.strategies.size());
+    for (std::size_t shard = 0; shard < job.getShardCount(); ++shard) {
+        result.byStrategy[shard / job.seeds.size()].merge(runShard(job, shard));
+        ++result.shardsCompleted;
+    }
+    return result;
+}
+
+#else
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::uint64_t NO_SHARD = ~std::uint64_t{0};    ///< Request: exit.
+    constexpr std::uint64_t SHARD_FAILED = ~std::uint64_t{0}; ///< Reply length: shard threw.
+    constexpr std::uint64_t MAX_REPLY = 1 << 24;
+
+    bool sendAll(int fd, const void* data, std::size_t size) {
+        const auto* p = static_cast<const char*>(data);
+        while (size > 0) {
+            const ssize_t n = ::send(fd, p, size, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    bool recvAll(int fd, void* data, std::size_t size) {
+        auto* p = static_cast<char*>(data);
+        while (size > 0) {
+            const ssize_t n = ::recv(fd, p, size, 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    /// Body of a forked worker: serve shard requests until told to stop.
+    [[noreturn]] void workerMain(const SimulationJob& job, int fd) {
+        std::uint64_t shard = 0;
+        while (recvAll(fd, &shard, sizeof shard) && shard != NO_SHARD) {
+            std::vector<std::uint8_t> reply;
+            std::uint64_t length = SHARD_FAILED;
+            try {
+                reply = SimulationCoordinator::runShard(job, static_cast<std::size_t>(shard)).serialize();
+                length = reply.size();
+            } catch (const std::exception&) {
+                reply.clear();
+            }
+            if (!sendAll(fd, &shard, sizeof shard) || !sendAll(fd, &length, sizeof length) ||
+                !sendAll(fd, reply.data(), reply.size())) {
+                break;
+            }
+        }
+        ::_exit(0); // skip the parent's atexit handlers and static destructors
+    }
+
+    struct Worker {
+        pid_t pid = -1;
+        int fd = -1;
+        std::uint64_t shard = NO_SHARD; ///< In flight, or NO_SHARD when idle.
+        Clock::time_point assignedAt;
+    };
+}
+
+SimulationResult SimulationCoordinator::run(const SimulationJob& job) {
+    validate(job);
+    const std::size_t shards = job.getShardCount();
+
+    SimulationResult result;
+    result.byStrategy.resize(job.strategies.size());
+
+    unsigned poolSize = config_.workers ? config_.workers
+                                        : std::max(1u, std::thread::hardware_concurrency());
+    poolSize = static_cast<unsigned>(std::min<std::size_t>(poolSize, shards));
+
+    std::deque<std::size_t> pending;
+    for (std::size_t s = 0; s < shards; ++s) pending.push_back(s);
+    std::vector<unsigned> attempts(shards, 0);
+    std::vector<Worker> workers;
+    std::size_t done = 0;
+
+    auto spawn = [&]() -> bool {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) return false;
+        const pid_t pid = ::fork();
+        if (pid < 0) {
+            ::close(fds[0]);
+            ::close(fds[1]);
+            return false;
+        }
+        if (pid == 0) {
+            ::close(fds[0]);
+            for (const Worker& w : workers) ::close(w.fd); // siblings' sockets
+            workerMain(job, fds[1]);
+        }
+        ::close(fds[1]);
+        Worker w;
+        w.pid = pid;
+        w.fd = fds[0];
+        workers.push_back(w);
+        ++result.workersStarted;
+        return true;
+    };
+
+    // The in-flight shard of @p w failed: retry it or give up on it.
+    auto requeue = [&](Worker& w) {
+        const auto shard = static_cast<std::size_t>(w.shard);
+        w.shard = NO_SHARD;
+        if (attempts[shard] < config_.maxAttempts) {
+            ++result.shardsRetried;
+            pending.push_front(shard);
+        } else {
+            result.failedShards.push_back(shard);
+            ++done;
+        }
+    };
+
+    auto bury = [&](std::size_t index) {
+        Worker& w = workers[index];
+        ::close(w.fd);
+        ::kill(w.pid, SIGKILL); // no-op if it already exited
+        while (::waitpid(w.pid, nullptr, 0) < 0 && errno == EINTR) {}
+        ++result.workersLost;
+        if (w.shard != NO_SHARD) requeue(w);
+        workers.erase(workers.begin() + static_cast<std::ptrdiff_t>(index));
+    };
+
+    for (unsigned i = 0; i < poolSize; ++i) spawn();
+
+    while (done < shards) {
+        // Replace lost workers while there is work for them.
+        while (workers.size() < poolSize && !pending.empty() && spawn()) {}
+        if (workers.empty()) break; // cannot fork at all
+
+        for (std::size_t i = 0; i < workers.size(); ++i) {
+            Worker& w = workers[i];
+            if (w.shard != NO_SHARD || pending.empty()) continue;
+            w.shard = pending.front();
+            pending.pop_front();
+            ++attempts[static_cast<std::size_t>(w.shard)];
+            w.assignedAt = Clock::now();
+            if (!sendAll(w.fd, &w.shard, sizeof w.shard)) {
+                bury(i--);
+            }
+        }
+
+        std::vector<pollfd> fds;
+        for (const Worker& w : workers) fds.push_back({w.fd, POLLIN, 0});
+        if (fds.empty()) continue;
+        const int timeout = config_.shardTimeout.count() > 0 ? 50 : -1;
+        if (::poll(fds.data(), fds.size(), timeout) < 0 && errno != EINTR) break;
+
+        const auto now = Clock::now();
+        for (std::size_t i = fds.size(); i-- > 0;) {
+            Worker& w = workers[i];
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR))) {
+                if (w.shard != NO_SHARD && config_.shardTimeout.count() > 0 &&
+                    now - w.assignedAt > config_.shardTimeout) {
+                    bury(i); // hung
+                }
+                continue;
+            }
+
+            std::uint64_t shard = 0, length = 0;
+            if (!recvAll(w.fd, &shard, sizeof shard) || !recvAll(w.fd, &length, sizeof length) ||
+                shard != w.shard || (length != SHARD_FAILED && length > MAX_REPLY)) {
+                bury(i); // crashed or spoke garbage
+                continue;
+            }
+            if (length == SHARD_FAILED) {
+                requeue(w);
+                continue;
+            }
+            std::vector<std::uint8_t> reply(static_cast<std::size_t>(length));
+            SessionSketch sketch;
+            if (!recvAll(w.fd, reply.data(), reply.size()) || !sketch.deserialize(reply)) {
+                bury(i);
+                continue;
+            }
+            result.byStrategy[static_cast<std::size_t>(shard) / job.seeds.size()].merge(sketch);
+            ++result.shardsCompleted;
+            ++done;
+            w.shard = NO_SHARD;
+        }
+    }
+
+    for (Worker& w : workers) {
+        sendAll(w.fd, &NO_SHARD, sizeof NO_SHARD);
+        ::close(w.fd);
+        while (::waitpid(w.pid, nullptr, 0) < 0 && errno == EINTR) {}
+    }
+    for (std::size_t shard : pending) result.failedShards.push_back(shard); // only if fork failed
+    std::sort(result.failedShards.begin(), result.failedShards.end());
+    return result;
+}
+
+#endif
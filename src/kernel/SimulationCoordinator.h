@@ -0,0 +1,124 @@
+#ifndef SIMULATION_COORDINATOR_H
+#define SIMULATION_COORDINATOR_H
+
+#include "IPlayer.h"
+#include "SessionStats.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @file SimulationCoordinator.h
+ * @brief Runs a strategy sweep on a pool of forked worker processes.
+ *
+ * A SimulationJob is the cross product strategies × seeds; each
+ * (strategy, seed) pair is one shard of @c sessionsPerShard Sessions
+ * against the job's opponent.  The coordinator forks worker processes,
+ * each connected by a Unix socket pair, hands out shard indices one at
+ * a time and merges the SessionSketch each worker sends back (see
+ * SessionStats.h) into one sketch per strategy.
+ *
+ * Workers are disposable:
+ * - if a worker dies (crash, kill, OOM) the coordinator sees EOF on its
+ *   socket, reaps it, requeues its in-flight shard and forks a
+ *   replacement;
+ * - a worker that exceeds CoordinatorConfig::shardTimeout is killed and
+ *   handled the same way;
+ * - a shard that fails CoordinatorConfig::maxAttempts times is reported
+ *   in SimulationResult::failedShards instead of sinking the job.
+ *
+ * Only shard numbers and serialized sketches cross the socket, so the
+ * protocol does not depend on sharing an address space; workers rely on
+ * fork() only to inherit the job's factories.  Call run() before
+ * starting other threads that might hold locks during fork().
+ *
+ * POSIX only; elsewhere run() evaluates every shard in-process.
+ *
+ * @par Design Patterns
+ * - **Master / Worker** – the coordinator owns the queue, workers are
+ *   stateless.
+ * - **Abstract Factory (light)** – players come from the job's factories.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – scheduling and fault handling only;
+ *   match rules stay in Session, aggregation in SessionSketch.
+ */
+
+/**
+ * @brief A sweep: every strategy against the opponent for every seed.
+ */
+struct SimulationJob {
+    /** @brief Creates the player for session @p session of seed @p seed. */
+    using PlayerFactory =
+        std::function<std::shared_ptr<IPlayer>(std::uint64_t seed, std::uint64_t session)>;
+
+    /** @brief One strategy under test. */
+    struct Strategy {
+        std::string name;
+        PlayerFactory make;
+    };
+
+    std::vector<Strategy> strategies;  ///< Played as the user.
+    PlayerFactory opponent;            ///< Played as the computer.
+    std::vector<std::uint64_t> seeds;  ///< One shard per strategy and seed.
+    std::size_t sessionsPerShard = 10;
+    std::int64_t roundsPerSession = 100;
+
+    /** @brief Returns strategies.size() × seeds.size(). */
+    std::size_t getShardCount() const;
+};
+
+/**
+ * @brief Worker pool and retry policy.
+ */
+struct CoordinatorConfig {
+    unsigned workers     = 0; ///< Worker processes (0 = hardware concurrency).
+    unsigned maxAttempts = 3; ///< Tries per shard before giving up on it.
+    std::chrono::milliseconds shardTimeout{0}; ///< Per shard; 0 = no limit.
+};
+
+/**
+ * @brief Merged outcome of a job.
+ */
+struct SimulationResult {
+    std::vector<SessionSketch> byStrategy; ///< Indexed like SimulationJob::strategies.
+    std::size_t shardsCompleted = 0;
+    std::size_t shardsRetried = 0;         ///< Attempts that had to be repeated.
+    std::vector<std::size_t> failedShards; ///< Gave up after maxAttempts.
+    unsigned workersStarted = 0;           ///< Including replacements.
+    unsigned workersLost = 0;              ///< Crashed or killed.
+};
+
+/**
+ * @class SimulationCoordinator
+ * @brief Partitions a SimulationJob over forked workers and merges results.
+ */
+class SimulationCoordinator {
+public:
+    /** @brief Creates a coordinator with @p config. */
+    explicit SimulationCoordinator(CoordinatorConfig config = {});
+
+    /**
+     * @brief Runs every shard of @p job and merges the results.
+     * @throws std::invalid_argument if the job has no strategies, seeds
+     *         or opponent.
+     */
+    SimulationResult run(const SimulationJob& job);
+
+    /**
+     * @brief Plays shard @p shard in the calling process.
+     *
+     * Shard s is strategy s / seeds.size() with seed s % seeds.size().
+     * @throws std::out_of_range if @p shard is not in the job.
+     */
+    static SessionSketch runShard(const SimulationJob& job, std::size_t shard);
+
+private:
+    CoordinatorConfig config_;
+};
+
+#endif // SIMULATION_COORDINATOR_H
@@ -0,0 +1,164 @@
+#include "kernel/StrategyEvolver.h"
+#include "kernel/Session.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+StrategyEvolver::StrategyEvolver(const EvolverConfig& config,
+                                 std::vector<PlayerFactory> referencePool)
+    : config_(config)
+    , pool_(std::move(referencePool))
+    , evaluated_(false)
+    , generation_(0)
+    , rng_(config.seed)
+{
+    if (pool_.empty()) {
+        throw std::invalid_argument("StrategyEvolver needs a reference pool");
+    }
+    if (config_.populationSize == 0 || config_.states == 0 || config_.states > 256 ||
+        config_.eliteCount > config_.populationSize || config_.roundsPerMatch <= 0) {
+        throw std::invalid_argument("Invalid EvolverConfig");
+    }
+    config_.tournamentSize = std::max<std::size_t>(config_.tournamentSize, 1);
+
+    genes_.resize(config_.populationSize * genomeSize());
+    scratch_.resize(genes_.size());
+    fitness_.assign(config_.populationSize, 0.0);
+
+    std::uniform_int_distribution<int> gesture(0, 2);
+    std::uniform_int_distribution<std::size_t> state(0, config_.states - 1);
+    for (std::size_t i = 0; i < genes_.size(); ++i) {
+        const bool isOutput = (i % FsmStrategy::GENES_PER_STATE) == 0;
+        genes_[i] = static_cast<std::uint8_t>(isOutput ? gesture(rng_) : state(rng_));
+    }
+}
+
+std::size_t StrategyEvolver::genomeSize() const {
+    return config_.states * FsmStrategy::GENES_PER_STATE;
+}
+
+double StrategyEvolver::evaluateOne(std::size_t index) const {
+    auto fsm = std::make_shared<FsmStrategy>(getGenome(index), config_.states);
+    long long net = 0;
+    for (const PlayerFactory& make : pool_) {
+        fsm->reset();
+        Session match(fsm, make(), config_.roundsPerMatch);
+        match.start();
+        net += match.getUserScore() - match.getComputerScore();
+    }
+    return static_cast<double>(net) /
+           (static_cast<double>(config_.roundsPerMatch) * static_cast<double>(pool_.size()));
+}
+
+void StrategyEvolver::evaluate() {
+    const std::size_t n = config_.populationSize;
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < n; i = next++) {
+            fitness_[i] = evaluateOne(i);
+        }
+    };
+
+    unsigned threads = config_.threads ? config_.threads : std::thread::hardware_concurrency();
+    threads = std::max(1u, std::min<unsigned>(threads, static_cast<unsigned>(n)));
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) workers.emplace_back(worker);
+    worker();
+    for (auto& w : workers) w.join();
+
+    evaluated_ = true;
+}
+
+std::size_t StrategyEvolver::tournament() {
+    std::uniform_int_distribution<std::size_t> pick(0, config_.populationSize - 1);
+    std::size_t best = pick(rng_);
+    for (std::size_t k = 1; k < config_.tournamentSize; ++k) {
+        std::size_t c = pick(rng_);
+        if (fitness_[c] > fitness_[best]) best = c;
+    }
+    return best;
+}
+
+void StrategyEvolver::step() {
+    if (!evaluated_) evaluate();
+
+    const std::size_t n = config_.populationSize;
+    const std::size_t g = genomeSize();
+
+    // Elitism: copy the best individuals unchanged.
+    std::vector<std::size_t> order(n);
+    for (std::size_t i = 0; i < n; ++i) order[i] = i;
+    std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(config_.eliteCount),
+                      order.end(),
+                      [this](std::size_t a, std::size_t b) { return fitness_[a] > fitness_[b]; });
+    for (std::size_t e = 0; e < config_.eliteCount; ++e) {
+        std::memcpy(&scratch_[e * g], &genes_[order[e] * g], g);
+    }
+
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::uniform_int_distribution<std::size_t> cutState(1, std::max<std::size_t>(config_.states - 1, 1));
+    std::uniform_int_distribution<int> gesture(0, 2);
+    std::uniform_int_distribution<std::size_t> state(0, config_.states - 1);
+
+    for (std::size_t i = config_.eliteCount; i < n; ++i) {
+        std::uint8_t* child = &scratch_[i * g];
+        const std::uint8_t* a = &genes_[tournament() * g];
+        const std::uint8_t* b = &genes_[tournament() * g];
+
+        // One-point crossover at a state boundary.
+        std::size_t cut = g;
+        if (config_.states > 1 && coin(rng_) < config_.crossoverRate) {
+            cut = cutState(rng_) * FsmStrategy::GENES_PER_STATE;
+        }
+        std::memcpy(child, a, cut);
+        std::memcpy(child + cut, b + cut, g - cut);
+
+        // Per-gene mutation to another valid value.
+        for (std::size_t k = 0; k < g; ++k) {
+            if (coin(rng_) < config_.mutationRate) {
+                const bool isOutput = (k % FsmStrategy::GENES_PER_STATE) == 0;
+                child[k] = static_cast<std::uint8_t>(isOutput ? gesture(rng_) : state(rng_));
+            }
+        }
+    }
+
+    genes_.swap(scratch_);
+    evaluated_ = false;
+    ++generation_;
+}
+
+void StrategyEvolver::run(std::size_t generations) {
+    for (std::size_t i = 0; i < generations; ++i) step();
+    evaluate();
+}
+
+std::size_t StrategyEvolver::getGeneration() const {
+    return generation_;
+}
+
+const std::vector<double>& StrategyEvolver::getFitness() const {
+    return fitness_;
+}
+
+std::size_t StrategyEvolver::bestIndex() const {
+    return static_cast<std::size_t>(
+        std::max_element(fitness_.begin(), fitness_.end()) - fitness_.begin());
+}
+
+double StrategyEvolver::getBestFitness() const {
+    return fitness_[bestIndex()];
+}
+
+const std::uint8_t* StrategyEvolver::getGenome(std::size_t index) const {
+    if (index >= config_.populationSize) {
+        throw std::out_of_range("Individual index out of range");
+    }
+    return &genes_[index * genomeSize()];
+}
+
+std::shared_ptr<FsmStrategy> StrategyEvolver::makeBest(const std::string& name) const {
+    const std::uint8_t* g = getGenome(bestIndex());
+    return std::make_shared<FsmStrategy>(std::vector<std::uint8_t>(g, g + genomeSize()), name);
+}
@@ -0,0 +1,114 @@
+#ifndef STRATEGY_EVOLVER_H
+#define STRATEGY_EVOLVER_H
+
+#include "FsmStrategy.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+/**
+ * @file StrategyEvolver.h
+ * @brief Genetic search for strong finite-state-machine strategies.
+ *
+ * The population is a single flat byte array (individual-major, one
+ * FsmStrategy genome after another), so breeding is a handful of
+ * memcpy's and evaluation reads genes in place through FsmStrategy's
+ * view mode.
+ *
+ * Fitness is the mean score – (wins − losses) / rounds – of a batch of
+ * Sessions against every player of a reference pool.  Individuals are
+ * evaluated in parallel on a pool of worker threads; each evaluation
+ * asks the pool factories for fresh opponents so no player state is
+ * shared between threads.
+ *
+ * Each generation keeps the best individuals unchanged (elitism) and
+ * fills the rest by tournament selection, one-point crossover at state
+ * boundaries, and per-gene mutation.
+ *
+ * @par Design Patterns
+ * - **Abstract Factory (light)** – opponents come from PlayerFactory.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – search only; FSM semantics live in
+ *   FsmStrategy and match rules in Session.
+ */
+
+/**
+ * @brief Tuning knobs of the genetic search.
+ */
+struct EvolverConfig {
+    std::size_t populationSize = 64;   ///< Individuals per generation.
+    std::size_t states         = 8;    ///< FSM states per individual.
+    std::size_t eliteCount     = 4;    ///< Best individuals copied as-is.
+    std::size_t tournamentSize = 3;    ///< Contestants per selection.
+    double      crossoverRate  = 0.9;  ///< Probability of crossover.
+    double      mutationRate   = 0.02; ///< Per-gene mutation probability.
+    int         roundsPerMatch = 100;  ///< Rounds per evaluation Session.
+    unsigned    threads        = 0;    ///< Worker threads (0 = hardware).
+    std::uint64_t seed         = 1;    ///< Seed for the search RNG.
+};
+
+/**
+ * @class StrategyEvolver
+ * @brief Evolves a population of FSM genomes against a reference pool.
+ */
+class StrategyEvolver {
+public:
+    /** @brief Creates a fresh opponent for one evaluation. */
+    using PlayerFactory = std::function<std::shared_ptr<IPlayer>()>;
+
+    /**
+     * @brief Constructs the evolver with a random initial population.
+     * @param config        Search parameters.
+     * @param referencePool Opponent factories used for fitness.
+     * @throws std::invalid_argument if the pool is empty or the
+     *         configuration is inconsistent.
+     */
+    StrategyEvolver(const EvolverConfig& config, std::vector<PlayerFactory> referencePool);
+
+    /** @brief Computes the fitness of every individual (in parallel). */
+    void evaluate();
+
+    /**
+     * @brief Advances one generation: evaluate (if needed) and breed.
+     */
+    void step();
+
+    /** @brief Runs @p generations steps, then evaluates the result. */
+    void run(std::size_t generations);
+
+    /** @brief Returns the number of generations bred so far. */
+    std::size_t getGeneration() const;
+
+    /** @brief Returns the fitness of each individual (after evaluate()). */
+    const std::vector<double>& getFitness() const;
+
+    /** @brief Returns the best fitness of the current population. */
+    double getBestFitness() const;
+
+    /** @brief Returns the genome bytes of individual @p index. */
+    const std::uint8_t* getGenome(std::size_t index) const;
+
+    /** @brief Builds an owning FsmStrategy from the best individual. */
+    std::shared_ptr<FsmStrategy> makeBest(const std::string& name = "EvolvedFSM") const;
+
+private:
+    std::size_t genomeSize() const;
+    std::size_t bestIndex() const;
+    std::size_t tournament();
+    double evaluateOne(std::size_t index) const;
+
+    EvolverConfig config_;
+    std::vector<PlayerFactory> pool_;
+    std::vector<std::uint8_t> genes_;   ///< populationSize × genomeSize bytes.
+    std::vector<std::uint8_t> scratch_; ///< Next generation being bred.
+    std::vector<double> fitness_;
+    bool evaluated_;
+    std::size_t generation_;
+    std::mt19937_64 rng_;
+};
+
+#endif // STRATEGY_EVOLVER_H
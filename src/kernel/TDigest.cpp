@@ -0,0 +1,211 @@
+#include "kernel/TDigest.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+    constexpr double PI = 3.14159265358979323846;
+
+    template <typename T>
+    void put(std::vector<std::uint8_t>& out, T value) {
+        const auto* p = reinterpret_cast<const std::uint8_t*>(&value);
+        out.insert(out.end(), p, p + sizeof(T));
+    }
+
+    template <typename T>
+    bool get(const std::vector<std::uint8_t>& in, std::size_t& pos, T& value) {
+        if (pos > in.size() || in.size() - pos < sizeof(T)) return false;
+        std::memcpy(&value, in.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+}
+
+TDigest::TDigest(double compression)
+    : compression_(std::min(std::max(compression, 10.0), MAX_COMPRESSION))
+    , count_(0.0)
+    , min_(std::numeric_limits<double>::infinity())
+    , max_(-std::numeric_limits<double>::infinity())
+{
+    centroids_.reserve(static_cast<std::size_t>(compression_) * 2);
+    buffer_.reserve(static_cast<std::size_t>(compression_) * 5);
+}
+
+void TDigest::add(double value, double weight) {
+    if (!(weight > 0.0) || std::isnan(value)) return;
+    buffer_.push_back({value, weight});
+    count_ += weight;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    if (buffer_.size() >= buffer_.capacity()) compress();
+}
+
+void TDigest::merge(const TDigest& other) {
+    if (other.count_ <= 0.0) return;
+    other.compress();
+    for (const Centroid& c : other.centroids_) {
+        buffer_.push_back(c);
+        if (buffer_.size() >= buffer_.capacity()) compress();
+    }
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+void TDigest::reset() {
+    centroids_.clear();
+    buffer_.clear();
+    count_ = 0.0;
+    min_ = std::numeric_limits<double>::infinity();
+    max_ = -std::numeric_limits<double>::infinity();
+}
+
+void TDigest::compress() const {
+    if (buffer_.empty()) return;
+    buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+    std::sort(buffer_.begin(), buffer_.end(),
+              [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+
+    double total = 0.0;
+    for (const Centroid& c : buffer_) total += c.weight;
+    auto k = [this, total](double w) {
+        return compression_ / (2.0 * PI) * std::asin(2.0 * std::min(1.0, w / total) - 1.0);
+    };
+
+    centroids_.clear();
+    Centroid current = buffer_[0];
+    double before = 0.0; // weight left of current
+    for (std::size_t i = 1; i < buffer_.size(); ++i) {
+        const Centroid& next = buffer_[i];
+        const double proposed = current.weight + next.weight;
+        if (k(before + proposed) - k(before) <= 1.0) {
+            current.mean += (next.mean - current.mean) * next.weight / proposed;
+            current.weight = proposed;
+        } else {
+            centroids_.push_back(current);
+            before += current.weight;
+            current = next;
+        }
+    }
+    centroids_.push_back(current);
+    buffer_.clear();
+}
+
+double TDigest::quantile(double q) const {
+    compress();
+    if (centroids_.empty()) return 0.0;
+    q = std::min(1.0, std::max(0.0, q));
+    const double total = count_;
+    const double target = q * total;
+
+    const Centroid& first = centroids_.front();
+    if (target < first.weight / 2.0) {
+        const double t = first.weight > 1.0 ? target / (first.weight / 2.0) : 1.0;
+        return min_ + (first.mean - min_) * t;
+    }
+    const Centroid& last = centroids_.back();
+    if (target > total - last.weight / 2.0) {
+        const double t = last.weight > 1.0 ? (total - target) / (last.weight / 2.0) : 1.0;
+        return max_ - (max_ - last.mean) * t;
+    }
+
+    double cumulative = first.weight / 2.0; // position of the current centre
+    for (std::size_t i = 0; i + 1 < centroids_.size(); ++i) {
+        const Centroid& a = centroids_[i];
+        const Centroid& b = centroids_[i + 1];
+        const double gap = (a.weight + b.weight) / 2.0;
+        if (target <= cumulative + gap) {
+            return a.mean + (b.mean - a.mean) * (target - cumulative) / gap;
+        }
+        cumulative += gap;
+    }
+    return last.mean;
+}
+
+double TDigest::cdf(double value) const {
+    compress();
+    if (centroids_.empty()) return 0.0;
+    if (value < min_) return 0.0;
+    if (value >= max_) return 1.0;
+
+    const double total = count_;
+    const Centroid& first = centroids_.front();
+    if (value < first.mean) {
+        const double span = first.mean - min_;
+        return span > 0 ? (first.weight / 2.0) * (value - min_) / span / total : 0.0;
+    }
+    double cumulative = first.weight / 2.0;
+    for (std::size_t i = 0; i + 1 < centroids_.size(); ++i) {
+        const Centroid& a = centroids_[i];
+        const Centroid& b = centroids_[i + 1];
+        const double gap = (a.weight + b.weight) / 2.0;
+        if (value < b.mean) {
+            const double span = b.mean - a.mean;
+            return (cumulative + (span > 0 ? gap * (value - a.mean) / span : 0.0)) / total;
+        }
+        cumulative += gap;
+    }
+    const Centroid& last = centroids_.back();
+    const double span = max_ - last.mean;
+    return (cumulative + (span > 0 ? (last.weight / 2.0) * (value - last.mean) / span : 0.0)) / total;
+}
+
+double TDigest::getCount() const {
+    return count_;
+}
+
+double TDigest::getMin() const {
+    return count_ > 0 ? min_ : 0.0;
+}
+
+double TDigest::getMax() const {
+    return count_ > 0 ? max_ : 0.0;
+}
+
+std::size_t TDigest::getCentroidCount() const {
+    compress();
+    return centroids_.size();
+}
+
+void TDigest::serialize(std::vector<std::uint8_t>& out) const {
+    compress();
+    put(out, compression_);
+    put(out, count_);
+    put(out, min_);
+    put(out, max_);
+    put(out, static_cast<std::uint32_t>(centroids_.size()));
+    for (const Centroid& c : centroids_) {
+        put(out, c.mean);
+        put(out, c.weight);
+    }
+}
+
+bool TDigest::deserialize(const std::vector<std::uint8_t>& in, std::size_t& pos) {
+    std::size_t p = pos;
+    double compression = 0, count = 0, lo = 0, hi = 0;
+    std::uint32_t n = 0;
+    if (!get(in, p, compression) || !get(in, p, count) || !get(in, p, lo) ||
+        !get(in, p, hi) || !get(in, p, n) || !(compression >= 10.0) ||
+        !(compression <= MAX_COMPRESSION) ||
+        static_cast<std::size_t>(n) * 2 * sizeof(double) > in.size() - p) {
+        return false;
+    }
+    std::vector<Centroid> centroids(n);
+    double weight = 0.0;
+    for (Centroid& c : centroids) {
+        get(in, p, c.mean);
+        get(in, p, c.weight);
+        if (!(c.weight > 0.0)) return false;
+        weight += c.weight;
+    }
+    if (std::fabs(weight - count) > 1e-6 * std::max(1.0, count)) return false;
+
+    *this = TDigest(compression);
+    centroids_ = std::move(centroids);
+    count_ = count;
+    min_ = lo;
+    max_ = hi;
+    pos = p;
+    return true;
+}
@@ -0,0 +1,101 @@
+#ifndef TDIGEST_H
+#define TDIGEST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file TDigest.h
+ * @brief Mergeable quantile sketch (merging t-digest).
+ *
+ * Values are summarised by at most ~compression centroids (mean,
+ * weight).  Centroids near the tails stay small and those near the
+ * median grow large – the k1 scale function k(q) = δ/2π · asin(2q − 1)
+ * bounds every centroid to one unit of k – so extreme quantiles stay
+ * accurate to a fraction of a percent while the sketch has a fixed size
+ * independent of the number of values.
+ *
+ * New values go to an unsorted buffer that is folded in when full.
+ * merge() appends the other digest's centroids to that buffer, so
+ * combining two digests costs O(compression) regardless of how many
+ * values either has seen.
+ *
+ * Based on T. Dunning and O. Ertl, "Computing Extremely Accurate
+ * Quantiles Using t-Digests" (2019).
+ *
+ * @par Design Patterns
+ * - **Value Object** – copyable and mergeable.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – distribution summary only.
+ */
+class TDigest {
+public:
+    /** @brief Default compression: ~100 centroids, < 1 % quantile error. */
+    static constexpr double DEFAULT_COMPRESSION = 100.0;
+
+    /** @brief Largest accepted compression (bounds the buffers reserved). */
+    static constexpr double MAX_COMPRESSION = 10000.0;
+
+    /**
+     * @brief Creates an empty digest.
+     * @param compression δ, clamped to [10, MAX_COMPRESSION]; the centroid
+     *                    count stays below about δ.
+     */
+    explicit TDigest(double compression = DEFAULT_COMPRESSION);
+
+    /** @brief Adds @p value with weight @p weight (> 0). */
+    void add(double value, double weight = 1.0);
+
+    /** @brief Adds every value summarised by @p other. */
+    void merge(const TDigest& other);
+
+    /** @brief Removes all values. */
+    void reset();
+
+    /** @brief Returns the estimated value at quantile @p q (0..1); 0 if empty. */
+    double quantile(double q) const;
+
+    /** @brief Returns the estimated fraction of values ≤ @p value. */
+    double cdf(double value) const;
+
+    /** @brief Returns the total weight added. */
+    double getCount() const;
+
+    /** @brief Returns the smallest value added (0 if empty). */
+    double getMin() const;
+
+    /** @brief Returns the largest value added (0 if empty). */
+    double getMax() const;
+
+    /** @brief Returns the number of centroids after compression. */
+    std::size_t getCentroidCount() const;
+
+    /** @brief Appends a portable encoding of the digest to @p out. */
+    void serialize(std::vector<std::uint8_t>& out) const;
+
+    /**
+     * @brief Decodes a digest written by serialize() at @p pos.
+     * @return false (digest unchanged) if the data is truncated or invalid,
+     *         including a compression above MAX_COMPRESSION.
+     */
+    bool deserialize(const std::vector<std::uint8_t>& in, std::size_t& pos);
+
+private:
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+    void compress() const;
+
+    double compression_;
+    mutable std::vector<Centroid> centroids_; ///< Sorted, compressed.
+    mutable std::vector<Centroid> buffer_;    ///< Pending, unsorted.
+    double count_;
+    double min_;
+    double max_;
+};
+
+#endif // TDIGEST_H
@@ -0,0 +1,201 @@
+#include "kernel/Tracer.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    const char* category;
+    std::int64_t startNs;
+    std::int64_t durNs;
+};
+
+/// Single-producer (owning thread) / single-consumer (flusher) ring.
+struct ThreadBuffer {
+    static constexpr std::size_t CAPACITY = 8192; // power of two
+
+    std::uint32_t tid = 0;
+    bool named = false;                 ///< Metadata event written (flusher only).
+    std::atomic<bool> alive{true};      ///< False once the thread exited.
+    std::atomic<std::uint64_t> head{0}; ///< Next slot to write (producer).
+    std::atomic<std::uint64_t> tail{0}; ///< Next slot to read (consumer).
+    std::array<TraceEvent, CAPACITY> ring{};
+};
+
+struct TracerState {
+    std::mutex mutex;                                ///< Guards everything below.
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::uint32_t nextTid = 1;
+
+    std::FILE* file = nullptr;
+    bool firstEvent = true;
+    std::int64_t originNs = 0;
+
+    std::thread flusher;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    std::atomic<bool> enabled{false};
+    std::atomic<std::uint64_t> dropped{0};
+};
+
+TracerState& state() {
+    static TracerState s;
+    return s;
+}
+
+/// Owned by the thread; marks its ring dead so the flusher can drop it.
+struct ThreadHandle {
+    std::shared_ptr<ThreadBuffer> buffer;
+    ~ThreadHandle() {
+        if (buffer) buffer->alive.store(false, std::memory_order_release);
+    }
+};
+
+ThreadBuffer& threadBuffer() {
+    static thread_local ThreadHandle handle;
+    if (!handle.buffer) {
+        auto buf = std::make_shared<ThreadBuffer>();
+        TracerState& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        buf->tid = s.nextTid++;
+        s.buffers.push_back(buf);
+        handle.buffer = std::move(buf);
+    }
+    return *handle.buffer;
+}
+
+void writeSeparator(TracerState& s) {
+    std::fputs(s.firstEvent ? "\n" : ",\n", s.file);
+    s.firstEvent = false;
+}
+
+/// Drains every ring into the file.  Caller holds s.mutex.
+void drainLocked(TracerState& s) {
+    for (auto it = s.buffers.begin(); it != s.buffers.end();) {
+        ThreadBuffer& b = **it;
+        if (!b.named) {
+            writeSeparator(s);
+            std::fprintf(s.file,
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                "\"args\":{\"name\":\"thread-%u\"}}", b.tid, b.tid);
+            b.named = true;
+        }
+        const std::uint64_t head = b.head.load(std::memory_order_acquire);
+        std::uint64_t tail = b.tail.load(std::memory_order_relaxed);
+        for (; tail < head; ++tail) {
+            const TraceEvent& e = b.ring[tail & (ThreadBuffer::CAPACITY - 1)];
+            writeSeparator(s);
+            std::fprintf(s.file,
+                "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                "\"pid\":1,\"tid\":%u}",
+                e.name, e.category,
+                static_cast<double>(e.startNs - s.originNs) / 1000.0,
+                static_cast<double>(e.durNs) / 1000.0, b.tid);
+        }
+        b.tail.store(tail, std::memory_order_release);
+
+        if (!b.alive.load(std::memory_order_acquire) &&
+            b.head.load(std::memory_order_acquire) == tail) {
+            it = s.buffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    std::fflush(s.file);
+}
+
+} // namespace
+
+std::int64_t Tracer::nowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool Tracer::isEnabled() noexcept {
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Tracer::getDroppedCount() noexcept {
+    return state().dropped.load(std::memory_order_relaxed);
+}
+
+void Tracer::record(const char* name, const char* category,
+                    std::int64_t startNs, std::int64_t durNs) noexcept {
+    TracerState& s = state();
+    if (!s.enabled.load(std::memory_order_relaxed)) return;
+
+    ThreadBuffer* b;
+    try {
+        b = &threadBuffer();
+    } catch (...) {
+        s.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    const std::uint64_t head = b->head.load(std::memory_order_relaxed);
+    if (head - b->tail.load(std::memory_order_acquire) >= ThreadBuffer::CAPACITY) {
+        s.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    b->ring[head & (ThreadBuffer::CAPACITY - 1)] = {name, category, startNs, durNs};
+    b->head.store(head + 1, std::memory_order_release);
+}
+
+bool Tracer::start(const std::string& path, std::chrono::milliseconds flushInterval) {
+    TracerState& s = state();
+    std::unique_lock<std::mutex> lock(s.mutex);
+    if (s.file) return false;
+
+    s.file = std::fopen(path.c_str(), "w");
+    if (!s.file) return false;
+    std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", s.file);
+    s.firstEvent = true;
+    s.originNs = nowNs();
+    s.stopping = false;
+    s.dropped.store(0, std::memory_order_relaxed);
+
+    // Discard anything left over from a previous trace.
+    for (auto& b : s.buffers) {
+        b->tail.store(b->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+        b->named = false;
+    }
+
+    s.flusher = std::thread([&s, flushInterval]() {
+        std::unique_lock<std::mutex> lk(s.mutex);
+        while (!s.stopping) {
+            s.wake.wait_for(lk, flushInterval);
+            drainLocked(s);
+        }
+    });
+    s.enabled.store(true, std::memory_order_release);
+    return true;
+}
+
+void Tracer::stop() {
+    TracerState& s = state();
+    std::thread flusher;
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        // Only the first of concurrent stop() calls takes the flusher and
+        // finishes the file; the others return at once.
+        if (!s.file || !s.flusher.joinable()) return;
+        s.enabled.store(false, std::memory_order_release);
+        s.stopping = true;
+        flusher = std::move(s.flusher);
+    }
+    s.wake.notify_all();
+    flusher.join();
+
+    std::lock_guard<std::mutex> lock(s.mutex);
+    drainLocked(s);
+    std::fputs("\n]}\n", s.file);
+    std::fclose(s.file);
+    s.file = nullptr;
+}
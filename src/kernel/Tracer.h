@@ -0,0 +1,101 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/**
+ * @file Tracer.h
+ * @brief Optional Chrome / Perfetto trace-event recording.
+ *
+ * When started, the kernel records "complete" events (name, category,
+ * start, duration, thread id) for Game::newSession, each phase of
+ * Session::playRound, player chooseHand calls and callbacks.  Load the
+ * resulting JSON in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Each thread appends to its own fixed-size single-producer ring, so
+ * recording takes no lock and never allocates after the thread's first
+ * event.  A background thread drains the rings into the file.  If a
+ * ring is full the event is dropped and counted (getDroppedCount()).
+ *
+ * While stopped, a TraceScope costs one relaxed atomic load.
+ *
+ * @par Design Patterns
+ * - **RAII** – TraceScope measures its own lifetime.
+ * - **Producer / Consumer** – per-thread rings + one flusher.
+ *
+ * @par SOLID
+ * - **Single Responsibility** – recording and serialisation only.
+ */
+class Tracer {
+public:
+    /**
+     * @brief Starts tracing into @p path (overwritten).
+     * @param path          Output JSON file.
+     * @param flushInterval How often the background thread drains rings.
+     * @return false if already tracing or the file cannot be opened.
+     */
+    static bool start(const std::string& path,
+                      std::chrono::milliseconds flushInterval = std::chrono::milliseconds(50));
+
+    /**
+     * @brief Stops tracing, drains all rings and closes the file.
+     *
+     * Safe to call concurrently: one caller finishes the file, the others
+     * return immediately.
+     */
+    static void stop();
+
+    /** @brief Returns true while tracing. */
+    static bool isEnabled() noexcept;
+
+    /**
+     * @brief Records one complete event on the calling thread.
+     * @param name     Event name; must have static storage duration.
+     * @param category Event category; must have static storage duration.
+     * @param startNs  Start time from nowNs().
+     * @param durNs    Duration in nanoseconds.
+     */
+    static void record(const char* name, const char* category,
+                       std::int64_t startNs, std::int64_t durNs) noexcept;
+
+    /** @brief Returns the number of events dropped because a ring was full. */
+    static std::uint64_t getDroppedCount() noexcept;
+
+    /** @brief Monotonic clock in nanoseconds. */
+    static std::int64_t nowNs() noexcept;
+};
+
+/**
+ * @class TraceScope
+ * @brief Records a complete event spanning this object's lifetime.
+ *
+ * @code
+ *   { TraceScope t("chooseHand", "player"); hand = player->chooseHand(); }
+ * @endcode
+ */
+class TraceScope {
+public:
+    /** @param name, category String literals (static storage). */
+    TraceScope(const char* name, const char* category) noexcept
+        : name_(name), category_(category)
+        , start_(Tracer::isEnabled() ? Tracer::nowNs() : -1)
+    {}
+
+    ~TraceScope() {
+        if (start_ >= 0) {
+            Tracer::record(name_, category_, start_, Tracer::nowNs() - start_);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_;
+    const char* category_;
+    std::int64_t start_; ///< -1 when tracing was off at construction.
+};
+
+#endif // TRACER_H
@@ -9,6 +9,10 @@ std::string User::getName() const {
     return username_;
 }
 
+std::string_view User::getNameView() const {
+    return username_;
+}
+
 Hand User::chooseHand() {
     return Hand(inputCallback_());
 }
@@ -16,3 +20,7 @@ Hand User::chooseHand() {
 std::string User::getUsername() const {
     return username_;
 }
+
+std::string_view User::getUsernameView() const {
+    return username_;
+}
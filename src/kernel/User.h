@@ -41,6 +41,9 @@ public:
     /** @copydoc IPlayer::getName */
     std::string getName() const override;
 
+    /** @copydoc IPlayer::getNameView */
+    std::string_view getNameView() const override;
+
     /** @copydoc IPlayer::chooseHand */
     Hand chooseHand() override;
 
@@ -50,8 +53,14 @@ public:
      */
     std::string getUsername() const;
 
+    /**
+     * @brief Returns the username without copying it.
+     * @return A view valid for the lifetime of this User.
+     */
+    std::string_view getUsernameView() const;
+
 private:
-    std::string username_;      ///< Display / identity name.
+    std::string username_;        ///< Display / identity name.
     InputCallback inputCallback_; ///< Strategy for obtaining user input.
 };
 
@@ -13,22 +13,49 @@
  *   TEST_CASE("Rock beats Scissors") {
  *       ASSERT_TRUE(beats(Combination::Rock, Combination::Scissors));
  *   }
- *   // in main():  return TestRunner::instance().runAll();
+ *   // in main():  return TestRunner::instance().runAll(argc, argv);
  * @endcode
+ *
+ * Command line: `rsp_tests [--filter <text>] [--jobs <n>] [--no-bench]
+ * [--bench-seconds <s>]`.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 /// @brief Lightweight test-case registration and runner.
+///
+/// Test cases run in parallel across a small worker pool and report
+/// their wall time.  Serial test cases (which toggle process-wide
+/// state) and benchmark cases run afterwards, one at a time, so they
+/// neither disturb nor are disturbed by concurrent tests.
 class TestRunner {
 public:
     struct TestCase {
         std::string name;
         std::function<void()> body;
+        bool isBenchmark = false;
+        double minItersPerSec = 0.0; ///< Throughput floor (0 = report only).
+        bool isSerial = false;       ///< Must not run concurrently with others.
+    };
+
+    /// @brief Command-line options understood by runAll().
+    struct Options {
+        std::string filter;         ///< Substring a test name must contain.
+        unsigned    jobs = 0;       ///< Worker threads (0 = hardware threads).
+        bool        benchmarks = true; ///< Run BENCHMARK_CASEs.
+        double      benchSeconds = 0.2; ///< Minimum wall time per benchmark.
     };
 
     static TestRunner& instance() {
@@ -40,34 +67,211 @@ public:
         tests_.push_back({name, std::move(body)});
     }
 
+    void addBenchmark(const std::string& name, std::function<void()> body,
+                      double minItersPerSec) {
+        tests_.push_back({name, std::move(body), true, minItersPerSec});
+    }
+
+    void addSerialTest(const std::string& name, std::function<void()> body) {
+        tests_.push_back({name, std::move(body), false, 0.0, true});
+    }
+
+    /**
+     * @brief Parses `--filter <text>`, `--jobs <n>`, `--no-bench` and
+     *        `--bench-seconds <s>`; a bare argument is taken as the filter.
+     * @throws std::invalid_argument on an unknown option or a missing value.
+     */
+    static Options parseArgs(int argc, char** argv) {
+        Options opts;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (arg == "--filter" || arg == "-f" || arg == "--jobs" || arg == "-j" ||
+                arg == "--bench-seconds") {
+                if (!hasValue) throw std::invalid_argument("missing value for " + arg);
+            }
+            if (arg == "--filter" || arg == "-f") {
+                opts.filter = argv[++i];
+            } else if (arg == "--jobs" || arg == "-j") {
+                opts.jobs = static_cast<unsigned>(std::atoi(argv[++i]));
+            } else if (arg == "--no-bench") {
+                opts.benchmarks = false;
+            } else if (arg == "--bench-seconds") {
+                opts.benchSeconds = std::atof(argv[++i]);
+            } else if (!arg.empty() && arg[0] == '-') {
+                throw std::invalid_argument("unknown option " + arg);
+            } else {
+                opts.filter = arg;
+            }
+        }
+        return opts;
+    }
+
     /// @brief Runs all registered tests. Returns 0 on success, 1 on failure.
-    int runAll() {
-        int passed = 0, failed = 0;
-        for (auto& tc : tests_) {
-            try {
-                tc.body();
-                std::cout << "  [PASS] " << tc.name << "\n";
-                ++passed;
-            } catch (const std::exception& e) {
-                std::cerr << "  [FAIL] " << tc.name << " - " << e.what() << "\n";
-                ++failed;
+    int runAll() { return runAll(Options{}); }
+
+    /// @brief Runs all registered tests with options parsed from argv
+    ///        (returns 2 on a usage error).
+    int runAll(int argc, char** argv) {
+        Options opts;
+        try {
+            opts = parseArgs(argc, argv);
+        } catch (const std::invalid_argument& e) {
+            std::cerr << "  " << e.what() << "\n  usage: " << (argc > 0 ? argv[0] : "rsp_tests")
+                      << " [--filter <text>] [--jobs <n>] [--no-bench] [--bench-seconds <s>]\n";
+            return 2;
+        }
+        return runAll(opts);
+    }
+
+    /// @brief Runs the selected tests. Returns 0 on success, 1 on failure.
+    int runAll(const Options& opts) {
+        std::vector<const TestCase*> tests;
+        std::vector<const TestCase*> serial;
+        std::vector<const TestCase*> benches;
+        for (const auto& tc : tests_) {
+            if (tc.name.find(opts.filter) == std::string::npos) continue;
+            if (tc.isSerial)          serial.push_back(&tc);
+            else if (!tc.isBenchmark) tests.push_back(&tc);
+            else if (opts.benchmarks) benches.push_back(&tc);
+        }
+
+        // ── Unit tests: parallel, reported in registration order ──
+        std::vector<Result> results(tests.size());
+        std::atomic<std::size_t> next{0};
+        auto worker = [&]() {
+            for (std::size_t i = next++; i < tests.size(); i = next++) {
+                results[i] = runOne(*tests[i]);
             }
+        };
+
+        unsigned jobs = opts.jobs ? opts.jobs : std::thread::hardware_concurrency();
+        jobs = std::max(1u, std::min<unsigned>(jobs, static_cast<unsigned>(tests.size())));
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < jobs; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& th : pool) th.join();
+
+        int passed = 0, failed = 0;
+        for (std::size_t i = 0; i < tests.size(); ++i) {
+            report(*tests[i], results[i]);
+            results[i].ok ? ++passed : ++failed;
         }
+
+        // ── Serial tests: one at a time, after the parallel batch ──
+        for (const TestCase* tc : serial) {
+            Result r = runOne(*tc);
+            report(*tc, r);
+            r.ok ? ++passed : ++failed;
+        }
+
+        // ── Benchmarks: sequential, so timings are not contended ───
+        if (!benches.empty()) std::cout << "\n  Benchmarks:\n";
+        for (const TestCase* bc : benches) {
+            Result r = runBenchmark(*bc, opts.benchSeconds);
+            report(*bc, r);
+            r.ok ? ++passed : ++failed;
+        }
+
         std::cout << "\n  Results: " << passed << " passed, "
                   << failed << " failed, "
-                  << (passed + failed) << " total.\n";
+                  << (passed + failed) << " total ("
+                  << jobs << (jobs == 1 ? " worker" : " workers") << ").\n";
         return failed == 0 ? 0 : 1;
     }
 
 private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Result {
+        bool ok = true;
+        std::string error;
+        double millis = 0.0;
+        double itersPerSec = 0.0;
+    };
+
+    static Result runOne(const TestCase& tc) {
+        Result r;
+        auto t0 = Clock::now();
+        try {
+            tc.body();
+        } catch (const std::exception& e) {
+            r.ok = false;
+            r.error = e.what();
+        } catch (...) {
+            r.ok = false;
+            r.error = "unknown exception";
+        }
+        r.millis = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        return r;
+    }
+
+    /// Runs the body in doubling batches until @p seconds have elapsed.
+    static Result runBenchmark(const TestCase& bc, double seconds) {
+        Result r;
+        std::uint64_t iters = 0;
+        double elapsed = 0.0;
+        try {
+            for (std::uint64_t batch = 1; elapsed < seconds; batch *= 2) {
+                auto t0 = Clock::now();
+                for (std::uint64_t i = 0; i < batch; ++i) bc.body();
+                elapsed += std::chrono::duration<double>(Clock::now() - t0).count();
+                iters += batch;
+            }
+        } catch (const std::exception& e) {
+            r.ok = false;
+            r.error = e.what();
+        } catch (...) {
+            r.ok = false;
+            r.error = "unknown exception";
+        }
+        r.millis = elapsed * 1000.0;
+        r.itersPerSec = elapsed > 0.0 ? static_cast<double>(iters) / elapsed : 0.0;
+        if (r.ok && r.itersPerSec < bc.minItersPerSec) {
+            std::ostringstream oss;
+            oss << "throughput below floor of " << bc.minItersPerSec << " iter/s";
+            r.ok = false;
+            r.error = oss.str();
+        }
+        return r;
+    }
+
+    static void report(const TestCase& tc, const Result& r) {
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(3);
+        line << (r.ok ? "  [PASS] " : "  [FAIL] ") << tc.name << " (";
+        if (tc.isBenchmark) {
+            line << std::setprecision(0) << r.itersPerSec << " iter/s";
+        } else {
+            line << r.millis << " ms";
+        }
+        line << ")";
+        if (r.ok) {
+            std::cout << line.str() << "\n";
+        } else {
+            std::cerr << line.str() << " - " << r.error << "\n";
+        }
+    }
+
     std::vector<TestCase> tests_;
 };
 
 /// @brief Helper for auto-registering a test case at static-init time.
 struct TestRegistrar {
+    struct Serial {};
+
     TestRegistrar(const std::string& name, std::function<void()> body) {
         TestRunner::instance().addTest(name, std::move(body));
     }
+
+    TestRegistrar(const std::string& name, std::function<void()> body, Serial) {
+        TestRunner::instance().addSerialTest(name, std::move(body));
+    }
+
+    TestRegistrar(const std::string& name, std::function<void()> body,
+                  double minItersPerSec) {
+        TestRunner::instance().addBenchmark(name, std::move(body), minItersPerSec);
+    }
 };
 
 // ── Macros ─────────────────────────────────────────────────────────
@@ -93,6 +297,36 @@ struct TestRegistrar {
 
 #define TEST_CASE(testname) TEST_CASE_IMPL(testname, __COUNTER__)
 
+/**
+ * @brief Defines a test case that must not run concurrently with other
+ *        tests (e.g. because it toggles process-wide state).
+ */
+#define SERIAL_TEST_CASE_IMPL(testname, id)                                    \
+    static void TF_CAT(_tf_func_, id)();                                       \
+    static TestRegistrar TF_CAT(_tf_reg_, id)(                                 \
+        testname, TF_CAT(_tf_func_, id), TestRegistrar::Serial{});             \
+    static void TF_CAT(_tf_func_, id)()
+
+#define SERIAL_TEST_CASE(testname) SERIAL_TEST_CASE_IMPL(testname, __COUNTER__)
+
+/**
+ * @brief Defines and auto-registers a benchmark case.
+ *
+ * The body is ONE iteration; the runner calls it repeatedly and reports
+ * iterations per second.  If @p minItersPerSec is non-zero, a lower
+ * throughput fails the run.
+ *
+ * Usage: @code BENCHMARK_CASE("Session round", 1e5) { s.playRound(); } @endcode
+ */
+#define BENCHMARK_CASE_IMPL(benchname, floor, id)                              \
+    static void TF_CAT(_tf_bench_, id)();                                      \
+    static TestRegistrar TF_CAT(_tf_reg_, id)(                                 \
+        benchname, TF_CAT(_tf_bench_, id), static_cast<double>(floor));        \
+    static void TF_CAT(_tf_bench_, id)()
+
+#define BENCHMARK_CASE(benchname, minItersPerSec)                              \
+    BENCHMARK_CASE_IMPL(benchname, minItersPerSec, __COUNTER__)
+
 /// Asserts that an expression is true.
 #define ASSERT_TRUE(expr)                                                \
     do {                                                                  \
@@ -150,4 +384,29 @@ struct TestRegistrar {
         }                                                                 \
     } while (false)
 
+/**
+ * @brief Asserts that a statement performs no heap allocation on this thread.
+ *
+ * Requires `kernel/AllocationTracker.h` to be included and the
+ * `kernel_alloc_hooks` object library to be linked; fails otherwise.
+ */
+#define ASSERT_NO_ALLOCATIONS(stmt)                                      \
+    do {                                                                  \
+        if (!AllocationTracker::isInstalled()) {                          \
+            throw std::runtime_error("ASSERT_NO_ALLOCATIONS: allocation " \
+                                     "hooks are not linked");             \
+        }                                                                 \
+        AllocationScope tf_scope_;                                        \
+        stmt;                                                             \
+        AllocationStats tf_delta_ = tf_scope_.delta();                    \
+        if (tf_delta_.allocations != 0) {                                 \
+            std::ostringstream oss;                                       \
+            oss << "ASSERT_NO_ALLOCATIONS failed: " #stmt " made "       \
+                << tf_delta_.allocations << " allocation(s), "            \
+                << tf_delta_.bytes << " bytes (" << __FILE__ << ":"       \
+                << __LINE__ << ")";                                       \
+            throw std::runtime_error(oss.str());                          \
+        }                                                                 \
+    } while (false)
+
 #endif // TEST_FRAMEWORK_H
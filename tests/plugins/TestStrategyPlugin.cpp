@@ -0,0 +1,27 @@
+/**
+ * @file TestStrategyPlugin.cpp
+ * @brief Fixture plugin for test_plugin_loader.cpp.
+ *
+ * Built several times with different definitions:
+ * - TEST_PLUGIN_GESTURE: the Combination the player always throws.
+ * - TEST_PLUGIN_VERSION: the version string.
+ * - TEST_PLUGIN_ABI:     overrides the declared ABI version.
+ */
+#include "kernel/PluginAbi.h"
+
+#ifdef TEST_PLUGIN_ABI
+#undef RSP_PLUGIN_ABI_VERSION
+#define RSP_PLUGIN_ABI_VERSION TEST_PLUGIN_ABI
+#endif
+
+namespace {
+
+class FixedStrategy : public IPlayer {
+public:
+    std::string getName() const override { return "Fixed-" TEST_PLUGIN_VERSION; }
+    Hand chooseHand() override { return Hand(Combination::TEST_PLUGIN_GESTURE); }
+};
+
+} // namespace
+
+RSP_DEFINE_STRATEGY_PLUGIN(FixedStrategy, "fixed", TEST_PLUGIN_VERSION)
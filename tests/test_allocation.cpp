@@ -0,0 +1,63 @@
+/**
+ * @file test_allocation.cpp
+ * @brief Unit tests for AllocationTracker and the zero-allocation hot path.
+ */
+#include "TestFramework.h"
+#include "kernel/AllocationTracker.h"
+#include "kernel/Game.h"
+#include <memory>
+#include <vector>
+
+/// Helper: deterministic user (always Paper).
+static std::shared_ptr<IPlayer> makePaperUser() {
+    return std::make_shared<User>("PaperPal", []() { return Combination::Paper; });
+}
+
+// ── Tracker ────────────────────────────────────────────────────────
+
+TEST_CASE("AllocationTracker hooks are installed in rsp_tests") {
+    ASSERT_TRUE(AllocationTracker::isInstalled());
+}
+
+TEST_CASE("AllocationScope counts allocations and bytes") {
+    AllocationScope scope;
+    auto p = std::make_unique<std::vector<int>>(64);
+    AllocationStats d = scope.delta();
+    ASSERT_EQ(d.allocations, 2u);
+    ASSERT_TRUE(d.bytes >= 64 * sizeof(int));
+    ASSERT_EQ(d.deallocations, 0u);
+}
+
+TEST_CASE("AllocationScope counts deallocations") {
+    auto p = std::make_unique<int>(7);
+    AllocationScope scope;
+    p.reset();
+    ASSERT_EQ(scope.delta().deallocations, 1u);
+    ASSERT_EQ(scope.allocations(), 0u);
+}
+
+TEST_CASE("ASSERT_NO_ALLOCATIONS detects an allocation") {
+    ASSERT_THROWS(ASSERT_NO_ALLOCATIONS(std::make_unique<int>(1)),
+                  std::runtime_error);
+}
+
+// ── Hot path ───────────────────────────────────────────────────────
+
+TEST_CASE("Session playRound allocates nothing in steady state") {
+    auto user = makePaperUser();
+    auto comp = std::make_shared<ComputerAI>();
+    Session s(user, comp, 100);
+    s.playRound(); // warm-up
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_NO_ALLOCATIONS(s.playRound());
+    }
+}
+
+TEST_CASE("Headless Game playSingleRound allocates nothing") {
+    Game g(makePaperUser(), std::make_shared<ComputerAI>());
+    g.newSession(20);
+    g.playSingleRound(); // warm-up
+    while (g.getState() == GameState::Running) {
+        ASSERT_NO_ALLOCATIONS(g.playSingleRound());
+    }
+}
@@ -0,0 +1,255 @@
+/**
+ * @file test_bot_detector.cpp
+ * @brief Unit tests for the streaming BotDetector.
+ */
+#include "TestFramework.h"
+#include "kernel/BotDetector.h"
+#include "kernel/ShmClient.h"
+#include "kernel/ShmServer.h"
+#include "kernel/User.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace {
+    using std::chrono::microseconds;
+
+    Combination gestureOf(int v) {
+        return static_cast<Combination>(v);
+    }
+
+    /// A person: uniform-ish gestures, 300–1500 ms answers.
+    struct Human {
+        std::mt19937 rng{42};
+        Combination gesture() { return gestureOf(static_cast<int>(rng() % 3)); }
+        microseconds delay() { return microseconds(300000 + rng() % 1200000); }
+    };
+}
+
+TEST_CASE("BotDetector leaves a human-like player alone") {
+    BotDetector detector;
+    const auto id = detector.userId("ann");
+    Human h;
+    for (int i = 0; i < 2000; ++i) detector.observe(id, h.gesture(), h.gesture(), h.delay());
+
+    const BotScore s = detector.score(id);
+    ASSERT_EQ(s.rounds, 2000u);
+    ASSERT_FALSE(s.flagged);
+    ASSERT_EQ(s.signals, 0u);
+    ASSERT_TRUE(s.entropyBits > 1.4);
+    ASSERT_TRUE(s.predictability < 0.6);
+    ASSERT_EQ(detector.getAlertCount(), 0u);
+}
+
+TEST_CASE("BotDetector flags a cycling script once") {
+    BotDetector detector;
+    int alerts = 0;
+    std::string flaggedUser;
+    detector.onAlert([&](const BotAlert& a) {
+        ++alerts;
+        flaggedUser = std::string(a.user);
+        ASSERT_TRUE(a.score.signals & BOT_PREDICTABLE);
+    });
+    Human h;
+    for (int i = 0; i < 500; ++i) {
+        detector.observe("cycler", Move(Hand(gestureOf(i % 3)), Hand(h.gesture())), h.delay());
+    }
+    ASSERT_EQ(alerts, 1);
+    ASSERT_EQ(flaggedUser, "cycler");
+    const BotScore s = detector.score(detector.userId("cycler"));
+    ASSERT_TRUE(s.flagged);
+    ASSERT_TRUE(s.predictability > 0.9);
+    ASSERT_TRUE(s.entropyBits > 1.5); // balanced mix: entropy alone would miss it
+}
+
+TEST_CASE("BotDetector catches a beat-the-last-move script") {
+    BotDetector detector;
+    const auto id = detector.userId("reactive");
+    Human h;
+    Combination last = Combination::Rock;
+    for (int i = 0; i < 300; ++i) {
+        const Combination mine = gestureOf((static_cast<int>(last) + 1) % 3);
+        const Combination theirs = h.gesture();
+        detector.observe(id, mine, theirs, h.delay());
+        last = theirs;
+    }
+    const BotScore s = detector.score(id);
+    ASSERT_TRUE(s.flagged);
+    ASSERT_TRUE(s.signals & BOT_PREDICTABLE);
+}
+
+TEST_CASE("BotDetector flags lopsided gestures and machine timing") {
+    BotDetector detector;
+    const auto rocky = detector.userId("rocky");
+    const auto fast = detector.userId("fast");
+    Human h;
+    for (int i = 0; i < 100; ++i) {
+        detector.observe(rocky, Combination::Rock, h.gesture(), h.delay());
+        detector.observe(fast, h.gesture(), h.gesture(), microseconds(20000));
+    }
+    ASSERT_TRUE(detector.score(rocky).signals & BOT_LOW_ENTROPY);
+    const BotScore f = detector.score(fast);
+    ASSERT_TRUE(f.signals & BOT_REGULAR_TIMING);
+    ASSERT_TRUE(f.signals & BOT_FAST_RESPONSES);
+    ASSERT_TRUE(std::fabs(f.meanResponseMs - 20.0) < 1e-9);
+    ASSERT_EQ(detector.getUserCount(), 2u);
+    ASSERT_EQ(detector.getName(fast), "fast");
+}
+
+TEST_CASE("BotDetector forgets rounds that leave the window") {
+    BotDetectorConfig config;
+    config.minSignals = 1;
+    BotDetector detector(config);
+    const auto id = detector.userId("switcher");
+    Human h;
+    for (int i = 0; i < 200; ++i) detector.observe(id, Combination::Paper, h.gesture(), h.delay());
+    ASSERT_TRUE(detector.score(id).flagged);
+
+    for (std::size_t i = 0; i < 4 * BotDetector::WINDOW; ++i) {
+        detector.observe(id, h.gesture(), h.gesture(), h.delay());
+    }
+    const BotScore s = detector.score(id);
+    ASSERT_FALSE(s.flagged);
+    ASSERT_TRUE(s.entropyBits > 1.3);
+
+    for (int i = 0; i < 200; ++i) detector.observe(id, Combination::Paper, h.gesture(), h.delay());
+    ASSERT_EQ(detector.getAlertCount(), 2u); // flagged again after recovering
+}
+
+TEST_CASE("BotDetector keeps per-connection users apart and recycles released ids") {
+    BotDetector detector;
+    const auto named = detector.userId("bob");
+    const auto conn1 = detector.addUser("bob");
+    const auto conn2 = detector.addUser("bob");
+    ASSERT_NE(conn1, conn2);
+    ASSERT_NE(named, conn1);
+    ASSERT_EQ(detector.userId("bob"), named);
+    ASSERT_EQ(detector.getName(conn2), "bob");
+
+    for (std::size_t i = 0; i < BotDetector::WINDOW; ++i) {
+        detector.observe(conn1, Combination::Rock, Combination::Rock);
+    }
+    ASSERT_TRUE(detector.score(conn1).flagged);
+    ASSERT_EQ(detector.score(conn2).rounds, 0u);
+    ASSERT_EQ(detector.score(named).rounds, 0u);
+
+    detector.release(conn1);
+    ASSERT_THROWS(detector.score(conn1), std::out_of_range);
+    ASSERT_THROWS(detector.release(conn1), std::out_of_range);
+    ASSERT_EQ(detector.getUserCount(), 2u);
+    const auto conn3 = detector.addUser("carol");
+    ASSERT_EQ(conn3, conn1);                       // id reused ...
+    ASSERT_EQ(detector.score(conn3).rounds, 0u);   // ... with fresh state
+    ASSERT_EQ(detector.getName(conn3), "carol");
+
+    detector.release(named);
+    ASSERT_NE(detector.userId("bob"), conn2);      // a new named user
+    ASSERT_EQ(detector.getUserCount(), 3u);
+}
+
+TEST_CASE("BotDetector needs a full window before judging") {
+    BotDetector detector;
+    const auto id = detector.userId("newbie");
+    for (std::size_t i = 0; i + 1 < BotDetector::WINDOW; ++i) {
+        detector.observe(id, Combination::Rock, Combination::Rock, microseconds(1000));
+    }
+    ASSERT_EQ(detector.score(id).signals, 0u);
+    ASSERT_EQ(detector.score(id).entropyBits, 0.0);
+    detector.observe(id, Combination::Rock, Combination::Rock, microseconds(1000));
+    ASSERT_TRUE(detector.score(id).flagged);
+}
+
+#if !defined(_WIN32)
+
+SERIAL_TEST_CASE("ShmServer reports a scripted front-end to its BotDetector") {
+    auto detector = std::make_shared<BotDetector>();
+    std::atomic<int> alerts{0};
+    std::atomic<std::uint32_t> signals{0};
+    detector->onAlert([&](const BotAlert& a) {
+        if (a.user == "script") alerts.fetch_add(1);
+        signals.store(a.score.signals);
+    });
+
+    ShmServer server([]() {
+        return std::make_shared<User>("Rocky", []() { return Combination::Rock; });
+    });
+    server.setBotDetector(detector);
+    const std::string name = "/rsp_test_bot_" + std::to_string(::getpid());
+    ASSERT_TRUE(server.start(name));
+
+    ShmClient client;
+    ASSERT_TRUE(client.connect(name, "script"));
+    ASSERT_TRUE(client.newSession(100));
+    ShmEvent e;
+    ASSERT_TRUE(client.waitEvent(e, microseconds(2000000)));
+    for (std::size_t i = 0; i < BotDetector::WINDOW + 4; ++i) {
+        ASSERT_TRUE(client.play(Combination::Paper));
+        ASSERT_TRUE(client.waitEvent(e, microseconds(2000000)));
+        ASSERT_TRUE(e.type == ShmEventType::Round);
+    }
+    client.disconnect();
+    server.stop(); // joins the serve thread, so the detector is quiet now
+
+    ASSERT_EQ(alerts.load(), 1);
+    ASSERT_TRUE(signals.load() & BOT_LOW_ENTROPY);
+    ASSERT_TRUE(signals.load() & BOT_FAST_RESPONSES);
+    ASSERT_EQ(detector->getUserCount(), 0u); // released with the slot
+}
+
+SERIAL_TEST_CASE("ShmServer scores each connection separately whatever its name") {
+    auto detector = std::make_shared<BotDetector>();
+    std::atomic<int> alerts{0};
+    detector->onAlert([&alerts](const BotAlert&) { alerts.fetch_add(1); });
+
+    ShmServer server;
+    server.setBotDetector(detector);
+    const std::string name = "/rsp_test_bot_key_" + std::to_string(::getpid());
+    ASSERT_TRUE(server.start(name));
+
+    // Two connections claiming the same name: neither fills the other's
+    // window, so half a window each raises nothing.
+    ShmClient a, b;
+    ASSERT_TRUE(a.connect(name, "alice"));
+    ASSERT_TRUE(b.connect(name, "alice"));
+    ShmEvent e;
+    for (ShmClient* c : {&a, &b}) {
+        ASSERT_TRUE(c->newSession(1000));
+        ASSERT_TRUE(c->waitEvent(e, microseconds(2000000)));
+    }
+    for (std::size_t i = 0; i < BotDetector::WINDOW / 2 + 4; ++i) {
+        for (ShmClient* c : {&a, &b}) {
+            ASSERT_TRUE(c->play(Combination::Rock));
+            ASSERT_TRUE(c->waitEvent(e, microseconds(2000000)));
+        }
+    }
+    ASSERT_EQ(server.getClientCount(), 2u);
+    a.disconnect();
+    b.disconnect();
+    server.stop();
+
+    ASSERT_EQ(alerts.load(), 0);
+    ASSERT_EQ(detector->getUserCount(), 0u);
+}
+
+#endif
+
+BENCHMARK_CASE("BotDetector observe", 500000) {
+    static BotDetector detector;
+    static BotDetector::UserId ids[16];
+    static bool ready = false;
+    static std::uint32_t n = 0;
+    if (!ready) {
+        for (int u = 0; u < 16; ++u) ids[u] = detector.userId("bench" + std::to_string(u));
+        ready = true;
+    }
+    ++n;
+    detector.observe(ids[n & 15], gestureOf(static_cast<int>(n % 3)),
+                     gestureOf(static_cast<int>((n >> 4) % 3)), microseconds(400000 + (n & 1023)));
+}
@@ -0,0 +1,161 @@
+/**
+ * @file test_broadcaster.cpp
+ * @brief Unit tests for RoundBroadcaster spectator fan-out.
+ */
+#include "TestFramework.h"
+#include "kernel/RoundBroadcaster.h"
+#include "kernel/Game.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/// Helper: deterministic player.
+static std::shared_ptr<IPlayer> makeBot(const char* name, Combination c) {
+    return std::make_shared<User>(name, [c]() { return c; });
+}
+
+TEST_CASE("RoundBroadcaster capacity rounds up to a power of two") {
+    auto hub = RoundBroadcaster::create(100);
+    ASSERT_EQ(hub->getCapacity(), 128u);
+}
+
+TEST_CASE("RoundBroadcaster delivers every round of a session in order") {
+    auto hub = RoundBroadcaster::create(64);
+    auto sub = hub->subscribe();
+
+    Session s(makeBot("P", Combination::Paper), makeBot("R", Combination::Rock), 10);
+    s.onRoundCompleted(hub->asRoundCallback(s));
+    s.start();
+
+    RoundFrame frames[16];
+    ASSERT_EQ(sub.poll(frames, 16), 10u);
+    for (std::uint64_t i = 0; i < 10; ++i) {
+        ASSERT_EQ(frames[i].roundIndex, i);
+        ASSERT_EQ(frames[i].userScore, i + 1);
+        ASSERT_EQ(frames[i].result, static_cast<std::uint8_t>(MoveResult::UserWins));
+    }
+    ASSERT_EQ(sub.poll(frames, 16), 0u);
+    ASSERT_EQ(sub.getDroppedCount(), 0u);
+}
+
+TEST_CASE("RoundBroadcaster subscribers keep independent cursors") {
+    auto hub = RoundBroadcaster::create(64);
+    auto fast = hub->subscribe();
+    auto slow = hub->subscribe();
+    Move m(Hand(Combination::Rock), Hand(Combination::Rock));
+
+    RoundFrame f[8];
+    hub->publish(0, m, 0, 0, 1);
+    hub->publish(1, m, 0, 0, 2);
+    ASSERT_EQ(fast.poll(f, 8), 2u);
+    hub->publish(2, m, 0, 0, 3);
+    ASSERT_EQ(fast.poll(f, 8), 1u);
+    ASSERT_EQ(slow.getBacklog(), 3u);
+    ASSERT_EQ(slow.poll(f, 8), 3u);
+    ASSERT_EQ(f[2].drawCount, 3u);
+}
+
+TEST_CASE("RoundBroadcaster lapped subscriber skips ahead and counts drops") {
+    auto hub = RoundBroadcaster::create(16);
+    auto sub = hub->subscribe();
+    Move m(Hand(Combination::Rock), Hand(Combination::Paper));
+    for (int i = 0; i < 100; ++i) hub->publish(i, m, 0, i + 1, 0);
+
+    RoundFrame f[32];
+    ASSERT_EQ(sub.poll(f, 32), 16u);
+    ASSERT_EQ(sub.getDroppedCount(), 84u);
+    ASSERT_EQ(f[0].roundIndex, 84u);
+    ASSERT_EQ(f[15].roundIndex, 99u);
+}
+
+TEST_CASE("RoundBroadcaster keeps round indices beyond 32 bits") {
+    auto hub = RoundBroadcaster::create(4);
+    auto sub = hub->subscribe();
+    const std::int64_t late = std::int64_t{5} << 32; // a very long session
+    hub->publish(late, Move(Hand(Combination::Rock), Hand(Combination::Rock)), 0, 0, late + 1);
+
+    RoundFrame f[1];
+    ASSERT_EQ(sub.poll(f, 1), 1u);
+    ASSERT_EQ(f[0].roundIndex, static_cast<std::uint64_t>(late));
+    ASSERT_EQ(f[0].drawCount, static_cast<std::uint64_t>(late) + 1);
+}
+
+TEST_CASE("RoundBroadcaster feeds spectators of a Game") {
+    auto hub = RoundBroadcaster::create();
+    auto sub = hub->subscribe();
+    Game g(makeBot("P", Combination::Paper), makeBot("S", Combination::Scissors));
+    g.setRoundObserver(hub->asRoundCallback(g));
+    g.newSession(3);
+    while (g.getState() == GameState::Running) g.playSingleRound();
+
+    RoundFrame f[4];
+    ASSERT_EQ(sub.poll(f, 4), 3u);
+    ASSERT_EQ(f[2].computerScore, 3u);
+}
+
+TEST_CASE("RoundBroadcaster takes scores from the session it watches") {
+    auto hub = RoundBroadcaster::create(64);
+    Session s(makeBot("P", Combination::Paper), makeBot("R", Combination::Rock), 20);
+    s.playRound();
+    s.playRound();
+
+    // Attached mid-session, fed in batches: totals still match the session.
+    auto sub = hub->subscribe();
+    s.onRoundCompleted(hub->asRoundCallback(s));
+    s.playBatch(5);
+    s.playRound();
+
+    RoundFrame f[8];
+    ASSERT_EQ(sub.poll(f, 8), 6u);
+    for (std::uint64_t i = 0; i < 6; ++i) {
+        ASSERT_EQ(f[i].roundIndex, i + 2);
+        ASSERT_EQ(f[i].userScore, i + 3);
+    }
+
+    // A second session on the same hub starts from its own totals.
+    Session t(makeBot("R", Combination::Rock), makeBot("P", Combination::Paper), 2);
+    t.onRoundCompleted(hub->asRoundCallback(t));
+    t.playBatch(2);
+    ASSERT_EQ(sub.poll(f, 8), 2u);
+    ASSERT_EQ(f[1].userScore, 0u);
+    ASSERT_EQ(f[1].computerScore, 2u);
+}
+
+TEST_CASE("RoundBroadcaster readers on other threads see consistent frames") {
+    auto hub = RoundBroadcaster::create(256);
+    std::atomic<bool> done{false};
+    std::atomic<int> errors{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&hub, &done, &errors]() {
+            auto sub = hub->subscribe();
+            RoundFrame f[64];
+            std::uint64_t last = 0;
+            for (;;) {
+                bool finished = done.load();
+                std::size_t n = sub.poll(f, 64);
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (f[i].sequence <= last ||
+                        f[i].userScore + f[i].computerScore + f[i].drawCount != f[i].roundIndex + 1) {
+                        ++errors;
+                    }
+                    last = f[i].sequence;
+                }
+                if (finished && n == 0) break;
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    Session s(std::make_shared<ComputerAI>("A"), std::make_shared<ComputerAI>("B"), 50000);
+    s.onRoundCompleted(hub->asRoundCallback(s));
+    s.start();
+    done = true;
+    for (auto& t : readers) t.join();
+
+    ASSERT_EQ(errors.load(), 0);
+    ASSERT_EQ(hub->getPublishedCount(), 50000u);
+}
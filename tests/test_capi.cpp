@@ -0,0 +1,122 @@
+/**
+ * @file test_capi.cpp
+ * @brief Unit tests for the C ABI in librsp_kernel.
+ */
+#include "TestFramework.h"
+#include "capi/rsp_kernel.h"
+#include "kernel/Session.h"
+#include "kernel/ComputerAI.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+TEST_CASE("C API reports its ABI version") {
+    ASSERT_EQ(rsp_abi_version(), static_cast<uint32_t>(RSP_ABI_VERSION));
+}
+
+TEST_CASE("C API plays seeded sessions like the C++ kernel") {
+    rsp_player_spec user{RSP_PLAYER_SEEDED, 7};
+    rsp_player_spec comp{RSP_PLAYER_SEEDED, 8};
+    rsp_session* s = rsp_session_create(&user, &comp, 10000, 0);
+    ASSERT_TRUE(s != nullptr);
+
+    std::vector<uint8_t> u(10000), c(10000), r(10000);
+    ASSERT_EQ(rsp_session_play(s, 6000, nullptr, nullptr, u.data(), c.data(), r.data()), 6000);
+    ASSERT_EQ(rsp_session_play(s, 99999, nullptr, nullptr,
+                               u.data() + 6000, c.data() + 6000, r.data() + 6000), 4000);
+    ASSERT_EQ(rsp_session_play(s, 1, nullptr, nullptr, nullptr, nullptr, nullptr),
+              static_cast<int64_t>(RSP_ERR_FINISHED));
+    ASSERT_TRUE(std::strlen(rsp_last_error()) > 0);
+
+    Session ref(std::make_shared<ComputerAI>("User", 7, 0, 0),
+                std::make_shared<ComputerAI>("Computer", 8, 0, 1), 10000);
+    ref.start();
+    for (std::uint64_t i = 0; i < 10000; ++i) {
+        const Move m = ref.getMoves()[i];
+        ASSERT_EQ(u[i], static_cast<uint8_t>(m.getUserHand().getCombination()));
+        ASSERT_EQ(c[i], static_cast<uint8_t>(m.getComputerHand().getCombination()));
+        ASSERT_EQ(r[i], static_cast<uint8_t>(m.getWhoWins()));
+    }
+
+    rsp_score score{};
+    ASSERT_EQ(rsp_session_score(s, &score), static_cast<int32_t>(RSP_OK));
+    ASSERT_EQ(score.user_wins, ref.getUserScore());
+    ASSERT_EQ(score.computer_wins, ref.getComputerScore());
+    ASSERT_EQ(score.draws, ref.getDrawCount());
+    ASSERT_EQ(score.rounds_played, 10000);
+    ASSERT_EQ(score.running, 0);
+    rsp_session_destroy(s);
+}
+
+TEST_CASE("C API takes external gestures and copies history") {
+    rsp_player_spec ext{RSP_PLAYER_EXTERNAL, 0};
+    rsp_session* s = rsp_session_create(&ext, &ext, 4, 2);
+    ASSERT_TRUE(s != nullptr);
+
+    const uint8_t user[] = {RSP_ROCK, RSP_PAPER, RSP_SCISSORS, RSP_ROCK};
+    const uint8_t comp[] = {RSP_SCISSORS, RSP_SCISSORS, RSP_SCISSORS, RSP_PAPER};
+    const uint8_t bad[]  = {RSP_ROCK, 7, RSP_ROCK, RSP_ROCK};
+    uint8_t results[4] = {};
+
+    ASSERT_EQ(rsp_session_play(s, 4, user, nullptr, nullptr, nullptr, results),
+              static_cast<int64_t>(RSP_ERR_INVALID_ARGUMENT));
+    ASSERT_EQ(rsp_session_play(s, 4, bad, comp, nullptr, nullptr, results),
+              static_cast<int64_t>(RSP_ERR_INVALID_ARGUMENT));
+    ASSERT_EQ(rsp_session_play(s, 4, user, comp, nullptr, nullptr, results), 4);
+    ASSERT_EQ(results[0], static_cast<uint8_t>(RSP_USER_WINS));
+    ASSERT_EQ(results[1], static_cast<uint8_t>(RSP_COMPUTER_WINS));
+    ASSERT_EQ(results[2], static_cast<uint8_t>(RSP_DRAW));
+    ASSERT_EQ(results[3], static_cast<uint8_t>(RSP_COMPUTER_WINS));
+
+    uint8_t hu[4] = {}, hc[4] = {};
+    ASSERT_EQ(rsp_session_history(s, 1, 10, hu, hc), 3);
+    ASSERT_EQ(hu[0], static_cast<uint8_t>(RSP_PAPER));
+    ASSERT_EQ(hc[2], static_cast<uint8_t>(RSP_PAPER));
+    rsp_session_destroy(s);
+}
+
+TEST_CASE("C API MetaAI adapts within one large play call") {
+    rsp_player_spec ext{RSP_PLAYER_EXTERNAL, 0};
+    rsp_player_spec meta{RSP_PLAYER_META, 0};
+    rsp_session* s = rsp_session_create(&ext, &meta, 8192, 0);
+    ASSERT_TRUE(s != nullptr);
+
+    std::vector<uint8_t> rocks(8192, RSP_ROCK);
+    std::vector<uint8_t> results(8192);
+    ASSERT_EQ(rsp_session_play(s, 8192, rocks.data(), nullptr, nullptr, nullptr, results.data()), 8192);
+    // Well above chance already inside the first 4096-round chunk.
+    const auto firstChunkWins = std::count(results.begin(), results.begin() + 4096,
+                                           static_cast<uint8_t>(RSP_COMPUTER_WINS));
+    ASSERT_TRUE(firstChunkWins > 4000);
+
+    rsp_score score{};
+    ASSERT_EQ(rsp_session_score(s, &score), static_cast<int32_t>(RSP_OK));
+    ASSERT_TRUE(score.computer_wins > 8000);
+    rsp_session_destroy(s);
+}
+
+TEST_CASE("C API scores batches without a session") {
+    const uint8_t user[] = {RSP_ROCK, RSP_ROCK, RSP_PAPER};
+    const uint8_t comp[] = {RSP_SCISSORS, RSP_ROCK, RSP_SCISSORS};
+    uint8_t results[3] = {};
+    rsp_score totals{};
+    ASSERT_EQ(rsp_score_batch(user, comp, 3, results, &totals), static_cast<int32_t>(RSP_OK));
+    ASSERT_EQ(results[0], static_cast<uint8_t>(RSP_USER_WINS));
+    ASSERT_EQ(results[1], static_cast<uint8_t>(RSP_DRAW));
+    ASSERT_EQ(totals.computer_wins, 1);
+    ASSERT_EQ(totals.rounds_played, 3);
+
+    const uint8_t bad[] = {3};
+    ASSERT_EQ(rsp_score_batch(bad, comp, 1, nullptr, nullptr),
+              static_cast<int32_t>(RSP_ERR_INVALID_ARGUMENT));
+}
+
+TEST_CASE("C API rejects invalid arguments") {
+    rsp_player_spec weird{42, 0};
+    ASSERT_TRUE(rsp_session_create(&weird, nullptr, 10, 0) == nullptr);
+    ASSERT_TRUE(rsp_session_create(nullptr, nullptr, 0, 0) == nullptr);
+    ASSERT_EQ(rsp_session_play(nullptr, 1, nullptr, nullptr, nullptr, nullptr, nullptr),
+              static_cast<int64_t>(RSP_ERR_INVALID_ARGUMENT));
+    rsp_session_destroy(nullptr);
+}
@@ -43,6 +43,14 @@ TEST_CASE("Same combination never beats itself (Paper)") {
     ASSERT_FALSE(beats(Combination::Paper, Combination::Paper));
 }
 
+// ── counterTo() ────────────────────────────────────────────────────
+
+TEST_CASE("counterTo returns the combination that beats its argument") {
+    for (Combination c : {Combination::Rock, Combination::Scissors, Combination::Paper}) {
+        ASSERT_TRUE(beats(counterTo(c), c));
+    }
+}
+
 // ── combinationToString() ──────────────────────────────────────────
 
 TEST_CASE("combinationToString Rock") {
@@ -56,3 +64,14 @@ TEST_CASE("combinationToString Scissors") {
 TEST_CASE("combinationToString Paper") {
     ASSERT_EQ(combinationToString(Combination::Paper), std::string("Paper"));
 }
+
+// ── combinationLabel() ─────────────────────────────────────────────
+
+static_assert(combinationLabel(Combination::Rock) == "Rock",
+              "combinationLabel must be usable in constant expressions");
+
+TEST_CASE("combinationLabel matches combinationToString") {
+    for (Combination c : {Combination::Rock, Combination::Scissors, Combination::Paper}) {
+        ASSERT_EQ(std::string(combinationLabel(c)), combinationToString(c));
+    }
+}
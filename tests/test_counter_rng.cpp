@@ -0,0 +1,89 @@
+/**
+ * @file test_counter_rng.cpp
+ * @brief Unit tests for CounterRng and reproducible ComputerAI.
+ */
+#include "TestFramework.h"
+#include "kernel/CounterRng.h"
+#include "kernel/ComputerAI.h"
+#include "kernel/Session.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// ── Philox known-answer tests (Random123 kat_vectors) ──────────────
+
+TEST_CASE("Philox4x32-10 matches the zero known-answer vector") {
+    auto out = CounterRng::philox({0, 0, 0, 0}, {0, 0});
+    ASSERT_TRUE(out == (CounterRng::Counter{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+}
+
+TEST_CASE("Philox4x32-10 matches the all-ones known-answer vector") {
+    auto out = CounterRng::philox({0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                                  {0xffffffffu, 0xffffffffu});
+    ASSERT_TRUE(out == (CounterRng::Counter{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+}
+
+TEST_CASE("Philox4x32-10 matches the pi known-answer vector") {
+    auto out = CounterRng::philox({0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                                  {0xa4093822u, 0x299f31d0u});
+    ASSERT_TRUE(out == (CounterRng::Counter{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+// ── Gesture mapping ────────────────────────────────────────────────
+
+TEST_CASE("CounterRng combinationAt is a pure function") {
+    for (std::uint64_t r = 0; r < 100; ++r) {
+        ASSERT_EQ(CounterRng::combinationAt(7, 3, r, 1), CounterRng::combinationAt(7, 3, r, 1));
+    }
+}
+
+TEST_CASE("CounterRng gestures are roughly uniform") {
+    int counts[3] = {0, 0, 0};
+    for (std::uint64_t r = 0; r < 30000; ++r) {
+        ++counts[static_cast<int>(CounterRng::combinationAt(1, 0, r))];
+    }
+    for (int c : counts) {
+        ASSERT_TRUE(c > 9500 && c < 10500);
+    }
+}
+
+// ── Reproducible ComputerAI ────────────────────────────────────────
+
+TEST_CASE("Seeded ComputerAI replays any round in O(1)") {
+    ComputerAI ai("Replay", 99, 12);
+    ASSERT_TRUE(ai.isSeeded());
+    std::vector<Combination> played;
+    for (int i = 0; i < 50; ++i) played.push_back(ai.chooseHand().getCombination());
+    for (int i = 49; i >= 0; --i) {
+        ASSERT_EQ(ai.handAt(static_cast<std::uint64_t>(i)).getCombination(), played[i]);
+    }
+    ai.reseed(12);
+    ASSERT_EQ(ai.chooseHand().getCombination(), played[0]);
+}
+
+TEST_CASE("Unseeded ComputerAI refuses handAt") {
+    ComputerAI ai;
+    ASSERT_THROWS(ai.handAt(0), std::logic_error);
+}
+
+TEST_CASE("Seeded simulation is identical on 1 and 4 threads") {
+    constexpr std::uint64_t SESSIONS = 400;
+    auto simulate = [](unsigned threads) {
+        std::vector<int> net(SESSIONS);
+        std::atomic<std::uint64_t> next{0};
+        auto worker = [&]() {
+            for (std::uint64_t id = next++; id < SESSIONS; id = next++) {
+                Session s(std::make_shared<ComputerAI>("U", 2024, id, 0),
+                          std::make_shared<ComputerAI>("C", 2024, id, 1), 20);
+                s.start();
+                net[id] = s.getUserScore() - s.getComputerScore();
+            }
+        };
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) pool.emplace_back(worker);
+        for (auto& th : pool) th.join();
+        return net;
+    };
+    ASSERT_TRUE(simulate(1) == simulate(4));
+}
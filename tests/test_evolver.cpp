@@ -0,0 +1,100 @@
+/**
+ * @file test_evolver.cpp
+ * @brief Unit tests for FsmStrategy and StrategyEvolver.
+ */
+#include "TestFramework.h"
+#include "kernel/StrategyEvolver.h"
+#include "kernel/Session.h"
+#include "kernel/User.h"
+#include <memory>
+
+/// Helper: bot cycling Rock → Scissors → Paper, fresh state per call.
+static std::shared_ptr<IPlayer> makeCycleBot() {
+    auto round = std::make_shared<int>(0);
+    return std::make_shared<User>("CycleBot", [round]() {
+        return static_cast<Combination>((*round)++ % 3);
+    });
+}
+
+static std::shared_ptr<IPlayer> makeRockBot() {
+    return std::make_shared<User>("RockBot", []() { return Combination::Rock; });
+}
+
+// ── FsmStrategy ────────────────────────────────────────────────────
+
+TEST_CASE("FsmStrategy single state always plays its output") {
+    FsmStrategy fsm({static_cast<std::uint8_t>(Combination::Paper), 0, 0, 0});
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(fsm.chooseHand().getCombination(), Combination::Paper);
+        fsm.observeRound(Hand(Combination::Paper), Hand(Combination::Rock));
+    }
+}
+
+TEST_CASE("FsmStrategy transitions on the opponent's gesture") {
+    // State 0 plays Rock; if opponent played Paper go to state 1 (Scissors).
+    FsmStrategy fsm({0, 0, 0, 1,
+                     1, 1, 1, 1});
+    fsm.observeRound(Hand(Combination::Rock), Hand(Combination::Rock));
+    ASSERT_EQ(fsm.getCurrentState(), 0u);
+    fsm.observeRound(Hand(Combination::Rock), Hand(Combination::Paper));
+    ASSERT_EQ(fsm.getCurrentState(), 1u);
+    ASSERT_EQ(fsm.chooseHand().getCombination(), Combination::Scissors);
+    fsm.reset();
+    ASSERT_EQ(fsm.getCurrentState(), 0u);
+}
+
+TEST_CASE("FsmStrategy rejects malformed genomes") {
+    using Genome = std::vector<std::uint8_t>;
+    ASSERT_THROWS(FsmStrategy(Genome{3, 0, 0, 0}), std::invalid_argument);
+    ASSERT_THROWS(FsmStrategy(Genome{0, 1, 0, 0}), std::invalid_argument);
+    ASSERT_THROWS(FsmStrategy(Genome{0, 0, 0}), std::invalid_argument);
+}
+
+// ── StrategyEvolver ────────────────────────────────────────────────
+
+TEST_CASE("StrategyEvolver requires a reference pool") {
+    ASSERT_THROWS(StrategyEvolver(EvolverConfig{}, {}), std::invalid_argument);
+}
+
+TEST_CASE("StrategyEvolver finds the counter to a constant bot") {
+    EvolverConfig cfg;
+    cfg.populationSize = 32;
+    cfg.states = 2;
+    cfg.roundsPerMatch = 20;
+    StrategyEvolver evo(cfg, {makeRockBot});
+    evo.run(10);
+    ASSERT_EQ(evo.getGeneration(), 10u);
+    ASSERT_TRUE(evo.getBestFitness() > 0.9);
+
+    auto best = evo.makeBest();
+    Session s(best, makeRockBot(), 50);
+    s.start();
+    ASSERT_TRUE(s.getUserScore() >= 45);
+}
+
+TEST_CASE("StrategyEvolver learns to beat a cyclic bot") {
+    EvolverConfig cfg;
+    cfg.populationSize = 48;
+    cfg.states = 4;
+    cfg.roundsPerMatch = 30;
+    StrategyEvolver evo(cfg, {makeCycleBot, makeRockBot});
+    evo.evaluate();
+    double initial = evo.getBestFitness();
+    evo.run(25);
+    ASSERT_TRUE(evo.getBestFitness() >= initial);
+    ASSERT_TRUE(evo.getBestFitness() > 0.6);
+}
+
+TEST_CASE("StrategyEvolver results do not depend on thread count") {
+    EvolverConfig cfg;
+    cfg.populationSize = 16;
+    cfg.states = 3;
+    cfg.roundsPerMatch = 10;
+    cfg.threads = 1;
+    StrategyEvolver serial(cfg, {makeCycleBot});
+    cfg.threads = 4;
+    StrategyEvolver parallel(cfg, {makeCycleBot});
+    serial.run(3);
+    parallel.run(3);
+    ASSERT_TRUE(serial.getFitness() == parallel.getFitness());
+}
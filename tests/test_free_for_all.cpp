@@ -0,0 +1,236 @@
+/**
+ * @file test_free_for_all.cpp
+ * @brief Unit tests for MultiMove and FreeForAllSession.
+ */
+#include "TestFramework.h"
+#include "kernel/AllocationTracker.h"
+#include "kernel/FreeForAllSession.h"
+#include "kernel/Move.h"
+#include "kernel/User.h"
+#include "kernel/ComputerAI.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<Hand> handsOf(std::initializer_list<Combination> cs) {
+        std::vector<Hand> hands;
+        for (Combination c : cs) hands.emplace_back(c);
+        return hands;
+    }
+
+    std::shared_ptr<IPlayer> fixedPlayer(const std::string& name, Combination c) {
+        return std::make_shared<User>(name, [c]() { return c; });
+    }
+
+    /// Plays the given gestures in turn, cycling.
+    std::shared_ptr<IPlayer> scriptedPlayer(const std::string& name,
+                                            std::vector<Combination> script) {
+        auto index = std::make_shared<std::size_t>(0);
+        return std::make_shared<User>(name, [script, index]() {
+            return script[(*index)++ % script.size()];
+        });
+    }
+
+    class RecordingPlayer : public IPlayer {
+    public:
+        Hand chooseHand() override { return Hand(Combination::Rock); }
+        std::string getName() const override { return "Recorder"; }
+        void observeRound(const Hand& own, const Hand& opponent) override {
+            lastOwn = own.getCombination();
+            lastCrowd = opponent.getCombination();
+            ++observed;
+        }
+        Combination lastOwn = Combination::Paper;
+        Combination lastCrowd = Combination::Paper;
+        int observed = 0;
+    };
+}
+
+TEST_CASE("MultiMove: two gestures present -> the beating gesture wins") {
+    MultiMove m(handsOf({Combination::Rock, Combination::Scissors,
+                         Combination::Rock, Combination::Scissors, Combination::Scissors}));
+    ASSERT_FALSE(m.isDraw());
+    ASSERT_EQ(m.getWinningCombination(), Combination::Rock);
+    ASSERT_EQ(m.getWinnerCount(), 2);
+    ASSERT_TRUE(m.isWinner(0));
+    ASSERT_FALSE(m.isWinner(1));
+    ASSERT_EQ(m.getCount(Combination::Scissors), 3);
+}
+
+TEST_CASE("MultiMove: winner for every pair of gestures") {
+    ASSERT_EQ(MultiMove(handsOf({Combination::Scissors, Combination::Paper}))
+                  .getWinningCombination(), Combination::Scissors);
+    ASSERT_EQ(MultiMove(handsOf({Combination::Paper, Combination::Rock}))
+                  .getWinningCombination(), Combination::Paper);
+    ASSERT_EQ(MultiMove(handsOf({Combination::Scissors, Combination::Rock}))
+                  .getWinningCombination(), Combination::Rock);
+}
+
+TEST_CASE("MultiMove: one or three gestures present -> draw") {
+    MultiMove same(handsOf({Combination::Paper, Combination::Paper, Combination::Paper}));
+    ASSERT_TRUE(same.isDraw());
+    ASSERT_EQ(same.getWinnerCount(), 0);
+    ASSERT_THROWS(same.getWinningCombination(), std::logic_error);
+
+    MultiMove all(handsOf({Combination::Rock, Combination::Paper, Combination::Scissors,
+                           Combination::Rock}));
+    ASSERT_TRUE(all.isDraw());
+    ASSERT_FALSE(all.isWinner(0));
+}
+
+TEST_CASE("MultiMove agrees with Move for two players") {
+    for (int a = 0; a < 3; ++a) {
+        for (int b = 0; b < 3; ++b) {
+            const auto ca = static_cast<Combination>(a);
+            const auto cb = static_cast<Combination>(b);
+            MultiMove mm(handsOf({ca, cb}));
+            Move m{Hand(ca), Hand(cb)};
+            ASSERT_EQ(mm.isDraw(), m.getWhoWins() == MoveResult::Draw);
+            ASSERT_EQ(mm.isWinner(0), m.getWhoWins() == MoveResult::UserWins);
+            ASSERT_EQ(mm.isWinner(1), m.getWhoWins() == MoveResult::ComputerWins);
+        }
+    }
+}
+
+TEST_CASE("MultiMove maps participants to seats") {
+    MultiMove m(handsOf({Combination::Rock, Combination::Paper}), {4, 7});
+    ASSERT_EQ(m.getSeat(0), 4u);
+    ASSERT_EQ(m.getSeat(1), 7u);
+    ASSERT_EQ(MultiMove(handsOf({Combination::Rock})).getSeat(0), 0u);
+    ASSERT_THROWS(MultiMove(handsOf({Combination::Rock}), {1, 2}), std::invalid_argument);
+}
+
+TEST_CASE("MultiMove refills in place") {
+    MultiMove m(handsOf({Combination::Rock, Combination::Scissors}));
+    m.add(Hand(Combination::Scissors), 5);
+    ASSERT_EQ(m.getSeat(1), 1u);
+    ASSERT_EQ(m.getSeat(2), 5u);
+    ASSERT_EQ(m.getWinnerCount(), 1);
+
+    m.clear();
+    ASSERT_TRUE(m.isDraw());
+    ASSERT_EQ(m.getParticipantCount(), 0u);
+    m.add(Hand(Combination::Paper), 3);
+    ASSERT_TRUE(m.isDraw());
+    m.add(Hand(Combination::Scissors), 9);
+    ASSERT_EQ(m.getWinningCombination(), Combination::Scissors);
+    ASSERT_TRUE(m.isWinner(1));
+    ASSERT_EQ(m.getSeat(1), 9u);
+    ASSERT_EQ(m.getCount(Combination::Rock), 0);
+}
+
+TEST_CASE("FreeForAllSession rejects too few players") {
+    ASSERT_THROWS(FreeForAllSession({fixedPlayer("Solo", Combination::Rock)}),
+                  std::invalid_argument);
+    ASSERT_THROWS(FreeForAllSession({fixedPlayer("A", Combination::Rock), nullptr}),
+                  std::invalid_argument);
+}
+
+TEST_CASE("FreeForAllSession points mode scores every round") {
+    FreeForAllSession s({fixedPlayer("R1", Combination::Rock),
+                         fixedPlayer("R2", Combination::Rock),
+                         fixedPlayer("S", Combination::Scissors)}, 4);
+    int callbacks = 0;
+    s.onRoundCompleted([&](std::int64_t idx, const MultiMove& m) {
+        ASSERT_EQ(idx, callbacks);
+        ASSERT_EQ(m.getParticipantCount(), 3u);
+        ++callbacks;
+    });
+    s.start();
+
+    ASSERT_TRUE(s.isFinished());
+    ASSERT_EQ(callbacks, 4);
+    ASSERT_EQ(s.getScores(), (std::vector<std::int64_t>{4, 4, 0}));
+    ASSERT_EQ(s.getLosses(), (std::vector<std::int64_t>{0, 0, 4}));
+    ASSERT_EQ(s.getActiveCount(), 3u);
+    ASSERT_EQ(s.getLeaders(), (std::vector<std::size_t>{0, 1}));
+    ASSERT_EQ(s.whoWinsView(), std::string_view("Draw"));
+    ASSERT_THROWS(s.playRound(), std::runtime_error);
+}
+
+TEST_CASE("FreeForAllSession elimination keeps everyone on a draw") {
+    FreeForAllSession s({fixedPlayer("A", Combination::Rock),
+                         fixedPlayer("B", Combination::Scissors),
+                         fixedPlayer("C", Combination::Paper)},
+                        3, FreeForAllMode::Elimination);
+    s.start();
+    ASSERT_EQ(s.getRoundsPlayed(), 3);
+    ASSERT_EQ(s.getActiveCount(), 3u);
+    ASSERT_EQ(s.getDraws(), (std::vector<std::int64_t>{3, 3, 3}));
+    ASSERT_EQ(s.whoWinsView(), std::string_view("Draw"));
+}
+
+TEST_CASE("FreeForAllSession elimination knocks out losers until one remains") {
+    FreeForAllSession s({fixedPlayer("A", Combination::Paper),
+                         fixedPlayer("B", Combination::Rock),
+                         fixedPlayer("C", Combination::Rock)},
+                        10, FreeForAllMode::Elimination);
+    const MultiMove& m = s.playRound();
+    ASSERT_EQ(m.getWinningCombination(), Combination::Paper);
+    ASSERT_TRUE(s.isFinished());
+    ASSERT_EQ(s.getActiveCount(), 1u);
+    ASSERT_TRUE(s.isActive(0));
+    ASSERT_FALSE(s.isActive(1));
+    ASSERT_EQ(s.getEliminationRound(1), 0);
+    ASSERT_EQ(s.getEliminationRound(0), -1);
+    ASSERT_EQ(s.whoWinsView(), std::string_view("A"));
+}
+
+TEST_CASE("FreeForAllSession elimination plays only active players") {
+    // Round 0: B and C (Scissors) beat D (Paper); A sits on Scissors too.
+    // Round 1: A switches to Rock and knocks out the Scissors players.
+    FreeForAllSession s({scriptedPlayer("A", {Combination::Scissors, Combination::Rock}),
+                         fixedPlayer("B", Combination::Scissors),
+                         fixedPlayer("C", Combination::Scissors),
+                         fixedPlayer("D", Combination::Paper)},
+                        10, FreeForAllMode::Elimination);
+    s.playRound();
+    ASSERT_EQ(s.getActiveCount(), 3u);
+    ASSERT_FALSE(s.isActive(3));
+
+    const MultiMove& m = s.playRound();
+    ASSERT_EQ(m.getParticipantCount(), 3u);
+    ASSERT_EQ(m.getSeat(2), 2u);
+    ASSERT_TRUE(s.isFinished());
+    ASSERT_EQ(s.getLeaders(), (std::vector<std::size_t>{0}));
+    ASSERT_EQ(s.getScores()[0], 2);
+    ASSERT_EQ(s.getEliminationRound(1), 1);
+}
+
+TEST_CASE("FreeForAllSession tells players the crowd's gesture") {
+    auto recorder = std::make_shared<RecordingPlayer>();
+    FreeForAllSession s({recorder,
+                         fixedPlayer("P1", Combination::Paper),
+                         fixedPlayer("P2", Combination::Paper),
+                         fixedPlayer("S", Combination::Scissors)}, 1);
+    s.playRound();
+    ASSERT_EQ(recorder->observed, 1);
+    ASSERT_EQ(recorder->lastOwn, Combination::Rock);
+    ASSERT_EQ(recorder->lastCrowd, Combination::Paper);
+}
+
+TEST_CASE("FreeForAllSession reuses its round buffers") {
+    FreeForAllSession s({fixedPlayer("A", Combination::Rock),
+                         fixedPlayer("B", Combination::Paper),
+                         fixedPlayer("C", Combination::Scissors)}, 100);
+    ASSERT_TRUE(s.getLastRound() == nullptr);
+    const MultiMove* first = &s.playRound();
+    ASSERT_NO_ALLOCATIONS(for (int i = 0; i < 50; ++i) s.playRound());
+    ASSERT_TRUE(&s.playRound() == first);
+    ASSERT_TRUE(s.getLastRound() == first);
+    ASSERT_EQ(s.getRoundsPlayed(), 52);
+}
+
+TEST_CASE("FreeForAllSession runs a large lobby") {
+    std::vector<std::shared_ptr<IPlayer>> players;
+    for (int i = 0; i < 64; ++i) {
+        players.push_back(std::make_shared<ComputerAI>("Bot" + std::to_string(i)));
+    }
+    FreeForAllSession s(players, 50);
+    s.start();
+    ASSERT_EQ(s.getRoundsPlayed(), 50);
+    for (std::size_t seat = 0; seat < s.getPlayerCount(); ++seat) {
+        ASSERT_EQ(s.getScores()[seat] + s.getLosses()[seat] + s.getDraws()[seat], 50);
+    }
+}
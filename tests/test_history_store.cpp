@@ -0,0 +1,189 @@
+/**
+ * @file test_history_store.cpp
+ * @brief Unit tests for the columnar HistoryStore.
+ */
+#include "TestFramework.h"
+#include "kernel/Game.h"
+#include "kernel/HistoryStore.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    Move move(Combination user, Combination computer) {
+        return Move(Hand(user), Hand(computer));
+    }
+
+    const std::vector<Move> ROCK_WINS   = {move(Combination::Rock, Combination::Scissors),
+                                           move(Combination::Paper, Combination::Paper)};
+    const std::vector<Move> PAPER_LOSES = {move(Combination::Paper, Combination::Scissors),
+                                           move(Combination::Rock, Combination::Paper),
+                                           move(Combination::Rock, Combination::Scissors)};
+}
+
+TEST_CASE("HistoryStore aggregates sessions grouped by first gesture") {
+    HistoryStore store(1);
+    store.append("ann", "Computer", 1000, ROCK_WINS.data(), ROCK_WINS.size());
+    store.append("ann", "Computer", 2000, PAPER_LOSES.data(), PAPER_LOSES.size());
+    store.append("bob", "Computer", 3000, ROCK_WINS.data(), ROCK_WINS.size());
+    ASSERT_EQ(store.getSessionCount(), 3u);
+    ASSERT_EQ(store.getRoundCount(), 7u);
+
+    HistoryQuery q;
+    q.user = "ann";
+    HistoryResult r = store.query(q);
+    ASSERT_EQ(r.total.sessions, 2u);
+    ASSERT_EQ(r.total.sessionsWon, 1u);
+    ASSERT_EQ(r.total.sessionsLost, 1u);
+    ASSERT_EQ(r.total.rounds, 5u);
+    ASSERT_EQ(r.total.roundsWon, 2u);
+    ASSERT_EQ(r.total.roundsLost, 2u);
+
+    const auto& rock = r.byFirstGesture[static_cast<int>(Combination::Rock)];
+    const auto& paper = r.byFirstGesture[static_cast<int>(Combination::Paper)];
+    ASSERT_EQ(rock.sessions, 1u);
+    ASSERT_EQ(rock.winRate(), 1.0);
+    ASSERT_EQ(paper.sessions, 1u);
+    ASSERT_EQ(paper.sessionsLost, 1u);
+    ASSERT_EQ(r.byFirstGesture[static_cast<int>(Combination::Scissors)].sessions, 0u);
+}
+
+TEST_CASE("HistoryStore filters by time range and opponent") {
+    HistoryStore store(1);
+    store.append("ann", "Computer", 1000, ROCK_WINS.data(), ROCK_WINS.size());
+    store.append("ann", "Meta", 2000, ROCK_WINS.data(), ROCK_WINS.size());
+    store.append("ann", "Computer", 500, PAPER_LOSES.data(), PAPER_LOSES.size()); // out of order
+
+    HistoryQuery q;
+    q.user = "ann";
+    q.fromMs = 900;
+    q.toMs = 2000;
+    ASSERT_EQ(store.query(q).total.sessions, 1u);
+
+    q.fromMs = 0;
+    q.toMs = 5000;
+    q.opponent = "Computer";
+    ASSERT_EQ(store.query(q).total.sessions, 2u);
+
+    q.opponent = "nobody";
+    ASSERT_EQ(store.query(q).total.sessions, 0u);
+    q.opponent.clear();
+    q.user = "nobody";
+    ASSERT_EQ(store.query(q).total.sessions, 0u);
+}
+
+TEST_CASE("HistoryStore prunes chunks by user index and zone map") {
+    HistoryStore store(2);
+    const std::size_t sessions = HistoryStore::CHUNK_SESSIONS * 4;
+    for (std::size_t i = 0; i < sessions; ++i) {
+        // "rare" plays only in the second chunk.
+        const bool rare = i / HistoryStore::CHUNK_SESSIONS == 1 && i % 100 == 0;
+        store.append(rare ? "rare" : "u" + std::to_string(i % 50), "Computer",
+                     static_cast<std::int64_t>(i) * 10, ROCK_WINS.data(), ROCK_WINS.size());
+    }
+    ASSERT_EQ(store.getChunkCount(), 4u);
+
+    HistoryQuery q;
+    q.user = "rare";
+    HistoryResult r = store.query(q);
+    ASSERT_EQ(r.chunksScanned, 1u);
+    ASSERT_EQ(r.total.sessions, 41u);
+
+    HistoryQuery late;
+    late.fromMs = static_cast<std::int64_t>(HistoryStore::CHUNK_SESSIONS) * 30;
+    r = store.query(late);
+    ASSERT_EQ(r.chunksScanned, 1u);
+    ASSERT_EQ(r.total.sessions, HistoryStore::CHUNK_SESSIONS);
+
+    r = store.query(HistoryQuery{});
+    ASSERT_EQ(r.chunksScanned, 4u);
+    ASSERT_EQ(r.total.sessions, sessions);
+}
+
+TEST_CASE("HistoryStore parallel scans match a single-threaded scan") {
+    HistoryStore serial(1);
+    HistoryStore parallel(4);
+    std::mt19937 rng(3);
+    std::vector<Move> moves;
+    for (int s = 0; s < 20000; ++s) {
+        moves.clear();
+        const int rounds = static_cast<int>(rng() % 6);
+        for (int i = 0; i < rounds; ++i) {
+            moves.push_back(move(static_cast<Combination>(rng() % 3),
+                                 static_cast<Combination>(rng() % 3)));
+        }
+        const std::string user = "u" + std::to_string(rng() % 20);
+        serial.append(user, "Computer", s, moves.data(), moves.size());
+        parallel.append(user, "Computer", s, moves.data(), moves.size());
+    }
+    HistoryQuery q;
+    q.user = "u7";
+    q.fromMs = 1234;
+    q.toMs = 17777;
+    HistoryResult a = serial.query(q);
+    HistoryResult b = parallel.query(q);
+    ASSERT_TRUE(a.total.sessions > 0);
+    ASSERT_EQ(a.total.sessions, b.total.sessions);
+    ASSERT_EQ(a.total.roundsWon, b.total.roundsWon);
+    for (int g = 0; g < 3; ++g) {
+        ASSERT_EQ(a.byFirstGesture[g].sessionsWon, b.byFirstGesture[g].sessionsWon);
+    }
+    // Packed hands: well under one byte per round.
+    ASSERT_TRUE(serial.getMemoryBytes() < 20000 * 40 + serial.getRoundCount());
+}
+
+TEST_CASE("HistoryStore keeps hands aligned across odd-length sessions") {
+    HistoryStore store(1);
+    std::vector<Move> scissors(1001, move(Combination::Scissors, Combination::Paper));
+    scissors[1000] = move(Combination::Scissors, Combination::Rock);
+    store.append("ann", "Computer", 1, PAPER_LOSES.data(), PAPER_LOSES.size()); // odd offset next
+    store.append("ann", "Computer", 2, scissors.data(), scissors.size());
+    store.append("ann", "Computer", 3, ROCK_WINS.data(), ROCK_WINS.size());
+    store.append("ann", "Computer", 4, scissors.data(), scissors.size());
+    ASSERT_EQ(store.getRoundCount(), 2007u);
+
+    HistoryQuery q;
+    q.user = "ann";
+    HistoryResult r = store.query(q);
+    ASSERT_EQ(r.total.rounds, 2007u);
+    ASSERT_EQ(r.total.roundsWon, 2002u);
+    ASSERT_EQ(r.total.roundsLost, 4u);
+    ASSERT_EQ(r.byFirstGesture[static_cast<int>(Combination::Paper)].sessions, 1u);
+    ASSERT_EQ(r.byFirstGesture[static_cast<int>(Combination::Rock)].sessions, 1u);
+    ASSERT_EQ(r.byFirstGesture[static_cast<int>(Combination::Scissors)].sessions, 2u);
+}
+
+TEST_CASE("Game records finished sessions in its history store") {
+    auto store = std::make_shared<HistoryStore>(1);
+    auto user = std::make_shared<User>("Ann", []() { return Combination::Paper; });
+    auto rock = std::make_shared<User>("Rocky", []() { return Combination::Rock; });
+    Game game(user, rock);
+    game.setHistoryStore(store);
+    game.newSession(4);
+    for (int i = 0; i < 4; ++i) game.playSingleRound();
+
+    HistoryQuery q;
+    q.user = "Ann";
+    q.opponent = "Rocky";
+    HistoryResult r = store->query(q);
+    ASSERT_EQ(r.total.sessions, 1u);
+    ASSERT_EQ(r.total.roundsWon, 4u);
+    ASSERT_EQ(r.byFirstGesture[static_cast<int>(Combination::Paper)].sessionsWon, 1u);
+}
+
+BENCHMARK_CASE("HistoryStore user query over 20k sessions", 200) {
+    static HistoryStore store;
+    static bool filled = false;
+    if (!filled) {
+        for (int s = 0; s < 20000; ++s) {
+            store.append("u" + std::to_string(s % 100), "Computer", s, ROCK_WINS.data(),
+                         ROCK_WINS.size());
+        }
+        filled = true;
+    }
+    HistoryQuery q;
+    q.user = "u42";
+    q.fromMs = 2000;
+    q.toMs = 18000;
+    ASSERT_EQ(store.query(q).total.sessions, 160u);
+}
@@ -0,0 +1,52 @@
+/**
+ * @file test_latency_histogram.cpp
+ * @brief Unit tests for LatencyHistogram.
+ */
+#include "TestFramework.h"
+#include "kernel/LatencyHistogram.h"
+
+TEST_CASE("LatencyHistogram is empty on construction") {
+    LatencyHistogram h;
+    ASSERT_EQ(h.getCount(), 0u);
+    ASSERT_EQ(h.percentile(0.5), 0u);
+    ASSERT_EQ(h.getMin(), 0u);
+}
+
+TEST_CASE("LatencyHistogram small values are exact") {
+    LatencyHistogram h;
+    for (std::uint64_t v = 1; v <= 10; ++v) h.record(v);
+    ASSERT_EQ(h.percentile(0.5), 5u);
+    ASSERT_EQ(h.getMin(), 1u);
+    ASSERT_EQ(h.getMax(), 10u);
+    ASSERT_TRUE(h.getMean() == 5.5);
+}
+
+TEST_CASE("LatencyHistogram buckets contain their values") {
+    for (std::uint64_t v : {0ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, ~0ull}) {
+        std::size_t i = LatencyHistogram::bucketIndex(v);
+        ASSERT_TRUE(i < LatencyHistogram::BUCKETS);
+        ASSERT_TRUE(LatencyHistogram::bucketUpperBound(i) >= v);
+        if (i > 0) {
+            ASSERT_TRUE(LatencyHistogram::bucketUpperBound(i - 1) < v);
+        }
+    }
+}
+
+TEST_CASE("LatencyHistogram percentiles are within bucket precision") {
+    LatencyHistogram h;
+    for (std::uint64_t v = 1; v <= 100000; ++v) h.record(v);
+    std::uint64_t p99 = h.percentile(0.99);
+    ASSERT_TRUE(p99 >= 99000 && p99 <= 99000 + 99000 / 16);
+    ASSERT_EQ(h.percentile(1.0), 100000u);
+}
+
+TEST_CASE("LatencyHistogram merge adds counts") {
+    LatencyHistogram a, b;
+    a.record(10);
+    b.record(1000);
+    b.record(2000);
+    a.merge(b);
+    ASSERT_EQ(a.getCount(), 3u);
+    ASSERT_EQ(a.getMin(), 10u);
+    ASSERT_EQ(a.getMax(), 2000u);
+}
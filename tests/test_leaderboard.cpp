@@ -0,0 +1,195 @@
+/**
+ * @file test_leaderboard.cpp
+ * @brief Unit tests for the skip-list Leaderboard.
+ */
+#include "TestFramework.h"
+#include "kernel/Game.h"
+#include "kernel/Leaderboard.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Leaderboard ranks by wins, then win rate, then name") {
+    Leaderboard board;
+    board.recordSession("carol", true);
+    board.recordSession("carol", true);   // 2 / 2
+    board.recordSession("alice", true);
+    board.recordSession("alice", true);
+    board.recordSession("alice", false);  // 2 / 3
+    board.recordSession("bob", true);     // 1 / 1
+    board.recordSession("dave", true);    // 1 / 1, loses the name tie-break
+    board.recordSession("erin", false);   // 0 / 1
+
+    ASSERT_EQ(board.size(), 5u);
+    ASSERT_EQ(*board.rankOf("carol"), 1u);
+    ASSERT_EQ(*board.rankOf("alice"), 2u);
+    ASSERT_EQ(*board.rankOf("bob"), 3u);
+    ASSERT_EQ(*board.rankOf("dave"), 4u);
+    ASSERT_EQ(*board.rankOf("erin"), 5u);
+    ASSERT_FALSE(board.rankOf("nobody").has_value());
+
+    auto entry = board.find("alice");
+    ASSERT_TRUE(entry.has_value());
+    ASSERT_EQ(entry->sessionsPlayed, 3u);
+    ASSERT_EQ(entry->sessionsWon, 2u);
+}
+
+TEST_CASE("Leaderboard pages and top-K follow rank order") {
+    Leaderboard board;
+    for (int i = 0; i < 10; ++i) {
+        for (int w = 0; w < i; ++w) board.recordSession("p" + std::to_string(i), true);
+        board.recordSession("p" + std::to_string(i), false);
+    }
+    auto top = board.top(3);
+    ASSERT_EQ(top.size(), 3u);
+    ASSERT_EQ(top[0].name, std::string("p9"));
+    ASSERT_EQ(top[2].name, std::string("p7"));
+
+    auto page = board.page(8, 5);
+    ASSERT_EQ(page.size(), 2u);
+    ASSERT_EQ(page[0].name, std::string("p1"));
+    ASSERT_EQ(page[1].name, std::string("p0"));
+    ASSERT_TRUE(board.page(10, 5).empty());
+
+    board.clear();
+    ASSERT_EQ(board.size(), 0u);
+    ASSERT_TRUE(board.top(3).empty());
+}
+
+TEST_CASE("Leaderboard matches a sorted reference under random updates") {
+    Leaderboard board;
+    std::vector<LeaderboardEntry> reference(300);
+    for (std::size_t i = 0; i < reference.size(); ++i) {
+        reference[i].name = "user" + std::to_string(i);
+    }
+    std::mt19937 rng(7);
+    for (int step = 0; step < 20000; ++step) {
+        LeaderboardEntry& e = reference[rng() % reference.size()];
+        const bool won = rng() % 3 == 0;
+        ++e.sessionsPlayed;
+        if (won) ++e.sessionsWon;
+        board.recordSession(e.name, won);
+    }
+
+    std::vector<LeaderboardEntry> expected(reference);
+    expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                  [](const LeaderboardEntry& e) { return e.sessionsPlayed == 0; }),
+                   expected.end());
+    std::sort(expected.begin(), expected.end(), [](const LeaderboardEntry& a, const LeaderboardEntry& b) {
+        if (a.sessionsWon != b.sessionsWon) return a.sessionsWon > b.sessionsWon;
+        if (a.winRate() != b.winRate()) return a.winRate() > b.winRate();
+        return a.name < b.name;
+    });
+
+    auto all = board.page(0, expected.size() + 1);
+    ASSERT_EQ(all.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(all[i].name, expected[i].name);
+        ASSERT_EQ(*board.rankOf(expected[i].name), i + 1);
+        ASSERT_EQ(board.page(i, 1)[0].name, expected[i].name);
+    }
+}
+
+TEST_CASE("Leaderboard accepts concurrent updates and queries") {
+    Leaderboard board;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&board, t]() {
+            for (int i = 0; i < 2000; ++i) {
+                board.recordSession("u" + std::to_string(i % 100), (i + t) % 2 == 0);
+                if (i % 50 == 0) board.top(10);
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    ASSERT_EQ(board.size(), 100u);
+    std::uint64_t played = 0;
+    for (const auto& e : board.page(0, 100)) played += e.sessionsPlayed;
+    ASSERT_EQ(played, 8000u);
+}
+
+TEST_CASE("Leaderboard snapshots round-trip through disk") {
+    const std::string path = "rsp_leaderboard_test.snap";
+    Leaderboard board;
+    board.recordSession("alice", true);
+    board.recordSession("bob", false);
+    board.recordSession("bob", true);
+    ASSERT_TRUE(board.saveSnapshot(path));
+
+    Leaderboard restored;
+    restored.recordSession("stale", true);
+    ASSERT_TRUE(restored.loadSnapshot(path));
+    ASSERT_EQ(restored.size(), 2u);
+    ASSERT_FALSE(restored.find("stale").has_value());
+    ASSERT_EQ(restored.find("bob")->sessionsPlayed, 2u);
+    ASSERT_EQ(*restored.rankOf("bob"), 2u); // 1/2 trails alice at 1/1
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Leaderboard rejects missing and corrupt snapshots") {
+    const std::string path = "rsp_leaderboard_corrupt.snap";
+    Leaderboard board;
+    board.recordSession("alice", true);
+    ASSERT_FALSE(board.loadSnapshot("rsp_leaderboard_missing.snap"));
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not a leaderboard";
+    }
+    ASSERT_FALSE(board.loadSnapshot(path));
+    ASSERT_EQ(board.size(), 1u); // unchanged on failure
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Leaderboard writes periodic snapshots and a final one on stop") {
+    const std::string path = "rsp_leaderboard_periodic.snap";
+    std::remove(path.c_str());
+    Leaderboard board;
+    board.recordSession("alice", true);
+    ASSERT_TRUE(board.startSnapshots(path, std::chrono::milliseconds(10)));
+    ASSERT_FALSE(board.startSnapshots(path, std::chrono::milliseconds(10)));
+    board.recordSession("bob", true);
+    board.stopSnapshots();
+
+    Leaderboard restored;
+    ASSERT_TRUE(restored.loadSnapshot(path));
+    ASSERT_EQ(restored.size(), 2u);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Game reports finished sessions to its leaderboard") {
+    auto board = std::make_shared<Leaderboard>();
+    auto user = std::make_shared<User>("Ann", []() { return Combination::Paper; });
+    auto rock = std::make_shared<User>("Rocky", []() { return Combination::Rock; });
+    Game game(user, rock);
+    game.setLeaderboard(board);
+
+    for (int s = 0; s < 2; ++s) {
+        game.newSession(3);
+        game.playSingleRound();
+        ASSERT_FALSE(board->find("Ann").has_value() && s == 0);
+        game.playSingleRound();
+        game.playSingleRound();
+    }
+    auto entry = board->find("Ann");
+    ASSERT_TRUE(entry.has_value());
+    ASSERT_EQ(entry->sessionsPlayed, 2u);
+    ASSERT_EQ(entry->sessionsWon, 2u);
+}
+
+BENCHMARK_CASE("Leaderboard recordSession over 100k users", 100000) {
+    static Leaderboard board;
+    static std::uint64_t n = 0;
+    static const std::vector<std::string> names = []() {
+        std::vector<std::string> v;
+        for (int i = 0; i < 100000; ++i) v.push_back("user" + std::to_string(i));
+        return v;
+    }();
+    const std::uint64_t i = n++ * 2654435761u;
+    board.recordSession(names[i % names.size()], (i >> 20) % 2 == 0);
+}
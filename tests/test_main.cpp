@@ -1,10 +1,13 @@
 /**
  * @file test_main.cpp
  * @brief Test runner entry-point – just invokes all auto-registered tests.
+ *
+ * Accepts the options documented in TestFramework.h (name filter,
+ * worker count, benchmark control).
  */
 #include "TestFramework.h"
 
-int main() {
+int main(int argc, char** argv) {
     std::cout << "\n  ===== Rock-Scissors-Paper Unit Tests =====\n\n";
-    return TestRunner::instance().runAll();
+    return TestRunner::instance().runAll(argc, argv);
 }
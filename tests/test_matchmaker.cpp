@@ -0,0 +1,172 @@
+/**
+ * @file test_matchmaker.cpp
+ * @brief Unit tests for the rating-based Matchmaker.
+ */
+#include "TestFramework.h"
+#include "kernel/Matchmaker.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    std::shared_ptr<IPlayer> bot(const std::string& name) {
+        return std::make_shared<ComputerAI>(name);
+    }
+
+    using Clock = Matchmaker::Clock;
+}
+
+TEST_CASE("Matchmaker pairs players of the same bucket in join order") {
+    Matchmaker mm;
+    const auto t0 = Clock::now();
+    mm.join(bot("A"), 1010, t0);
+    mm.join(bot("B"), 1020, t0);
+    mm.join(bot("C"), 1030, t0);
+    ASSERT_EQ(mm.getWaitingCount(), 3u);
+
+    auto matches = mm.pump(t0);
+    ASSERT_EQ(matches.size(), 1u);
+    ASSERT_EQ(matches[0].first->getName(), std::string("A"));
+    ASSERT_EQ(matches[0].second->getName(), std::string("B"));
+    ASSERT_EQ(mm.getWaitingCount(), 1u);
+
+    mm.join(bot("D"), 1040, t0);
+    matches = mm.pump(t0);
+    ASSERT_EQ(matches.size(), 1u);
+    ASSERT_EQ(matches[0].first->getName(), std::string("C"));
+    ASSERT_EQ(matches[0].secondRating, 1040);
+    ASSERT_EQ(mm.getMatchCount(), 2u);
+}
+
+TEST_CASE("Matchmaker pairs neighbouring buckets within the base gap") {
+    Matchmaker mm;
+    const auto t0 = Clock::now();
+    mm.join(bot("A"), 1040, t0);
+    mm.join(bot("B"), 1090, t0);
+    auto matches = mm.pump(t0);
+    ASSERT_EQ(matches.size(), 1u);
+    ASSERT_EQ(matches[0].firstRating, 1040);
+    ASSERT_EQ(matches[0].secondRating, 1090);
+}
+
+TEST_CASE("Matchmaker widens the rating gap with wait time") {
+    MatchmakerConfig cfg;
+    cfg.baseGap = 100;
+    cfg.gapPerSecond = 100.0;
+    cfg.maxGap = 400;
+    Matchmaker mm(cfg);
+    const auto t0 = Clock::now();
+    mm.join(bot("Low"), 1000, t0);
+    mm.join(bot("High"), 1300, t0);
+
+    ASSERT_EQ(mm.pump(t0).size(), 0u);
+    ASSERT_EQ(mm.pump(t0 + std::chrono::seconds(1)).size(), 0u);
+    auto matches = mm.pump(t0 + std::chrono::seconds(2));
+    ASSERT_EQ(matches.size(), 1u);
+    ASSERT_TRUE(matches[0].waitSeconds >= 2.0);
+
+    mm.join(bot("Far1"), 0, t0);
+    mm.join(bot("Far2"), 4000, t0);
+    ASSERT_EQ(mm.pump(t0 + std::chrono::hours(1)).size(), 0u);
+}
+
+TEST_CASE("Matchmaker clamps ratings and rejects null players") {
+    Matchmaker mm;
+    mm.join(bot("Neg"), -500);
+    mm.join(bot("Big"), 99999);
+    ASSERT_THROWS(mm.join(nullptr, 1000), std::invalid_argument);
+    ASSERT_EQ(mm.getJoinCount(), 2u);
+    ASSERT_EQ(mm.pump().size(), 0u);
+}
+
+TEST_CASE("Match creates a playable Game and Session") {
+    Matchmaker mm;
+    mm.join(bot("A"), 1500);
+    mm.join(bot("B"), 1500);
+    auto matches = mm.pump();
+    ASSERT_EQ(matches.size(), 1u);
+
+    auto game = matches[0].makeGame();
+    game->newSession(3);
+    for (int i = 0; i < 3; ++i) game->playSingleRound();
+    ASSERT_EQ(game->getState(), GameState::Finished);
+
+    auto session = matches[0].makeSession(5);
+    session->start();
+    ASSERT_EQ(session->getRoundsPlayed(), 5);
+}
+
+TEST_CASE("Matchmaker pairs every player joined from many threads") {
+    Matchmaker mm;
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 2000;
+    std::vector<std::thread> joiners;
+    for (int t = 0; t < THREADS; ++t) {
+        joiners.emplace_back([&mm, t]() {
+            auto player = bot("T" + std::to_string(t));
+            for (int i = 0; i < PER_THREAD; ++i) {
+                mm.join(player, 1000 + (i % 7) * 10);
+            }
+        });
+    }
+    std::size_t matched = 0;
+    std::atomic<bool> done{false};
+    std::thread matcher([&]() {
+        while (!done.load()) matched += mm.pump().size();
+    });
+    for (auto& th : joiners) th.join();
+    done.store(true);
+    matcher.join();
+    matched += mm.pump().size();
+
+    ASSERT_EQ(matched, static_cast<std::size_t>(THREADS * PER_THREAD / 2));
+    ASSERT_EQ(mm.getWaitingCount(), 0u);
+}
+
+TEST_CASE("Matchmaker background matcher delivers to the callback") {
+    Matchmaker mm;
+    std::atomic<int> delivered{0};
+    mm.onMatch([&](Match& m) {
+        if (m.first && m.second) delivered.fetch_add(1);
+    });
+    ASSERT_TRUE(mm.start(std::chrono::milliseconds(1)));
+    ASSERT_FALSE(mm.start());
+    for (int i = 0; i < 20; ++i) mm.join(bot("P"), 2000);
+
+    const auto deadline = Clock::now() + std::chrono::seconds(5);
+    while (delivered.load() < 10 && Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    mm.stop();
+    ASSERT_EQ(delivered.load(), 10);
+}
+
+TEST_CASE("Matchmaker background matcher keeps players queued without a callback") {
+    Matchmaker mm;
+    ASSERT_TRUE(mm.start(std::chrono::milliseconds(1)));
+    for (int i = 0; i < 4; ++i) mm.join(bot("P"), 2000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_EQ(mm.getWaitingCount(), 4u);
+
+    std::atomic<int> delivered{0};
+    mm.onMatch([&](Match&) { delivered.fetch_add(1); });
+    const auto deadline = Clock::now() + std::chrono::seconds(5);
+    while (delivered.load() < 2 && Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    mm.stop();
+    ASSERT_EQ(delivered.load(), 2);
+    ASSERT_EQ(mm.getWaitingCount(), 0u);
+}
+
+BENCHMARK_CASE("Matchmaker join", 100000) {
+    static Matchmaker mm;
+    static auto player = bot("Bench");
+    static std::uint64_t n = 0;
+    mm.join(player, static_cast<int>(n % 3000));
+    if (++n % 4096 == 0) mm.pump();
+}
@@ -0,0 +1,68 @@
+/**
+ * @file test_meta_ai.cpp
+ * @brief Unit tests for the MetaAI ensemble player.
+ */
+#include "TestFramework.h"
+#include "kernel/MetaAI.h"
+#include "kernel/Session.h"
+#include "kernel/User.h"
+#include "kernel/ComputerAI.h"
+#include <memory>
+
+/// Helper: bot cycling Rock → Scissors → Paper.
+static std::shared_ptr<IPlayer> makeCycleBot() {
+    auto round = std::make_shared<int>(0);
+    return std::make_shared<User>("CycleBot", [round]() {
+        return static_cast<Combination>((*round)++ % 3);
+    });
+}
+
+TEST_CASE("MetaAI default name is MetaAI") {
+    MetaAI ai;
+    ASSERT_EQ(ai.getName(), std::string("MetaAI"));
+}
+
+TEST_CASE("MetaAI runs dozens of predictors") {
+    MetaAI ai;
+    ASSERT_TRUE(ai.getPredictorCount() >= 24);
+}
+
+TEST_CASE("MetaAI first move is valid with no history") {
+    MetaAI ai;
+    Combination c = ai.chooseHand().getCombination();
+    ASSERT_TRUE(c == Combination::Rock ||
+                c == Combination::Scissors ||
+                c == Combination::Paper);
+    ASSERT_EQ(ai.getLastEvaluatedCount(), 0u);
+}
+
+TEST_CASE("MetaAI crushes a constant opponent") {
+    auto bot = std::make_shared<User>("RockBot", []() { return Combination::Rock; });
+    auto ai  = std::make_shared<MetaAI>();
+    Session s(bot, ai, 200);
+    s.start();
+    ASSERT_TRUE(s.getComputerScore() > 180);
+}
+
+TEST_CASE("MetaAI learns a cyclic opponent") {
+    auto ai = std::make_shared<MetaAI>();
+    Session s(makeCycleBot(), ai, 300);
+    s.start();
+    ASSERT_TRUE(s.getComputerScore() > 250);
+}
+
+TEST_CASE("MetaAI with zero budget skips the history matchers") {
+    MetaAI ai("Hasty", std::chrono::nanoseconds(0));
+    ai.observeRound(Hand(Combination::Rock), Hand(Combination::Paper));
+    ai.chooseHand();
+    ASSERT_TRUE(ai.getLastEvaluatedCount() > 0);
+    ASSERT_TRUE(ai.getLastEvaluatedCount() < ai.getPredictorCount());
+}
+
+TEST_CASE("MetaAI holds its own against random play") {
+    auto ai = std::make_shared<MetaAI>();
+    Session s(std::make_shared<ComputerAI>(), ai, 1000);
+    s.start();
+    // Random play cannot be exploited; MetaAI must not be exploited either.
+    ASSERT_TRUE(s.getUserScore() < 420);
+}
@@ -0,0 +1,196 @@
+/**
+ * @file test_metrics.cpp
+ * @brief Unit tests for the metrics registry, exporters and kernel metrics.
+ */
+#include "TestFramework.h"
+#include "kernel/Metrics.h"
+#include "kernel/MetricsHttpServer.h"
+#include "kernel/AllocationTracker.h"
+#include "kernel/Game.h"
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+TEST_CASE("MetricCounter sums shards from many threads") {
+    MetricCounter c;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&c]() { for (int i = 0; i < 10000; ++i) c.inc(); });
+    }
+    for (auto& th : threads) th.join();
+    ASSERT_EQ(c.value(), 40000u);
+}
+
+TEST_CASE("MetricHistogram merges shards for quantiles") {
+    MetricHistogram h;
+    for (std::uint64_t v = 1; v <= 1000; ++v) h.record(v);
+    auto snap = h.snapshot();
+    ASSERT_EQ(snap.count, 1000u);
+    ASSERT_EQ(snap.sum, 500500u);
+    ASSERT_TRUE(snap.quantile(0.5) >= 500 && snap.quantile(0.5) < 540);
+}
+
+TEST_CASE("Recording a metric does not allocate") {
+    MetricCounter c;
+    MetricHistogram h;
+    ASSERT_NO_ALLOCATIONS(c.inc());
+    ASSERT_NO_ALLOCATIONS(h.record(123));
+}
+
+TEST_CASE("MetricsRegistry renders Prometheus text") {
+    MetricsRegistry r;
+    r.counter("t_requests_total", "Requests.", "code=\"200\"").inc(3);
+    r.counter("t_requests_total", "Requests.", "code=\"500\"").inc();
+    r.gauge("t_in_flight", "In flight.").set(-2);
+    r.histogram("t_latency", "Latency.").record(10);
+
+    const std::string text = r.renderPrometheus();
+    ASSERT_TRUE(text.find("# TYPE t_requests_total counter\n") != std::string::npos);
+    ASSERT_TRUE(text.find("t_requests_total{code=\"200\"} 3\n") != std::string::npos);
+    ASSERT_TRUE(text.find("t_requests_total{code=\"500\"} 1\n") != std::string::npos);
+    ASSERT_TRUE(text.find("t_in_flight -2\n") != std::string::npos);
+    ASSERT_TRUE(text.find("t_latency{quantile=\"0.99\"} 10\n") != std::string::npos);
+    ASSERT_TRUE(text.find("t_latency_count 1\n") != std::string::npos);
+    // HELP/TYPE only once per family.
+    ASSERT_EQ(text.find("# TYPE t_requests_total"), text.rfind("# TYPE t_requests_total"));
+}
+
+TEST_CASE("MetricsRegistry returns the same metric for the same name") {
+    MetricsRegistry r;
+    ASSERT_EQ(&r.counter("a", "x"), &r.counter("a", "x"));
+    ASSERT_NE(&r.counter("a", "x"), &r.counter("a", "x", "l=\"1\""));
+}
+
+TEST_CASE("MetricsRegistry writeToFile writes the exposition") {
+    MetricsRegistry r;
+    r.counter("t_file_total", "File test.").inc(7);
+    const std::string path = "rsp_metrics_test.prom";
+    ASSERT_TRUE(r.writeToFile(path));
+    std::ifstream in(path);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    ASSERT_TRUE(ss.str().find("t_file_total 7") != std::string::npos);
+
+    // Rewriting replaces the previous exposition in place.
+    r.counter("t_file_total", "File test.").inc();
+    ASSERT_TRUE(r.writeToFile(path));
+    std::ifstream again(path);
+    std::stringstream ss2;
+    ss2 << again.rdbuf();
+    ASSERT_TRUE(ss2.str().find("t_file_total 8") != std::string::npos);
+    ASSERT_FALSE(std::ifstream(path + ".tmp").good());
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Kernel metrics count rounds, results and sessions") {
+    KernelMetrics& km = KernelMetrics::get();
+    const auto rounds0   = km.rounds.value();
+    const auto userWins0 = km.userWins.value();
+    const auto finished0 = km.sessionsFinished.value();
+
+    Game g(std::make_shared<User>("P", []() { return Combination::Paper; }),
+           std::make_shared<User>("R", []() { return Combination::Rock; }));
+    g.newSession(4);
+    while (g.getState() == GameState::Running) g.playSingleRound();
+
+    ASSERT_TRUE(km.rounds.value() - rounds0 >= 4);
+    ASSERT_TRUE(km.userWins.value() - userWins0 >= 4);
+    ASSERT_TRUE(km.sessionsFinished.value() - finished0 >= 1);
+}
+
+#if !defined(_WIN32)
+TEST_CASE("MetricsHttpServer serves /metrics on loopback") {
+    MetricsRegistry r;
+    r.counter("t_http_total", "HTTP test.").inc(42);
+    MetricsHttpServer server(r);
+    ASSERT_TRUE(server.start(0));
+    ASSERT_TRUE(server.getPort() != 0);
+
+    auto fetch = [&](const std::string& path) {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(server.getPort());
+        std::string out;
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+            std::string req = "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+            ::send(fd, req.data(), req.size(), 0);
+            char buf[4096];
+            ssize_t n;
+            while ((n = ::recv(fd, buf, sizeof(buf), 0)) > 0) out.append(buf, static_cast<std::size_t>(n));
+        }
+        ::close(fd);
+        return out;
+    };
+
+    std::string ok = fetch("/metrics");
+    ASSERT_TRUE(ok.find("200 OK") != std::string::npos);
+    ASSERT_TRUE(ok.find("t_http_total 42") != std::string::npos);
+    ASSERT_TRUE(fetch("/other").find("404") != std::string::npos);
+
+    // A client that connects and never sends must not block later scrapes.
+    int silent = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(server.getPort());
+    ASSERT_EQ(::connect(silent, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    ASSERT_TRUE(fetch("/metrics").find("t_http_total 42") != std::string::npos);
+
+    const auto stopStart = std::chrono::steady_clock::now();
+    server.stop();
+    ASSERT_TRUE(std::chrono::steady_clock::now() - stopStart < std::chrono::seconds(2));
+    ASSERT_EQ(server.getPort(), 0);
+    ::close(silent);
+}
+
+TEST_CASE("MetricsHttpServer survives scrapers that hang up mid-response") {
+    MetricsRegistry r;
+    const std::string help(2048, 'h');
+    for (int i = 0; i < 3000; ++i) {
+        r.counter("t_big_" + std::to_string(i) + "_total", help).inc(i);
+    }
+    MetricsHttpServer server(r);
+    ASSERT_TRUE(server.start(0));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(server.getPort());
+
+    // Each client asks for ~6 MB and closes without reading: the server
+    // hits EPIPE / ECONNRESET and must drop it rather than die on SIGPIPE.
+    const std::string req = "GET /metrics HTTP/1.1\r\n\r\n";
+    for (int c = 0; c < 3; ++c) {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+        ASSERT_EQ(::send(fd, req.data(), req.size(), 0), static_cast<ssize_t>(req.size()));
+        ::close(fd);
+    }
+
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    ::send(fd, req.data(), req.size(), 0);
+    std::string out;
+    char buf[65536];
+    ssize_t n;
+    while ((n = ::recv(fd, buf, sizeof(buf), 0)) > 0) out.append(buf, static_cast<std::size_t>(n));
+    ::close(fd);
+    ASSERT_TRUE(out.find("t_big_2999_total 2999") != std::string::npos);
+    server.stop();
+}
+#endif
+
+BENCHMARK_CASE("MetricCounter inc on the round path", 5e6) {
+    KernelMetrics::get().rounds.inc(0);
+}
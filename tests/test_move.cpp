@@ -45,3 +45,10 @@ TEST_CASE("moveResultToString ComputerWins") {
 TEST_CASE("moveResultToString Draw") {
     ASSERT_EQ(moveResultToString(MoveResult::Draw), std::string("Draw"));
 }
+
+static_assert(moveResultLabel(MoveResult::Draw) == "Draw",
+              "moveResultLabel must be usable in constant expressions");
+
+TEST_CASE("moveResultLabel ComputerWins") {
+    ASSERT_TRUE(moveResultLabel(MoveResult::ComputerWins) == "Computer Wins");
+}
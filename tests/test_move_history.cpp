@@ -0,0 +1,81 @@
+/**
+ * @file test_move_history.cpp
+ * @brief Unit tests for the disk-spilling MoveHistory.
+ */
+#include "TestFramework.h"
+#include "kernel/MoveHistory.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace {
+    /// Deterministic round i: cycles through all nine gesture pairs.
+    Move roundAt(std::uint64_t i) {
+        return Move(Hand(static_cast<Combination>((i / 3) % 3)),
+                    Hand(static_cast<Combination>(i % 3)));
+    }
+
+    bool sameMove(const Move& a, const Move& b) {
+        return a.getUserHand() == b.getUserHand() &&
+               a.getComputerHand() == b.getComputerHand();
+    }
+}
+
+TEST_CASE("MoveHistory without a limit keeps everything in memory") {
+    MoveHistory h;
+    for (int i = 0; i < 100; ++i) h.push_back(roundAt(i));
+    ASSERT_EQ(h.size(), 100u);
+    ASSERT_EQ(h.getSpilledCount(), 0u);
+    ASSERT_TRUE(sameMove(h[42], roundAt(42)));
+    ASSERT_TRUE(sameMove(h.back(), roundAt(99)));
+}
+
+TEST_CASE("MoveHistory spills old rounds and pages them back in") {
+    MoveHistory h(10);
+    ASSERT_EQ(h.getSegmentRounds(), 5u);
+    for (int i = 0; i < 1003; ++i) h.push_back(roundAt(i));
+
+    ASSERT_EQ(h.size(), 1003u);
+    ASSERT_TRUE(h.getInMemoryCount() <= 10u);
+    ASSERT_EQ(h.getSpilledCount() + h.getInMemoryCount(), 1003u);
+    for (std::uint64_t i = 0; i < h.size(); ++i) {
+        ASSERT_TRUE(sameMove(h[i], roundAt(i)));
+    }
+    // Random access in reverse exercises segment reloads.
+    for (std::uint64_t i = h.size(); i-- > 0;) {
+        ASSERT_TRUE(sameMove(h.at(i), roundAt(i)));
+    }
+}
+
+TEST_CASE("MoveHistory iterates over disk and memory in order") {
+    MoveHistory h(7);
+    for (int i = 0; i < 50; ++i) h.push_back(roundAt(i));
+    std::uint64_t i = 0;
+    for (const Move& m : h) {
+        ASSERT_TRUE(sameMove(m, roundAt(i)));
+        ++i;
+    }
+    ASSERT_EQ(i, 50u);
+}
+
+TEST_CASE("MoveHistory packs spilled rounds into 4 bits each") {
+    const std::string path = "rsp_history_test.seg";
+    {
+        MoveHistory h(2000, path);
+        for (int i = 0; i < 10000; ++i) h.push_back(roundAt(i));
+        ASSERT_EQ(h.getSpilledCount(), 8000u);
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        ASSERT_EQ(static_cast<std::uint64_t>(in.tellg()), 4000u);
+        ASSERT_TRUE(sameMove(h[1234], roundAt(1234)));
+    }
+    std::ifstream gone(path);
+    ASSERT_FALSE(gone.good());
+}
+
+TEST_CASE("MoveHistory rejects out-of-range indices") {
+    MoveHistory h(4);
+    ASSERT_TRUE(h.empty());
+    ASSERT_THROWS(h.back(), std::out_of_range);
+    h.push_back(roundAt(0));
+    ASSERT_THROWS(h[1], std::out_of_range);
+}
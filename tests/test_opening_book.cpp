@@ -0,0 +1,207 @@
+/**
+ * @file test_opening_book.cpp
+ * @brief Unit tests for OpeningBook, OpeningBookBuilder and OpeningBookAI.
+ */
+#include "TestFramework.h"
+#include "kernel/Game.h"
+#include "kernel/OpeningBookAI.h"
+#include "kernel/Session.h"
+#include "kernel/User.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr Combination R = Combination::Rock;
+    constexpr Combination S = Combination::Scissors;
+    constexpr Combination P = Combination::Paper;
+
+    std::string bookPath(const char* tag) {
+        return std::string("rsp_test_book_") + tag + ".bin";
+    }
+
+    /// Plays a scripted sequence of gestures, then Rock.
+    std::shared_ptr<IPlayer> script(std::vector<Combination> moves) {
+        auto i = std::make_shared<std::size_t>(0);
+        return std::make_shared<User>("Script", [moves, i]() {
+            return *i < moves.size() ? moves[(*i)++] : Combination::Rock;
+        });
+    }
+}
+
+TEST_CASE("OpeningBook round-trips the builder's trie") {
+    const std::string path = bookPath("roundtrip");
+    OpeningBookBuilder builder(4);
+    builder.add(nullptr, 0, P, 3);
+    builder.add(nullptr, 0, R, 1);
+    const Combination rs[] = {R, S};
+    builder.add(rs, 2, R, 5);
+    const Combination p[] = {P};
+    builder.add(p, 1, S, 2);
+    ASSERT_EQ(builder.getNodeCount(), 4u);
+    ASSERT_THROWS(builder.add(rs, 5, R), std::invalid_argument);
+    ASSERT_TRUE(builder.write(path));
+
+    auto book = OpeningBook::open(path);
+    ASSERT_TRUE(book != nullptr);
+    ASSERT_EQ(book->getNodeCount(), 4u);
+    ASSERT_EQ(book->getMaxDepth(), 2u);
+
+    const std::uint32_t root = book->root();
+    ASSERT_EQ(book->node(root).responses[static_cast<int>(P)], 3u);
+    ASSERT_EQ(book->node(root).responses[static_cast<int>(R)], 1u);
+    ASSERT_EQ(book->node(root).weight, 4u);
+    ASSERT_EQ(book->child(root, S), OpeningBook::NONE);
+
+    const std::uint32_t afterP = book->child(root, P);
+    ASSERT_NE(afterP, OpeningBook::NONE);
+    ASSERT_EQ(book->node(afterP).responses[static_cast<int>(S)], 2u);
+
+    const std::uint32_t afterRS = book->child(book->child(root, R), S);
+    ASSERT_NE(afterRS, OpeningBook::NONE);
+    ASSERT_EQ(book->node(afterRS).responses[static_cast<int>(R)], 5u);
+    ASSERT_EQ(book->child(afterRS, R), OpeningBook::NONE);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("OpeningBook rejects missing, foreign and truncated files") {
+    ASSERT_TRUE(OpeningBook::open("no_such_book.bin") == nullptr);
+
+    const std::string path = bookPath("bad");
+    { std::ofstream(path, std::ios::binary) << "definitely not an opening book, just text"; }
+    ASSERT_TRUE(OpeningBook::open(path) == nullptr);
+
+    OpeningBookBuilder builder;
+    const Combination r[] = {R};
+    builder.add(r, 1, P);
+    ASSERT_TRUE(builder.write(path));
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    { std::ofstream(path, std::ios::binary) << bytes.substr(0, bytes.size() - 4); }
+    ASSERT_TRUE(OpeningBook::open(path) == nullptr);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("OpeningBook stops at child links that point outside the book") {
+    const std::string path = bookPath("corrupt");
+    OpeningBookBuilder builder;
+    const Combination r[] = {R};
+    builder.add(r, 1, P);
+    ASSERT_TRUE(builder.write(path));
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(64); // the root's firstChild
+        const std::uint32_t bogus = 1000000;
+        f.write(reinterpret_cast<const char*>(&bogus), sizeof bogus);
+    }
+    auto book = OpeningBook::open(path);
+    ASSERT_TRUE(book != nullptr);
+    ASSERT_EQ(book->child(book->root(), R), OpeningBook::NONE);
+    ASSERT_EQ(book->child(OpeningBook::NONE, R), OpeningBook::NONE);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("OpeningBookAI plays mined counters, then its fallback") {
+    const std::string path = bookPath("mined");
+    // The user's logged sessions always open Rock, Scissors, Paper.
+    OpeningBookBuilder builder(8);
+    const std::vector<Move> log = {Move(Hand(R), Hand(R)), Move(Hand(S), Hand(R)),
+                                   Move(Hand(P), Hand(R))};
+    for (int i = 0; i < 10; ++i) builder.addSession(log.data(), log.size());
+    ASSERT_TRUE(builder.write(path));
+
+    auto ai = std::make_shared<OpeningBookAI>(OpeningBook::open(path), nullptr, "Book", 1, 7);
+    Session session(script({R, S, P}), ai, 5);
+    session.start();
+
+    const MoveHistory& moves = session.getMoves();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(moves[i].getWhoWins() == MoveResult::ComputerWins);
+    }
+    ASSERT_EQ(ai->getBookMoves(), 3u);
+    ASSERT_EQ(ai->getFallbackMoves(), 2u);
+    ASSERT_FALSE(ai->isInBook());
+    std::remove(path.c_str());
+}
+
+TEST_CASE("OpeningBookAI restarts the book in every Game session") {
+    const std::string path = bookPath("game");
+    OpeningBookBuilder builder(8);
+    const std::vector<Move> log = {Move(Hand(R), Hand(R)), Move(Hand(S), Hand(R)),
+                                   Move(Hand(P), Hand(R))};
+    builder.addSession(log.data(), log.size());
+    ASSERT_TRUE(builder.write(path));
+
+    auto turn = std::make_shared<int>(0);
+    auto user = std::make_shared<User>("Opener", [turn]() {
+        const Combination opening[] = {R, S, P};
+        return opening[(*turn)++ % 3];
+    });
+    auto ai = std::make_shared<OpeningBookAI>(OpeningBook::open(path), nullptr, "Book", 1, 3);
+    Game game(user, ai);
+    for (int session = 1; session <= 2; ++session) {
+        game.newSession(3);
+        ASSERT_TRUE(ai->isInBook());
+        for (int i = 0; i < 3; ++i) game.playSingleRound();
+        ASSERT_EQ(game.getCurrentSession()->getComputerScore(), 3);
+    }
+    ASSERT_EQ(ai->getBookMoves(), 6u);
+    ASSERT_EQ(ai->getFallbackMoves(), 0u);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("OpeningBookAI leaves the book on unknown lines and thin nodes") {
+    const std::string path = bookPath("thin");
+    OpeningBookBuilder builder;
+    builder.add(nullptr, 0, P, 2);
+    const Combination r[] = {R};
+    builder.add(r, 1, P, 1);
+    ASSERT_TRUE(builder.write(path));
+    auto book = OpeningBook::open(path);
+
+    OpeningBookAI picky(book, nullptr, "Picky", 2, 1);
+    ASSERT_TRUE(picky.chooseHand().getCombination() == P); // weight 2
+    picky.observeRound(Hand(P), Hand(R));
+    ASSERT_TRUE(picky.isInBook());
+    picky.chooseHand();                                    // weight 1 < 2
+    ASSERT_EQ(picky.getFallbackMoves(), 1u);
+
+    OpeningBookAI other(book, nullptr, "Other", 1, 1);     // same mapping
+    other.observeRound(Hand(P), Hand(S));                  // not in the book
+    ASSERT_FALSE(other.isInBook());
+
+    OpeningBookAI none(nullptr);
+    none.chooseHand();
+    ASSERT_EQ(none.getFallbackMoves(), 1u);
+    std::remove(path.c_str());
+}
+
+BENCHMARK_CASE("OpeningBookAI move through a depth-8 book", 500000) {
+    static std::shared_ptr<const OpeningBook> book;
+    static std::unique_ptr<OpeningBookAI> ai;
+    static std::uint32_t n = 0;
+    if (!book) {
+        const std::string path = bookPath("bench");
+        OpeningBookBuilder builder(8);
+        std::vector<Move> log(9, Move(Hand(R), Hand(R)));
+        for (std::uint32_t s = 0; s < 6561; ++s) { // every 8-gesture opening
+            std::uint32_t x = s;
+            for (Move& m : log) {
+                m = Move(Hand(static_cast<Combination>(x % 3)), Hand(R));
+                x /= 3;
+            }
+            builder.addSession(log.data(), log.size());
+        }
+        builder.write(path);
+        book = OpeningBook::open(path);
+        std::remove(path.c_str()); // the mapping stays valid
+        ai = std::make_unique<OpeningBookAI>(book, nullptr, "Bench", 1, 1);
+    }
+    if (++n % 8 == 0) ai->reset();
+    const Hand own = ai->chooseHand();
+    ai->observeRound(own, Hand(static_cast<Combination>((n * 7) % 3)));
+}
@@ -5,6 +5,7 @@
 #include "TestFramework.h"
 #include "kernel/User.h"
 #include "kernel/ComputerAI.h"
+#include "kernel/AllocationTracker.h"
 
 // ── User ───────────────────────────────────────────────────────────
 
@@ -62,3 +63,31 @@ TEST_CASE("ComputerAI chooseHand returns valid combination") {
                     c == Combination::Paper);
     }
 }
+
+// ── Name views ─────────────────────────────────────────────────────
+
+TEST_CASE("Players own their names and return stable views") {
+    User u("Carol", []() { return Combination::Rock; });
+    ComputerAI ai("Carol");
+    ASSERT_TRUE(u.getNameView() == "Carol");
+    ASSERT_TRUE(ai.getNameView() == u.getNameView());
+    ASSERT_EQ(u.getUsernameView().data(), u.getNameView().data());
+    ASSERT_EQ(u.getNameView().data(), u.getNameView().data());
+}
+
+TEST_CASE("getNameView does not allocate") {
+    User u("Dave", []() { return Combination::Rock; });
+    ComputerAI ai;
+    ASSERT_NO_ALLOCATIONS(u.getNameView());
+    ASSERT_NO_ALLOCATIONS(ai.getNameView());
+}
+
+TEST_CASE("Default getNameView caches getName for legacy players") {
+    struct LegacyPlayer : IPlayer {
+        std::string getName() const override { return "A rather long legacy player name"; }
+        Hand chooseHand() override { return Hand(); }
+    } legacy;
+    ASSERT_TRUE(legacy.getNameView() == "A rather long legacy player name");
+    ASSERT_EQ(legacy.getNameView().data(), legacy.getNameView().data());
+    ASSERT_NO_ALLOCATIONS(legacy.getNameView()); // cached after the first call
+}
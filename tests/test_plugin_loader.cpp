@@ -0,0 +1,126 @@
+/**
+ * @file test_plugin_loader.cpp
+ * @brief Unit tests for strategy plugin loading and hot swapping.
+ */
+#include "TestFramework.h"
+#include "kernel/PluginLoader.h"
+#include "kernel/Game.h"
+#include "kernel/Session.h"
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace fs = std::filesystem;
+
+namespace {
+    std::shared_ptr<IPlayer> paperFan() {
+        return std::make_shared<User>("PaperFan", []() { return Combination::Paper; });
+    }
+
+    /// A scratch directory removed when the test ends.
+    struct ScratchDir {
+        fs::path path;
+        explicit ScratchDir(const std::string& name)
+            : path(fs::temp_directory_path() / name) {
+            fs::remove_all(path);
+            fs::create_directories(path);
+        }
+        ~ScratchDir() {
+            std::error_code ec;
+            fs::remove_all(path, ec);
+        }
+    };
+}
+
+TEST_CASE("PluginLoader loads a strategy and creates native players") {
+    PluginLoader loader;
+    auto plugin = loader.load(RSP_TEST_PLUGIN_V1);
+    ASSERT_EQ(plugin->getName(), std::string("fixed"));
+    ASSERT_EQ(plugin->getVersion(), std::string("1"));
+    ASSERT_EQ(loader.getStrategyNames().size(), 1u);
+
+    auto player = loader.createPlayer("fixed");
+    ASSERT_EQ(player->chooseHand().getCombination(), Combination::Rock);
+    ASSERT_EQ(player->getName(), std::string("Fixed-1"));
+    ASSERT_THROWS(loader.createPlayer("missing"), std::invalid_argument);
+}
+
+TEST_CASE("PluginLoader rejects plugins built for another ABI") {
+    PluginLoader loader;
+    ASSERT_THROWS(loader.load(RSP_TEST_PLUGIN_BAD_ABI), PluginError);
+    ASSERT_THROWS(loader.load("/nonexistent/plugin.so"), PluginError);
+    ASSERT_TRUE(loader.getStrategyNames().empty());
+}
+
+TEST_CASE("PluginLoader swaps strategies while in-flight sessions keep theirs") {
+    PluginLoader loader;
+    loader.load(RSP_TEST_PLUGIN_V1);
+    Session inFlight(paperFan(), loader.createPlayer("fixed"), 4);
+    inFlight.playRound();
+
+    loader.load(RSP_TEST_PLUGIN_V2);
+    ASSERT_EQ(loader.find("fixed")->getVersion(), std::string("2"));
+    ASSERT_EQ(loader.createPlayer("fixed")->chooseHand().getCombination(), Combination::Paper);
+
+    // The old session still plays the v1 code (Rock, so Paper wins).
+    inFlight.start();
+    ASSERT_EQ(inFlight.getUserScore(), 4);
+
+    loader.unload("fixed");
+    ASSERT_TRUE(loader.find("fixed") == nullptr);
+    ASSERT_EQ(inFlight.getComputer()->chooseHand().getCombination(), Combination::Rock);
+}
+
+TEST_CASE("Plugin player names stay valid after the plugin is unregistered") {
+    std::shared_ptr<IPlayer> player;
+    {
+        PluginLoader loader;
+        loader.load(RSP_TEST_PLUGIN_V2);
+        player = loader.createPlayer("fixed");
+        loader.unload("fixed");
+    } // the player keeps its library (and its name) alive
+    const std::string_view name = player->getNameView();
+    ASSERT_EQ(name, std::string_view("Fixed-2"));
+    ASSERT_EQ(name.data(), player->getNameView().data());
+}
+
+TEST_CASE("PluginLoader refresh picks up new and rebuilt plugins") {
+    ScratchDir dir("rsp_plugin_refresh_test");
+    const fs::path target = dir.path / "fixed.so";
+    PluginLoader loader;
+
+    ASSERT_EQ(loader.refresh(dir.path.string()), 0u);
+    fs::copy_file(RSP_TEST_PLUGIN_V1, target);
+    fs::copy_file(RSP_TEST_PLUGIN_BAD_ABI, dir.path / "broken.so");
+    ASSERT_EQ(loader.refresh(dir.path.string()), 1u);
+    ASSERT_EQ(loader.getErrors().size(), 1u);
+    ASSERT_EQ(loader.refresh(dir.path.string()), 0u);
+
+    // "Rebuild" in place: same path, new contents and timestamp.
+    fs::copy_file(RSP_TEST_PLUGIN_V2, target, fs::copy_options::overwrite_existing);
+    fs::last_write_time(target, fs::last_write_time(target) + std::chrono::seconds(5));
+    ASSERT_EQ(loader.refresh(dir.path.string()), 1u);
+    ASSERT_EQ(loader.createPlayer("fixed")->chooseHand().getCombination(), Combination::Paper);
+}
+
+TEST_CASE("Game uses a swapped plugin opponent from the next session") {
+    PluginLoader loader;
+    loader.load(RSP_BEAT_LAST_PLUGIN);
+    loader.load(RSP_TEST_PLUGIN_V1);
+
+    Game game(paperFan(), loader.createPlayer("fixed"));
+    game.newSession(3);
+    game.playSingleRound();
+    game.setComputer(loader.createPlayer("beat-last"));
+    game.playSingleRound();
+    game.playSingleRound();
+    ASSERT_EQ(game.getCurrentSession()->getUserScore(), 3);
+
+    game.newSession(3);
+    game.playSingleRound();
+    game.playSingleRound(); // beat-last now answers Paper with Scissors
+    ASSERT_EQ(game.getCurrentSession()->getMoves()[1].getComputerHand().getCombination(),
+              Combination::Scissors);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file test_rng_validator.cpp
+ * @brief Unit tests for the RNG validation suite and bulk generation.
+ */
+#include "TestFramework.h"
+#include "kernel/CounterRng.h"
+#include "kernel/Hand.h"
+#include "kernel/RngValidator.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+    constexpr std::uint64_t SAMPLES = 1 << 19;
+
+    RngGenerator fromFunction(std::string name, std::uint8_t (*next)(std::uint64_t)) {
+        return {std::move(name), [next](std::uint64_t, std::uint64_t first, std::uint8_t* out,
+                                        std::size_t count) {
+                    for (std::size_t i = 0; i < count; ++i) out[i] = next(first + i);
+                }};
+    }
+}
+
+TEST_CASE("chiSquareP matches known tail probabilities") {
+    // df = 2: P = exp(-x / 2).
+    ASSERT_TRUE(std::fabs(RngValidator::chiSquareP(4.605170, 2) - 0.1) < 1e-6);
+    // df = 6, x = 12.5916 is the 5 % critical value.
+    ASSERT_TRUE(std::fabs(RngValidator::chiSquareP(12.5916, 6) - 0.05) < 1e-4);
+    // df = 1, x = 3.841459: 5 %.
+    ASSERT_TRUE(std::fabs(RngValidator::chiSquareP(3.841459, 1) - 0.05) < 1e-5);
+    ASSERT_EQ(RngValidator::chiSquareP(0.0, 4), 1.0);
+}
+
+TEST_CASE("RngValidator accepts the kernel generators") {
+    for (const RngGenerator& g : {RngValidator::handGenerator(), RngValidator::handBulkGenerator(),
+                                  RngValidator::counterGenerator(7)}) {
+        RngReport r = RngValidator::run(g, SAMPLES, 2);
+        ASSERT_EQ(r.counts[0] + r.counts[1] + r.counts[2], SAMPLES);
+        ASSERT_EQ(r.threads, 2u);
+        ASSERT_TRUE(r.passed(1e-6));
+        ASSERT_TRUE(std::fabs(r.serialCorrelation) < 0.01);
+        ASSERT_TRUE(r.runsDf >= 8);
+    }
+}
+
+TEST_CASE("RngValidator flags a biased generator") {
+    // Every tenth gesture forced to Rock: Rock at ~40 % instead of 33 %.
+    RngReport r = RngValidator::run(fromFunction("biased", [](std::uint64_t i) {
+        const auto g = static_cast<std::uint8_t>(CounterRng::combinationAt(5, 0, i));
+        return static_cast<std::uint8_t>(i % 10 == 0 ? 0 : g);
+    }), SAMPLES, 1);
+    ASSERT_TRUE(r.chiSquareP < 1e-6);
+    ASSERT_FALSE(r.passed());
+}
+
+TEST_CASE("RngValidator flags serial structure and wrong run lengths") {
+    // Perfectly balanced frequencies, but fully predictable.
+    RngReport cycle = RngValidator::run(fromFunction("cycle", [](std::uint64_t i) {
+        return static_cast<std::uint8_t>(i % 3);
+    }), SAMPLES, 1);
+    ASSERT_TRUE(cycle.chiSquareP > 0.5);
+    ASSERT_TRUE(cycle.serialP < 1e-12);
+    ASSERT_TRUE(cycle.runsP < 1e-12);
+
+    // Uniform frequencies, but every gesture comes twice: runs too long.
+    RngReport sticky = RngValidator::run(fromFunction("sticky", [](std::uint64_t i) {
+        return static_cast<std::uint8_t>(CounterRng::combinationAt(3, 0, i / 2));
+    }), SAMPLES, 1);
+    ASSERT_TRUE(sticky.chiSquareP > 1e-6);
+    ASSERT_TRUE(sticky.runsP < 1e-12);
+    ASSERT_FALSE(sticky.passed());
+}
+
+TEST_CASE("RngValidator splits samples across threads") {
+    RngReport r = RngValidator::run(RngValidator::counterGenerator(), 100003, 3);
+    ASSERT_EQ(r.samples, 100003u);
+    ASSERT_EQ(r.counts[0] + r.counts[1] + r.counts[2], 100003u);
+    std::uint64_t pairs = 0;
+    for (std::uint64_t p : r.pairs) pairs += p;
+    ASSERT_EQ(pairs, 100003u - 3u); // no pairs across streams
+    ASSERT_TRUE(r.samplesPerSecond > 0.0);
+    ASSERT_TRUE(r.generatedPerSecond > 0.0);
+}
+
+TEST_CASE("Hand::generateCombinations yields valid, balanced gestures") {
+    std::vector<Combination> out(30001);
+    Hand::generateCombinations(out.data(), out.size());
+    std::uint64_t counts[3] = {};
+    for (Combination c : out) {
+        const int v = static_cast<int>(c);
+        ASSERT_TRUE(v >= 0 && v <= 2);
+        ++counts[v];
+    }
+    for (std::uint64_t c : counts) ASSERT_TRUE(c > 9500 && c < 10500);
+    Hand::generateCombinations(out.data(), 0);
+}
+
+BENCHMARK_CASE("Hand::generateCombinations 64k gestures", 200) {
+    static std::vector<Combination> out(RngValidator::BUFFER);
+    Hand::generateCombinations(out.data(), out.size());
+}
@@ -6,7 +6,13 @@
 #include "kernel/Session.h"
 #include "kernel/User.h"
 #include "kernel/ComputerAI.h"
+#include "kernel/MetaAI.h"
+#include "kernel/AllocationTracker.h"
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 /// Helper: creates a User that always plays Rock.
 static std::shared_ptr<IPlayer> makeRockUser() {
@@ -128,3 +134,222 @@ TEST_CASE("Session getMoves returns all played moves") {
 
     ASSERT_EQ(static_cast<int>(s.getMoves().size()), 4);
 }
+
+TEST_CASE("Session with a history limit pages old moves back in") {
+    auto user = std::make_shared<ComputerAI>("A", 11, 1);
+    auto comp = std::make_shared<ComputerAI>("B", 22, 1);
+    std::vector<Move> expected;
+    Session s(user, comp, 1000, 64);
+    s.onRoundCompleted([&](std::int64_t, const Move& m) { expected.push_back(m); });
+    s.start();
+
+    const MoveHistory& moves = s.getMoves();
+    ASSERT_EQ(moves.size(), 1000u);
+    ASSERT_TRUE(moves.getInMemoryCount() <= 64u);
+    ASSERT_TRUE(moves.getSpilledCount() > 0u);
+    std::size_t i = 0;
+    for (const Move& m : moves) {
+        ASSERT_EQ(m.getUserHand(), expected[i].getUserHand());
+        ASSERT_EQ(m.getComputerHand(), expected[i].getComputerHand());
+        ++i;
+    }
+    ASSERT_EQ(i, 1000u);
+}
+
+TEST_CASE("Session accepts round counts beyond 32 bits") {
+    const std::int64_t rounds = 5'000'000'000LL;
+    Session s(makeRockUser(), makeScissorsBot(), rounds, 1024);
+    ASSERT_EQ(s.getTotalRounds(), rounds);
+    for (int i = 0; i < 3; ++i) s.playRound();
+    ASSERT_EQ(s.getRoundsPlayed(), 3);
+    ASSERT_TRUE(s.isRunning());
+    ASSERT_EQ(s.snapshot().totalRounds, rounds);
+}
+
+// ── Throughput ─────────────────────────────────────────────────────
+
+BENCHMARK_CASE("Session: full 10-round session throughput", 10000) {
+    static auto user = makeRockUser();
+    static auto comp = makeScissorsBot();
+    Session s(user, comp);
+    s.start();
+}
+
+BENCHMARK_CASE("Session: 1000 rounds via playBatch", 2000) {
+    static auto user = makeRockUser();
+    static auto comp = makeScissorsBot();
+    Session s(user, comp, 1000);
+    s.playBatch(1000);
+}
+
+// ── playBatch ──────────────────────────────────────────────────────
+
+TEST_CASE("Session playBatch matches round-by-round play") {
+    Session single(std::make_shared<ComputerAI>("A", 5, 9), std::make_shared<ComputerAI>("B", 6, 9), 100);
+    single.start();
+
+    Session batched(std::make_shared<ComputerAI>("A", 5, 9), std::make_shared<ComputerAI>("B", 6, 9), 100);
+    ASSERT_EQ(batched.playBatch(30), 30);
+    ASSERT_EQ(batched.playBatch(30), 30);
+    ASSERT_EQ(batched.playBatch(1000), 40);
+    ASSERT_FALSE(batched.isRunning());
+    ASSERT_THROWS(batched.playBatch(1), std::runtime_error);
+
+    ASSERT_EQ(batched.getUserScore(), single.getUserScore());
+    ASSERT_EQ(batched.getComputerScore(), single.getComputerScore());
+    ASSERT_EQ(batched.getDrawCount(), single.getDrawCount());
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(batched.getMoves()[i].getUserHand(), single.getMoves()[i].getUserHand());
+        ASSERT_EQ(batched.getMoves()[i].getComputerHand(), single.getMoves()[i].getComputerHand());
+    }
+}
+
+TEST_CASE("Session playBatch fires one batch callback and every round callback") {
+    Session s(makeRockUser(), makeScissorsBot(), 10);
+    int batches = 0;
+    int rounds = 0;
+    std::int64_t first = -1;
+    std::size_t count = 0;
+    s.onRoundCompleted([&](std::int64_t, const Move&) { ++rounds; });
+    s.onBatchCompleted([&](std::int64_t f, const Move* moves, std::size_t n) {
+        ++batches;
+        first = f;
+        count = n;
+        for (std::size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(moves[i].getWhoWins(), MoveResult::UserWins);
+        }
+    });
+    s.playRound();
+    ASSERT_EQ(s.playBatch(6), 6);
+    ASSERT_EQ(batches, 1);
+    ASSERT_EQ(rounds, 7);
+    ASSERT_EQ(first, 1);
+    ASSERT_EQ(count, 6u);
+    ASSERT_EQ(s.getUserScore(), 7);
+    ASSERT_EQ(s.snapshot().roundsPlayed, 7);
+    ASSERT_EQ(s.playBatch(0), 0);
+}
+
+TEST_CASE("Session playBatch uses the default chooseHands loop") {
+    int calls = 0;
+    auto counting = std::make_shared<User>("Counter", [&calls]() {
+        ++calls;
+        return Combination::Paper;
+    });
+    Session s(counting, makeRockBot(), 5);
+    s.playBatch(5);
+    ASSERT_EQ(calls, 5);
+    ASSERT_EQ(s.getUserScore(), 5);
+}
+
+TEST_CASE("Session playBatch lets adaptive players react inside the batch") {
+    auto meta = std::make_shared<MetaAI>();
+    Session s(makeRockUser(), meta, 2000);
+    ASSERT_EQ(s.playBatch(2000), 2000);
+    ASSERT_TRUE(s.getComputerScore() > 1900);
+
+    // Non-batchable players alternate choose and observe.
+    std::vector<std::string> calls;
+    class Tracing : public IPlayer {
+    public:
+        explicit Tracing(std::vector<std::string>& log) : log_(log) {}
+        std::string getName() const override { return "Tracing"; }
+        Hand chooseHand() override { log_.push_back("choose"); return Hand(Combination::Rock); }
+        void observeRound(const Hand&, const Hand&) override { log_.push_back("observe"); }
+    private:
+        std::vector<std::string>& log_;
+    };
+    Session t(std::make_shared<Tracing>(calls), std::make_shared<ComputerAI>("B", 1, 1), 3);
+    t.playBatch(3);
+    ASSERT_EQ(calls.size(), 6u);
+    for (std::size_t i = 0; i < calls.size(); ++i) {
+        ASSERT_EQ(calls[i], i % 2 ? "observe" : "choose");
+    }
+}
+
+TEST_CASE("Session playBatch does not allocate once warmed up") {
+    Session s(std::make_shared<ComputerAI>("A", 1, 1), std::make_shared<ComputerAI>("B", 2, 1), 300);
+    s.playBatch(100);
+    ASSERT_NO_ALLOCATIONS(s.playBatch(100));
+}
+
+TEST_CASE("Session whoWinsView matches whoWins without allocating") {
+    auto user = makeRockUser();
+    auto comp = makeScissorsBot();
+    Session s(user, comp, 2);
+    s.start();
+    ASSERT_EQ(std::string(s.whoWinsView()), s.whoWins());
+    ASSERT_NO_ALLOCATIONS(s.whoWinsView());
+}
+
+// ── Cross-thread access ────────────────────────────────────────────
+
+TEST_CASE("Session snapshot is consistent while another thread plays") {
+    auto user = std::make_shared<ComputerAI>("A");
+    auto comp = std::make_shared<ComputerAI>("B");
+    Session s(user, comp, 20000);
+
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::thread spectator([&]() {
+        int lastRound = 0;
+        while (!done.load()) {
+            SessionSnapshot snap = s.snapshot();
+            if (snap.userScore + snap.computerScore + snap.drawCount != snap.roundsPlayed ||
+                snap.roundsPlayed < lastRound) {
+                ++torn;
+            }
+            lastRound = snap.roundsPlayed;
+            std::this_thread::yield();
+        }
+    });
+
+    s.start();
+    done = true;
+    spectator.join();
+
+    ASSERT_EQ(torn.load(), 0);
+    SessionSnapshot last = s.snapshot();
+    ASSERT_EQ(last.roundsPlayed, 20000);
+    ASSERT_FALSE(last.running);
+    ASSERT_EQ(last.userScore, s.getUserScore());
+}
+
+TEST_CASE("Session stop from another thread ends start()") {
+    std::atomic<bool> stopped{false};
+    int rounds = 0;
+    auto user = std::make_shared<User>("Waiter", [&]() {
+        if (++rounds == 10) {
+            while (!stopped.load()) std::this_thread::yield();
+        }
+        return Combination::Rock;
+    });
+    Session s(user, makeScissorsBot(), 1000);
+
+    SessionSnapshot afterStop;
+    std::thread canceller([&]() {
+        while (s.snapshot().roundsPlayed < 9) std::this_thread::yield();
+        s.stop();
+        afterStop = s.snapshot(); // round 10 is still blocked in the user
+        stopped = true;
+    });
+    s.start();
+    canceller.join();
+
+    ASSERT_FALSE(afterStop.running);
+    ASSERT_TRUE(afterStop.endTicks >= afterStop.startTicks);
+    ASSERT_EQ(afterStop.roundsPlayed, 9);
+    ASSERT_EQ(s.getRoundsPlayed(), 10);
+    ASSERT_FALSE(s.isRunning());
+    ASSERT_FALSE(s.snapshot().running);
+}
+
+TEST_CASE("Session stop before start cancels that start") {
+    Session s(makeRockUser(), makeScissorsBot(), 5);
+    s.stop();
+    s.start();
+    ASSERT_EQ(s.getRoundsPlayed(), 0);
+
+    s.start();
+    ASSERT_EQ(s.getRoundsPlayed(), 5);
+}
@@ -0,0 +1,195 @@
+/**
+ * @file test_session_stats.cpp
+ * @brief Unit tests for TDigest, HyperLogLog and SessionSketch.
+ */
+#include "TestFramework.h"
+#include "kernel/Game.h"
+#include "kernel/HyperLogLog.h"
+#include "kernel/SessionStats.h"
+#include "kernel/TDigest.h"
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    /// Plays a finished @p rounds-round session between two fixed gestures.
+    std::unique_ptr<Session> playedSession(const std::string& name, Combination user,
+                                           Combination computer, std::int64_t rounds) {
+        auto u = std::make_shared<User>(name, [user]() { return user; });
+        auto c = std::make_shared<User>("Bot", [computer]() { return computer; });
+        auto session = std::make_unique<Session>(u, c, rounds);
+        session->start();
+        return session;
+    }
+}
+
+TEST_CASE("TDigest quantiles are accurate and the sketch stays small") {
+    TDigest digest;
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> uniform(0.0, 1000.0);
+    for (int i = 0; i < 100000; ++i) digest.add(uniform(rng));
+
+    ASSERT_EQ(digest.getCount(), 100000.0);
+    ASSERT_TRUE(std::fabs(digest.quantile(0.5) - 500.0) < 10.0);
+    ASSERT_TRUE(std::fabs(digest.quantile(0.99) - 990.0) < 2.0);
+    ASSERT_TRUE(std::fabs(digest.quantile(0.001) - 1.0) < 0.5);
+    ASSERT_TRUE(std::fabs(digest.cdf(250.0) - 0.25) < 0.01);
+    ASSERT_TRUE(digest.getCentroidCount() <= 2 * TDigest::DEFAULT_COMPRESSION);
+    ASSERT_TRUE(digest.quantile(0.0) >= digest.getMin());
+    ASSERT_TRUE(digest.quantile(1.0) <= digest.getMax());
+
+    TDigest empty;
+    ASSERT_EQ(empty.quantile(0.5), 0.0);
+}
+
+TEST_CASE("TDigest merge matches a digest of all values") {
+    TDigest parts[4];
+    TDigest all;
+    for (int i = 0; i < 40000; ++i) {
+        const double v = static_cast<double>((i * 7919) % 40000);
+        parts[i % 4].add(v);
+        all.add(v);
+    }
+    TDigest merged;
+    for (const TDigest& p : parts) merged.merge(p);
+
+    ASSERT_EQ(merged.getCount(), all.getCount());
+    ASSERT_EQ(merged.getMin(), 0.0);
+    ASSERT_EQ(merged.getMax(), 39999.0);
+    for (double q : {0.01, 0.25, 0.5, 0.9, 0.999}) {
+        ASSERT_TRUE(std::fabs(merged.quantile(q) - all.quantile(q)) < 40000 * 0.005);
+    }
+}
+
+TEST_CASE("TDigest deserialize rejects an oversized compression") {
+    TDigest digest;
+    for (int i = 0; i < 100; ++i) digest.add(i);
+    std::vector<std::uint8_t> bytes;
+    digest.serialize(bytes);
+
+    const double huge = 1e18; // would reserve exabytes of centroids
+    std::memcpy(bytes.data(), &huge, sizeof huge);
+    TDigest remote;
+    std::size_t pos = 0;
+    ASSERT_FALSE(remote.deserialize(bytes, pos));
+    ASSERT_EQ(pos, 0u);
+    ASSERT_EQ(remote.getCount(), 0.0);
+
+    const double max = TDigest::MAX_COMPRESSION;
+    std::memcpy(bytes.data(), &max, sizeof max);
+    ASSERT_TRUE(remote.deserialize(bytes, pos));
+    ASSERT_EQ(remote.getCount(), 100.0);
+}
+
+TEST_CASE("HyperLogLog estimates distinct items within a few percent") {
+    HyperLogLog a, b;
+    for (int i = 0; i < 60000; ++i) {
+        a.add("player" + std::to_string(i));
+        a.add("player" + std::to_string(i)); // duplicates don't count
+    }
+    for (int i = 40000; i < 100000; ++i) b.add("player" + std::to_string(i));
+
+    ASSERT_TRUE(std::fabs(a.estimate() - 60000) < 60000 * 0.05);
+    a.merge(b);
+    ASSERT_TRUE(std::fabs(a.estimate() - 100000) < 100000 * 0.05);
+
+    HyperLogLog small;
+    for (int i = 0; i < 10; ++i) small.add("p" + std::to_string(i));
+    ASSERT_TRUE(std::fabs(small.estimate() - 10) < 1.0);
+    ASSERT_EQ(HyperLogLog().estimate(), 0.0);
+}
+
+TEST_CASE("SessionSketch counts outcomes, rounds and gestures") {
+    SessionSketch sketch;
+    sketch.record(*playedSession("ann", Combination::Paper, Combination::Rock, 3));
+    sketch.record(*playedSession("bob", Combination::Rock, Combination::Paper, 2));
+    sketch.record(*playedSession("ann", Combination::Rock, Combination::Rock, 4));
+
+    ASSERT_EQ(sketch.getSessions(), 3u);
+    ASSERT_EQ(sketch.getSessions(MoveResult::UserWins), 1u);
+    ASSERT_EQ(sketch.getSessions(MoveResult::ComputerWins), 1u);
+    ASSERT_EQ(sketch.getSessions(MoveResult::Draw), 1u);
+    ASSERT_EQ(sketch.getRounds(), 9u);
+    ASSERT_EQ(sketch.getRounds(MoveResult::UserWins), 3u);
+    ASSERT_EQ(sketch.getRounds(MoveResult::Draw), 4u);
+    ASSERT_EQ(sketch.getUserGestures(Combination::Rock), 6u);
+    ASSERT_EQ(sketch.getUserGestures(Combination::Paper), 3u);
+    ASSERT_EQ(sketch.getComputerGestures(Combination::Paper), 2u);
+    ASSERT_EQ(sketch.getDurations().getCount(), 3.0);
+    ASSERT_TRUE(std::fabs(sketch.getDistinctPlayers() - 3.0) < 0.5); // ann, bob, Bot
+}
+
+TEST_CASE("SessionSketch round-trips through serialize for cross-process merges") {
+    SessionSketch a, b;
+    a.record(*playedSession("ann", Combination::Paper, Combination::Rock, 5));
+    b.record(*playedSession("cat", Combination::Scissors, Combination::Rock, 2));
+
+    SessionSketch remote;
+    ASSERT_TRUE(remote.deserialize(b.serialize()));
+    a.merge(remote);
+    ASSERT_EQ(a.getSessions(), 2u);
+    ASSERT_EQ(a.getRounds(MoveResult::ComputerWins), 2u);
+    ASSERT_EQ(a.getUserGestures(Combination::Scissors), 2u);
+    ASSERT_EQ(a.getDurations().getCount(), 2.0);
+
+    std::vector<std::uint8_t> bytes = a.serialize();
+    bytes.pop_back();
+    ASSERT_FALSE(remote.deserialize(bytes));
+    ASSERT_FALSE(remote.deserialize({}));
+    ASSERT_EQ(remote.getSessions(), 1u); // unchanged on failure
+}
+
+TEST_CASE("SessionStatsCollector merges per-thread shards") {
+    SessionStatsCollector stats;
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; ++t) {
+        pool.emplace_back([&stats, t]() {
+            for (int i = 0; i < 50; ++i) {
+                stats.record(*playedSession("p" + std::to_string(t * 50 + i),
+                                            Combination::Paper, Combination::Rock, 2));
+            }
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    SessionSketch total = stats.snapshot();
+    ASSERT_EQ(total.getSessions(), 200u);
+    ASSERT_EQ(total.getRounds(MoveResult::UserWins), 400u);
+    ASSERT_TRUE(std::fabs(total.getDistinctPlayers() - 201) < 201 * 0.05);
+
+    stats.reset();
+    ASSERT_EQ(stats.snapshot().getSessions(), 0u);
+}
+
+TEST_CASE("Game records finished sessions in its session stats") {
+    auto stats = std::make_shared<SessionStatsCollector>();
+    auto user = std::make_shared<User>("Ann", []() { return Combination::Paper; });
+    auto rock = std::make_shared<User>("Rocky", []() { return Combination::Rock; });
+    Game game(user, rock);
+    game.setSessionStats(stats);
+    game.newSession(3);
+    for (int i = 0; i < 3; ++i) game.playSingleRound();
+
+    SessionSketch s = stats->snapshot();
+    ASSERT_EQ(s.getSessions(), 1u);
+    ASSERT_EQ(s.getSessions(MoveResult::UserWins), 1u);
+    ASSERT_EQ(s.getComputerGestures(Combination::Rock), 3u);
+}
+
+BENCHMARK_CASE("SessionSketch merge", 2000) {
+    static SessionSketch parts[2];
+    static bool filled = false;
+    if (!filled) {
+        for (int i = 0; i < 200; ++i) {
+            parts[i % 2].record(*playedSession("p" + std::to_string(i), Combination::Rock,
+                                               Combination::Paper, 1));
+        }
+        filled = true;
+    }
+    SessionSketch merged = parts[0];
+    merged.merge(parts[1]);
+    ASSERT_EQ(merged.getSessions(), 200u);
+}
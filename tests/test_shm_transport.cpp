@@ -0,0 +1,227 @@
+/**
+ * @file test_shm_transport.cpp
+ * @brief Unit tests for the shared-memory front-end transport.
+ */
+#include "TestFramework.h"
+#include "kernel/ShmClient.h"
+#include "kernel/ShmServer.h"
+#include "kernel/User.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    std::string uniqueName() {
+        static std::atomic<int> counter{0};
+#if defined(_WIN32)
+        const int pid = 0;
+#else
+        const int pid = static_cast<int>(::getpid());
+#endif
+        return "/rsp_test_" + std::to_string(pid) + "_" + std::to_string(counter++);
+    }
+
+    constexpr auto TIMEOUT = std::chrono::microseconds(2000000);
+
+    std::shared_ptr<IPlayer> rockBot() {
+        return std::make_shared<User>("Rocky", []() { return Combination::Rock; });
+    }
+
+    template <typename Pred>
+    bool eventually(Pred pred) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+        while (!pred()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+}
+
+#if !defined(_WIN32)
+
+TEST_CASE("ShmClient plays a full session through the kernel process") {
+    ShmServer server(rockBot);
+    const std::string name = uniqueName();
+    ASSERT_TRUE(server.start(name));
+
+    ShmClient client;
+    ASSERT_TRUE(client.connect(name, "Ann"));
+    ASSERT_TRUE(client.isConnected());
+
+    ShmEvent e;
+    ASSERT_TRUE(client.newSession(3));
+    ASSERT_TRUE(client.waitEvent(e, TIMEOUT));
+    ASSERT_TRUE(e.type == ShmEventType::SessionStarted);
+    ASSERT_EQ(e.round, 3);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(client.play(Combination::Paper));
+        ASSERT_TRUE(client.waitEvent(e, TIMEOUT));
+        ASSERT_TRUE(e.type == ShmEventType::Round);
+        ASSERT_EQ(e.round, i);
+        ASSERT_EQ(e.userHand, static_cast<std::uint8_t>(Combination::Paper));
+        ASSERT_EQ(e.computerHand, static_cast<std::uint8_t>(Combination::Rock));
+        ASSERT_EQ(e.userScore, i + 1);
+    }
+    ASSERT_TRUE(client.waitEvent(e, TIMEOUT));
+    ASSERT_TRUE(e.type == ShmEventType::SessionOver);
+    ASSERT_EQ(e.userScore, 3);
+    ASSERT_EQ(server.getRoundsServed(), 3u);
+
+    client.disconnect();
+    ASSERT_TRUE(eventually([&]() { return server.getClientCount() == 0; }));
+}
+
+TEST_CASE("ShmServer keeps independent sessions per front-end") {
+    ShmServer server(rockBot);
+    const std::string name = uniqueName();
+    ASSERT_TRUE(server.start(name));
+
+    ShmClient a;
+    ShmClient b;
+    ASSERT_TRUE(a.connect(name, "A"));
+    ASSERT_TRUE(b.connect(name, "B"));
+    ShmEvent e;
+    ASSERT_TRUE(a.newSession(5));
+    ASSERT_TRUE(b.newSession(5));
+    ASSERT_TRUE(a.waitEvent(e, TIMEOUT));
+    ASSERT_TRUE(b.waitEvent(e, TIMEOUT));
+
+    ASSERT_TRUE(a.play(Combination::Paper));
+    ASSERT_TRUE(b.play(Combination::Scissors));
+    ASSERT_TRUE(a.waitEvent(e, TIMEOUT));
+    ASSERT_EQ(e.userScore, 1);
+    ASSERT_TRUE(b.waitEvent(e, TIMEOUT));
+    ASSERT_EQ(e.computerScore, 1);
+    ASSERT_TRUE(eventually([&]() { return server.getClientCount() == 2; }));
+}
+
+TEST_CASE("ShmServer rejects invalid requests without dropping the client") {
+    ShmServer server(rockBot);
+    const std::string name = uniqueName();
+    ASSERT_TRUE(server.start(name));
+    ShmClient client;
+    ASSERT_TRUE(client.connect(name, "Ann"));
+
+    ShmEvent e;
+    ASSERT_TRUE(client.play(Combination::Rock)); // no session yet
+    ASSERT_TRUE(client.waitEvent(e, TIMEOUT));
+    ASSERT_TRUE(e.type == ShmEventType::Error);
+    ASSERT_TRUE(client.newSession(0));
+    ASSERT_TRUE(client.waitEvent(e, TIMEOUT));
+    ASSERT_TRUE(e.type == ShmEventType::Error);
+
+    ASSERT_TRUE(client.newSession(1));
+    ASSERT_TRUE(client.waitEvent(e, TIMEOUT));
+    ASSERT_TRUE(client.play(static_cast<Combination>(7)));
+    ASSERT_TRUE(client.waitEvent(e, TIMEOUT));
+    ASSERT_TRUE(e.type == ShmEventType::Error);
+    ASSERT_TRUE(client.isConnected());
+}
+
+TEST_CASE("ShmClient fails cleanly without a server") {
+    ShmClient client;
+    ASSERT_FALSE(client.connect(uniqueName(), "Ann"));
+    ASSERT_FALSE(client.isConnected());
+    ASSERT_FALSE(client.play(Combination::Rock));
+
+    ShmServer server;
+    const std::string name = uniqueName();
+    ASSERT_TRUE(server.start(name));
+    ASSERT_TRUE(client.connect(name, "Ann"));
+    server.stop();
+    ShmEvent e;
+    ASSERT_FALSE(client.isConnected());
+    ASSERT_FALSE(client.waitEvent(e, TIMEOUT));
+}
+
+SERIAL_TEST_CASE("ShmServer reclaims the slot of a crashed front-end") {
+    ShmServer server(rockBot);
+    const std::string name = uniqueName();
+    ASSERT_TRUE(server.start(name));
+
+    const pid_t child = ::fork();
+    if (child == 0) {
+        // Connect, leave a request half-way through a session, and die
+        // without disconnecting.
+        auto* client = new ShmClient();
+        if (client->connect(name, "Crashy")) {
+            client->newSession(10);
+            client->play(Combination::Rock);
+        }
+        ::_exit(0);
+    }
+    ASSERT_TRUE(child > 0);
+    int status = 0;
+    ::waitpid(child, &status, 0);
+
+    // Every slot becomes usable again once the dead client is swept.
+    ShmClient clients[ShmSegment::MAX_SLOTS];
+    for (auto& c : clients) {
+        ASSERT_TRUE(eventually([&]() { return c.connect(name, "Next"); }));
+    }
+    ShmClient extra;
+    ASSERT_FALSE(extra.connect(name, "Extra")); // full
+    ShmEvent e;
+    ASSERT_TRUE(clients[0].newSession(1));
+    ASSERT_TRUE(clients[0].waitEvent(e, TIMEOUT));
+    ASSERT_TRUE(e.type == ShmEventType::SessionStarted);
+}
+
+SERIAL_TEST_CASE("ShmServer replaces only segments of dead servers") {
+    const std::string name = uniqueName();
+    ShmServer live(rockBot);
+    ASSERT_TRUE(live.start(name));
+    ShmClient client;
+    ASSERT_TRUE(client.connect(name, "Loyal"));
+
+    ShmServer rival(rockBot);
+    ASSERT_FALSE(rival.start(name)); // the live kernel keeps its segment
+    ASSERT_TRUE(client.isConnected());
+    client.disconnect();
+    live.stop();
+
+    // A server that dies without stop() leaves its segment behind.
+    const std::string stale = uniqueName();
+    const pid_t child = ::fork();
+    if (child == 0) {
+        auto* crashed = new ShmServer(rockBot);
+        ::_exit(crashed->start(stale) ? 0 : 1);
+    }
+    ASSERT_TRUE(child > 0);
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    ShmServer successor(rockBot);
+    ASSERT_TRUE(successor.start(stale));
+    ASSERT_TRUE(client.connect(stale, "Back"));
+}
+
+BENCHMARK_CASE("ShmClient play round trip", 20000) {
+    static ShmServer server(rockBot);
+    static ShmClient client;
+    static bool ready = false;
+    if (!ready) {
+        const std::string name = uniqueName();
+        server.start(name);
+        client.connect(name, "Bench");
+        ready = true;
+    }
+    ShmEvent e;
+    client.newSession(1);
+    client.waitEvent(e, TIMEOUT);
+    client.play(Combination::Paper);
+    client.waitEvent(e, TIMEOUT);
+    client.waitEvent(e, TIMEOUT);
+    ASSERT_TRUE(e.type == ShmEventType::SessionOver);
+}
+
+#endif
@@ -0,0 +1,165 @@
+/**
+ * @file test_simulation_coordinator.cpp
+ * @brief Unit tests for the multi-process SimulationCoordinator.
+ */
+#include "TestFramework.h"
+#include "kernel/ComputerAI.h"
+#include "kernel/SimulationCoordinator.h"
+#include "kernel/User.h"
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace {
+    std::shared_ptr<IPlayer> seeded(std::uint64_t seed, std::uint64_t session) {
+        return std::make_shared<ComputerAI>("Seeded", seed, session, 0);
+    }
+
+    std::shared_ptr<IPlayer> rock(std::uint64_t, std::uint64_t) {
+        return std::make_shared<User>("Rock", []() { return Combination::Rock; });
+    }
+
+    SimulationJob sweep() {
+        SimulationJob job;
+        job.strategies = {{"seeded", seeded}, {"rock", rock}};
+        job.opponent = [](std::uint64_t seed, std::uint64_t session) {
+            return std::make_shared<ComputerAI>("Computer", seed, session);
+        };
+        job.seeds = {1, 2, 3, 4, 5};
+        job.sessionsPerShard = 4;
+        job.roundsPerSession = 50;
+        return job;
+    }
+
+    /// The result every run of sweep() must reproduce, computed in-process.
+    std::vector<SessionSketch> expected(const SimulationJob& job) {
+        std::vector<SessionSketch> out(job.strategies.size());
+        for (std::size_t s = 0; s < job.getShardCount(); ++s) {
+            out[s / job.seeds.size()].merge(SimulationCoordinator::runShard(job, s));
+        }
+        return out;
+    }
+
+    bool sameCounts(const SessionSketch& a, const SessionSketch& b) {
+        for (MoveResult r : {MoveResult::UserWins, MoveResult::ComputerWins, MoveResult::Draw}) {
+            if (a.getSessions(r) != b.getSessions(r) || a.getRounds(r) != b.getRounds(r)) {
+                return false;
+            }
+        }
+        for (Combination c : {Combination::Rock, Combination::Paper, Combination::Scissors}) {
+            if (a.getUserGestures(c) != b.getUserGestures(c) ||
+                a.getComputerGestures(c) != b.getComputerGestures(c)) {
+                return false;
+            }
+        }
+        return a.getSessions() == b.getSessions();
+    }
+}
+
+TEST_CASE("SimulationCoordinator rejects incomplete jobs") {
+    SimulationCoordinator coordinator;
+    SimulationJob job = sweep();
+    job.seeds.clear();
+    ASSERT_THROWS(coordinator.run(job), std::invalid_argument);
+    job = sweep();
+    job.opponent = nullptr;
+    ASSERT_THROWS(coordinator.run(job), std::invalid_argument);
+    ASSERT_THROWS(SimulationCoordinator::runShard(sweep(), 10), std::out_of_range);
+}
+
+SERIAL_TEST_CASE("SimulationCoordinator merges worker results like an in-process run") {
+    const SimulationJob job = sweep();
+    CoordinatorConfig config;
+    config.workers = 3;
+    const SimulationResult r = SimulationCoordinator(config).run(job);
+
+    ASSERT_EQ(r.shardsCompleted, job.getShardCount());
+    ASSERT_TRUE(r.failedShards.empty());
+    ASSERT_EQ(r.workersStarted, 3u);
+    ASSERT_EQ(r.workersLost, 0u);
+    const auto want = expected(job);
+    ASSERT_EQ(r.byStrategy.size(), 2u);
+    ASSERT_TRUE(sameCounts(r.byStrategy[0], want[0]));
+    ASSERT_TRUE(sameCounts(r.byStrategy[1], want[1]));
+    ASSERT_EQ(r.byStrategy[1].getUserGestures(Combination::Rock), 5u * 4u * 50u);
+    ASSERT_EQ(r.byStrategy[0].getDurations().getCount(), 20.0);
+}
+
+#if !defined(_WIN32)
+
+SERIAL_TEST_CASE("SimulationCoordinator reassigns the shard of a crashed worker") {
+    const std::string marker = "rsp_coord_crash_" + std::to_string(::getpid());
+    std::remove(marker.c_str());
+
+    SimulationJob job = sweep();
+    job.strategies[1].make = [marker](std::uint64_t seed, std::uint64_t session) {
+        if (seed == 3 && session == 0) {
+            if (std::FILE* f = std::fopen(marker.c_str(), "wx")) { // first attempt only
+                std::fclose(f);
+                ::_exit(3);
+            }
+        }
+        return rock(seed, session);
+    };
+    CoordinatorConfig config;
+    config.workers = 2;
+    const SimulationResult r = SimulationCoordinator(config).run(job);
+    std::remove(marker.c_str());
+
+    ASSERT_EQ(r.shardsCompleted, job.getShardCount());
+    ASSERT_TRUE(r.failedShards.empty());
+    ASSERT_EQ(r.workersLost, 1u);
+    ASSERT_EQ(r.shardsRetried, 1u);
+    ASSERT_EQ(r.workersStarted, 3u); // one replacement
+    ASSERT_TRUE(sameCounts(r.byStrategy[1], expected(sweep())[1]));
+}
+
+SERIAL_TEST_CASE("SimulationCoordinator gives up on shards that keep failing") {
+    SimulationJob job = sweep();
+    job.strategies[0].make = [](std::uint64_t seed, std::uint64_t session) {
+        if (seed == 2) ::_exit(1);                                    // crashes the worker
+        if (seed == 4) throw std::runtime_error("bad strategy");     // fails cleanly
+        return seeded(seed, session);
+    };
+    CoordinatorConfig config;
+    config.workers = 2;
+    config.maxAttempts = 2;
+    const SimulationResult r = SimulationCoordinator(config).run(job);
+
+    ASSERT_EQ(r.shardsCompleted, job.getShardCount() - 2);
+    ASSERT_EQ(r.failedShards.size(), 2u);
+    ASSERT_EQ(r.failedShards[0], 1u); // strategy 0, seed index 1
+    ASSERT_EQ(r.failedShards[1], 3u); // strategy 0, seed index 3
+    ASSERT_EQ(r.workersLost, 2u);     // only the crashes cost a worker
+    ASSERT_EQ(r.byStrategy[0].getSessions(), 3u * 4u);
+    ASSERT_EQ(r.byStrategy[1].getSessions(), 5u * 4u);
+}
+
+SERIAL_TEST_CASE("SimulationCoordinator kills workers that exceed the shard timeout") {
+    SimulationJob job = sweep();
+    job.strategies[1].make = [](std::uint64_t seed, std::uint64_t session) {
+        if (seed == 5) std::this_thread::sleep_for(std::chrono::seconds(30)); // hangs
+        return rock(seed, session);
+    };
+    CoordinatorConfig config;
+    config.workers = 2;
+    config.maxAttempts = 1;
+    config.shardTimeout = std::chrono::milliseconds(300);
+
+    const auto start = std::chrono::steady_clock::now();
+    const SimulationResult r = SimulationCoordinator(config).run(job);
+    ASSERT_TRUE(std::chrono::steady_clock::now() - start < std::chrono::seconds(10));
+
+    ASSERT_EQ(r.failedShards.size(), 1u);
+    ASSERT_EQ(r.failedShards[0], 9u);
+    ASSERT_EQ(r.workersLost, 1u);
+    ASSERT_EQ(r.shardsCompleted, job.getShardCount() - 1);
+}
+
+#endif
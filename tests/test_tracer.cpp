@@ -0,0 +1,131 @@
+/**
+ * @file test_tracer.cpp
+ * @brief Unit tests for the Chrome trace-event recorder.
+ *
+ * The tracer is process-global, so these run as serial tests.
+ */
+#include "TestFramework.h"
+#include "kernel/Tracer.h"
+#include "kernel/Game.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    std::string readFile(const std::string& path) {
+        std::ifstream in(path);
+        std::stringstream ss;
+        ss << in.rdbuf();
+        return ss.str();
+    }
+
+    std::size_t countOf(const std::string& text, const std::string& needle) {
+        std::size_t n = 0;
+        for (auto pos = text.find(needle); pos != std::string::npos;
+             pos = text.find(needle, pos + 1)) {
+            ++n;
+        }
+        return n;
+    }
+
+    std::unique_ptr<Game> makeHeadlessGame() {
+        return std::make_unique<Game>(
+            std::make_shared<User>("Tracy", []() { return Combination::Paper; }),
+            std::make_shared<ComputerAI>());
+    }
+}
+
+TEST_CASE("TraceScope records nothing while tracing is off") {
+    ASSERT_FALSE(Tracer::isEnabled());
+    { TraceScope t("idle", "test"); }
+    ASSERT_FALSE(Tracer::isEnabled());
+}
+
+SERIAL_TEST_CASE("Tracer writes session lifecycle events as trace JSON") {
+    const std::string path = "rsp_trace_test.json";
+    ASSERT_TRUE(Tracer::start(path));
+    ASSERT_TRUE(Tracer::isEnabled());
+    ASSERT_FALSE(Tracer::start(path));
+
+    auto game = makeHeadlessGame();
+    game->newSession(3);
+    for (int i = 0; i < 3; ++i) game->playSingleRound();
+    Tracer::stop();
+    ASSERT_FALSE(Tracer::isEnabled());
+
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    ASSERT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    ASSERT_TRUE(json.find("]}") != std::string::npos);
+    ASSERT_EQ(countOf(json, "\"Game::newSession\""), 1u);
+    ASSERT_EQ(countOf(json, "\"Session::playRound\""), 3u);
+    ASSERT_EQ(countOf(json, "\"user.chooseHand\""), 3u);
+    ASSERT_EQ(countOf(json, "\"computer.chooseHand\""), 3u);
+    ASSERT_EQ(countOf(json, "\"observeRound\""), 3u);
+    ASSERT_EQ(countOf(json, "\"roundCallback\""), 3u);
+    ASSERT_TRUE(json.find("\"ph\":\"X\"") != std::string::npos);
+    ASSERT_TRUE(json.find("\"thread_name\"") != std::string::npos);
+    ASSERT_EQ(Tracer::getDroppedCount(), 0u);
+}
+
+SERIAL_TEST_CASE("Tracer tolerates concurrent stop calls") {
+    const std::string path = "rsp_trace_stop_test.json";
+    for (int attempt = 0; attempt < 20; ++attempt) {
+        ASSERT_TRUE(Tracer::start(path, std::chrono::milliseconds(1)));
+        { TraceScope t("work", "test"); }
+        std::vector<std::thread> stoppers;
+        for (int i = 0; i < 4; ++i) stoppers.emplace_back([]() { Tracer::stop(); });
+        for (auto& t : stoppers) t.join();
+        ASSERT_FALSE(Tracer::isEnabled());
+    }
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    ASSERT_EQ(countOf(json, "]}"), 1u);
+    ASSERT_EQ(countOf(json, "\"work\""), 1u);
+}
+
+SERIAL_TEST_CASE("Tracer gives each recording thread its own tid") {
+    const std::string path = "rsp_trace_threads.json";
+    ASSERT_TRUE(Tracer::start(path, std::chrono::milliseconds(1)));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([]() {
+            auto game = makeHeadlessGame();
+            game->newSession(5);
+            for (int i = 0; i < 5; ++i) game->playSingleRound();
+        });
+    }
+    for (auto& th : threads) th.join();
+    Tracer::stop();
+
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    ASSERT_EQ(countOf(json, "\"Session::playRound\""), 15u);
+
+    std::set<std::string> tids;
+    for (auto pos = json.find("\"Game::newSession\""); pos != std::string::npos;
+         pos = json.find("\"Game::newSession\"", pos + 1)) {
+        const auto t = json.find("\"tid\":", pos);
+        tids.insert(json.substr(t, json.find('}', t) - t));
+    }
+    ASSERT_EQ(tids.size(), 3u);
+}
+
+SERIAL_TEST_CASE("Tracer counts events dropped by a full ring") {
+    const std::string path = "rsp_trace_drop.json";
+    ASSERT_TRUE(Tracer::start(path, std::chrono::seconds(10)));
+    const std::int64_t now = Tracer::nowNs();
+    for (int i = 0; i < 10000; ++i) {
+        Tracer::record("burst", "test", now, 1);
+    }
+    ASSERT_TRUE(Tracer::getDroppedCount() > 0u);
+    Tracer::stop();
+    std::remove(path.c_str());
+}
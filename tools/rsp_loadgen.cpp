@@ -0,0 +1,315 @@
+/**
+ * @file rsp_loadgen.cpp
+ * @brief Synthetic load generator for the Game API.
+ *
+ * Simulates N virtual users, each owning a Game whose User player reads
+ * its choice from an input callback, and drives them through
+ * Game::newSession() / Game::playSingleRound() on a pool of threads.
+ *
+ * Two load models are supported:
+ * - **Closed loop** (default): every virtual user plays a round, waits
+ *   a think time drawn from the chosen distribution, and repeats.
+ * - **Open loop** (`--rate R`): rounds arrive as a Poisson process at
+ *   R rounds/s regardless of how fast the kernel answers; latency is
+ *   measured from the scheduled arrival, so queueing delay is included
+ *   (no coordinated omission).
+ *
+ * The run is repeated for every thread count given to `--threads`, and
+ * a throughput / p50 / p99 / p999 table shows how the kernel scales.
+ * Everything runs in-process.
+ *
+ * Usage:
+ * @code
+ *   rsp_loadgen [--users N] [--threads 1,2,4] [--seconds S]
+ *               [--rounds R] [--think none|fixed:US|exp:US|uniform:US:US]
+ *               [--rate ROUNDS_PER_SEC] [--seed S]
+ * @endcode
+ */
+
+#include "kernel/Game.h"
+#include "kernel/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief Think-time distribution between two rounds of one user.
+struct ThinkTime {
+    enum class Kind { None, Fixed, Exponential, Uniform };
+    Kind   kind = Kind::None;
+    double a = 0.0; ///< Fixed value, mean, or lower bound (µs).
+    double b = 0.0; ///< Upper bound for Uniform (µs).
+
+    /// @throws std::invalid_argument on an unknown kind or bad parameters.
+    static ThinkTime parse(const std::string& spec) {
+        ThinkTime t;
+        std::istringstream in(spec);
+        std::string kind;
+        std::getline(in, kind, ':');
+        std::string x, y;
+        std::getline(in, x, ':');
+        std::getline(in, y, ':');
+        if      (kind == "none")    { t.kind = Kind::None; }
+        else if (kind == "fixed")   { t.kind = Kind::Fixed;       t.a = micros(x); }
+        else if (kind == "exp")     { t.kind = Kind::Exponential; t.a = micros(x); }
+        else if (kind == "uniform") { t.kind = Kind::Uniform;     t.a = micros(x); t.b = micros(y); }
+        else throw std::invalid_argument("unknown --think kind '" + kind + "'");
+
+        if (t.kind == Kind::Exponential && t.a <= 0.0) {
+            throw std::invalid_argument("--think exp needs a positive mean");
+        }
+        if (t.kind == Kind::Uniform && t.a > t.b) {
+            throw std::invalid_argument("--think uniform needs LOW <= HIGH");
+        }
+        return t;
+    }
+
+    /// A non-negative number of microseconds.
+    static double micros(const std::string& s) {
+        char* end = nullptr;
+        const double v = std::strtod(s.c_str(), &end);
+        if (s.empty() || *end != '\0' || !(v >= 0.0)) {
+            throw std::invalid_argument("bad --think value '" + s + "'");
+        }
+        return v;
+    }
+
+    Clock::duration sample(std::mt19937_64& rng) const {
+        double us = 0.0;
+        switch (kind) {
+            case Kind::None:        break;
+            case Kind::Fixed:       us = a; break;
+            case Kind::Exponential: us = std::exponential_distribution<double>(1.0 / a)(rng); break;
+            case Kind::Uniform:     us = std::uniform_real_distribution<double>(a, b)(rng); break;
+        }
+        return std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::micro>(us));
+    }
+};
+
+struct Options {
+    int users = 64;
+    std::vector<unsigned> threads{1};
+    double seconds = 2.0;
+    int rounds = Session::DEFAULT_ROUNDS;
+    ThinkTime think;
+    double rate = 0.0; ///< Open-loop rounds/s across all users (0 = closed loop).
+    std::uint64_t seed = 42;
+};
+
+/// @brief One virtual user: a Game plus the choice its input callback returns.
+struct VirtualUser {
+    std::shared_ptr<Combination> nextChoice = std::make_shared<Combination>(Combination::Rock);
+    std::unique_ptr<Game> game;
+    Clock::time_point due; ///< When this user's next round should start.
+
+    explicit VirtualUser(int id) {
+        auto choice = nextChoice;
+        auto user = std::make_shared<User>("vu" + std::to_string(id),
+                                           [choice]() { return *choice; });
+        game = std::make_unique<Game>(user, std::make_shared<ComputerAI>());
+    }
+};
+
+struct WorkerResult {
+    LatencyHistogram latency;
+    std::uint64_t rounds = 0;
+    std::uint64_t sessions = 0;
+};
+
+/// Drives the users [begin, end) until @p stopAt.
+void runWorker(const Options& opts, int begin, int end, Clock::time_point stopAt,
+               std::uint64_t seed, WorkerResult& out) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> gesture(0, 2);
+    const int count = end - begin;
+    const double perUserRate = opts.rate > 0 ? opts.rate / opts.users : 0.0;
+
+    std::vector<VirtualUser> users;
+    users.reserve(static_cast<std::size_t>(count));
+    const Clock::time_point t0 = Clock::now();
+    for (int i = begin; i < end; ++i) {
+        users.emplace_back(i);
+        users.back().due = t0;
+    }
+
+    auto nextArrival = [&](Clock::time_point from) {
+        double us = std::exponential_distribution<double>(perUserRate)(rng) * 1e6;
+        return from + std::chrono::duration_cast<Clock::duration>(
+                          std::chrono::duration<double, std::micro>(us));
+    };
+    if (perUserRate > 0) {
+        for (auto& vu : users) vu.due = nextArrival(t0);
+    }
+
+    // Min-heap of (due time, user index): serve whoever is due first.
+    using Entry = std::pair<Clock::time_point, std::size_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    for (std::size_t i = 0; i < users.size(); ++i) queue.emplace(users[i].due, i);
+
+    while (!queue.empty() && queue.top().first < stopAt) {
+        const std::size_t index = queue.top().second;
+        queue.pop();
+        VirtualUser& vu = users[index];
+        if (Clock::now() < vu.due) std::this_thread::sleep_until(vu.due);
+
+        if (vu.game->getState() != GameState::Running) {
+            vu.game->newSession(opts.rounds);
+            ++out.sessions;
+        }
+        *vu.nextChoice = static_cast<Combination>(gesture(rng));
+
+        const Clock::time_point start = perUserRate > 0 ? vu.due : Clock::now();
+        vu.game->playSingleRound();
+        const Clock::time_point done = Clock::now();
+
+        out.latency.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(done - start).count()));
+        ++out.rounds;
+
+        vu.due = perUserRate > 0 ? nextArrival(vu.due) : done + opts.think.sample(rng);
+        queue.emplace(vu.due, index);
+    }
+}
+
+/// Whole string as a decimal integer; @throws std::invalid_argument.
+std::uint64_t parseU64(const std::string& key, const std::string& val) {
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long v = std::strtoull(val.c_str(), &end, 10);
+    if (val.empty() || val[0] == '-' || *end != '\0' || errno == ERANGE) {
+        throw std::invalid_argument("bad value '" + val + "' for " + key);
+    }
+    return v;
+}
+
+/// Whole string as an int in [@p lo, @p hi]; @throws std::invalid_argument.
+int parseInt(const std::string& key, const std::string& val, int lo, int hi) {
+    const std::uint64_t v = parseU64(key, val);
+    if (v < static_cast<std::uint64_t>(lo) || v > static_cast<std::uint64_t>(hi)) {
+        throw std::invalid_argument(key + " must be in [" + std::to_string(lo) + ", " +
+                                    std::to_string(hi) + "]");
+    }
+    return static_cast<int>(v);
+}
+
+/// Whole string as a non-negative number; @throws std::invalid_argument.
+double parseDouble(const std::string& key, const std::string& val) {
+    char* end = nullptr;
+    const double v = std::strtod(val.c_str(), &end);
+    if (val.empty() || *end != '\0' || !(v >= 0.0) || v == HUGE_VAL) {
+        throw std::invalid_argument("bad value '" + val + "' for " + key);
+    }
+    return v;
+}
+
+std::vector<unsigned> parseList(const std::string& key, const std::string& s) {
+    std::vector<unsigned> out;
+    std::istringstream in(s);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        out.push_back(static_cast<unsigned>(parseInt(key, item, 1, 4096)));
+    }
+    if (out.empty()) throw std::invalid_argument("empty " + key);
+    return out;
+}
+
+/// @throws std::invalid_argument on unknown, dangling or malformed options.
+Options parseArgs(int argc, char** argv) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        const std::string key = argv[i];
+        if (key != "--users" && key != "--threads" && key != "--seconds" && key != "--rounds" &&
+            key != "--think" && key != "--rate" && key != "--seed") {
+            throw std::invalid_argument("unknown option " + key);
+        }
+        if (i + 1 >= argc) throw std::invalid_argument("missing value for " + key);
+        const std::string val = argv[++i];
+        if      (key == "--users")   o.users = parseInt(key, val, 1, 1000000);
+        else if (key == "--threads") o.threads = parseList(key, val);
+        else if (key == "--seconds") o.seconds = parseDouble(key, val);
+        else if (key == "--rounds")  o.rounds = parseInt(key, val, 1, std::numeric_limits<int>::max());
+        else if (key == "--think")   o.think = ThinkTime::parse(val);
+        else if (key == "--rate")    o.rate = parseDouble(key, val);
+        else                         o.seed = parseU64(key, val);
+    }
+    if (!(o.seconds > 0.0)) throw std::invalid_argument("--seconds must be positive");
+    return o;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    try {
+        opts = parseArgs(argc, argv);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "  rsp_loadgen: " << e.what() << "\n"
+                  << "  usage: rsp_loadgen [--users N] [--threads 1,2,4] [--seconds S]\n"
+                  << "                     [--rounds R] [--think none|fixed:US|exp:US|uniform:US:US]\n"
+                  << "                     [--rate ROUNDS_PER_SEC] [--seed S]\n";
+        return 2;
+    }
+
+    std::cout << "\n  rsp_loadgen: " << opts.users << " virtual users, "
+              << opts.seconds << " s per run, "
+              << (opts.rate > 0 ? "open loop at " + std::to_string(static_cast<long long>(opts.rate)) + " rounds/s"
+                                : std::string("closed loop"))
+              << "\n\n"
+              << "  threads     rounds   sessions    rounds/s     p50(us)     p99(us)    p999(us)\n";
+
+    for (unsigned threads : opts.threads) {
+        threads = std::max(1u, std::min<unsigned>(threads, static_cast<unsigned>(opts.users)));
+        std::vector<WorkerResult> results(threads);
+        std::vector<std::thread> pool;
+
+        const Clock::time_point begin = Clock::now();
+        const Clock::time_point stopAt = begin + std::chrono::duration_cast<Clock::duration>(
+                                                     std::chrono::duration<double>(opts.seconds));
+        for (unsigned t = 0; t < threads; ++t) {
+            const int lo = static_cast<int>(opts.users * t / threads);
+            const int hi = static_cast<int>(opts.users * (t + 1) / threads);
+            pool.emplace_back(runWorker, std::cref(opts), lo, hi, stopAt,
+                              opts.seed + t, std::ref(results[t]));
+        }
+        for (auto& th : pool) th.join();
+        const double elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+
+        WorkerResult total;
+        for (const auto& r : results) {
+            total.latency.merge(r.latency);
+            total.rounds   += r.rounds;
+            total.sessions += r.sessions;
+        }
+
+        auto us = [&](double q) { return total.latency.percentile(q) / 1000.0; };
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(9)  << threads
+                  << std::setw(11) << total.rounds
+                  << std::setw(11) << total.sessions
+                  << std::setw(12) << std::setprecision(0) << total.rounds / elapsed
+                  << std::setprecision(2)
+                  << std::setw(12) << us(0.50)
+                  << std::setw(12) << us(0.99)
+                  << std::setw(12) << us(0.999) << "\n";
+    }
+    std::cout << "\n";
+    return 0;
+}
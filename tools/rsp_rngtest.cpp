@@ -0,0 +1,153 @@
+/**
+ * @file rsp_rngtest.cpp
+ * @brief Fairness and throughput validation of the gesture generators.
+ *
+ * Streams N gestures from each selected generator through RngValidator
+ * for every thread count given to `--threads`, and prints a table of
+ * p-values (frequency, serial pairs, lag-1 correlation, run lengths)
+ * next to generation and end-to-end throughput.  A p-value below
+ * `--alpha` marks the row as FAIL; the exit code is non-zero if any
+ * row failed.
+ *
+ * Usage:
+ * @code
+ *   rsp_rngtest [--samples N] [--threads 1,2,4]
+ *               [--generator all|hand|bulk|counter] [--seed S] [--alpha A]
+ * @endcode
+ */
+
+#include "kernel/RngValidator.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::uint64_t samples = 100000000;
+    std::vector<unsigned> threads{std::max(1u, std::thread::hardware_concurrency())};
+    std::string generator = "all";
+    std::uint64_t seed = 1;
+    double alpha = 1e-4;
+};
+
+/// Fewer gestures leave the serial-pair cells too sparse for chi-square.
+constexpr std::uint64_t MIN_SAMPLES = 10000;
+
+/// Whole string as a decimal integer; @throws std::invalid_argument.
+std::uint64_t parseU64(const std::string& key, const std::string& val) {
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long v = std::strtoull(val.c_str(), &end, 10);
+    if (val.empty() || val[0] == '-' || *end != '\0' || errno == ERANGE) {
+        throw std::invalid_argument("bad value '" + val + "' for " + key);
+    }
+    return v;
+}
+
+/// Whole string as a number; @throws std::invalid_argument.
+double parseDouble(const std::string& key, const std::string& val) {
+    char* end = nullptr;
+    const double v = std::strtod(val.c_str(), &end);
+    if (val.empty() || *end != '\0') {
+        throw std::invalid_argument("bad value '" + val + "' for " + key);
+    }
+    return v;
+}
+
+std::vector<unsigned> parseList(const std::string& key, const std::string& s) {
+    std::vector<unsigned> out;
+    std::istringstream in(s);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        const std::uint64_t n = parseU64(key, item);
+        if (n < 1 || n > 4096) throw std::invalid_argument("bad thread count '" + item + "'");
+        out.push_back(static_cast<unsigned>(n));
+    }
+    if (out.empty()) throw std::invalid_argument("empty " + key);
+    return out;
+}
+
+/// @throws std::invalid_argument on unknown, dangling or malformed options.
+Options parseArgs(int argc, char** argv) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        const std::string key = argv[i];
+        if (key != "--samples" && key != "--threads" && key != "--generator" &&
+            key != "--seed" && key != "--alpha") {
+            throw std::invalid_argument("unknown option " + key);
+        }
+        if (i + 1 >= argc) throw std::invalid_argument("missing value for " + key);
+        const std::string val = argv[++i];
+        if      (key == "--samples")   o.samples = parseU64(key, val);
+        else if (key == "--threads")   o.threads = parseList(key, val);
+        else if (key == "--generator") o.generator = val;
+        else if (key == "--seed")      o.seed = parseU64(key, val);
+        else                           o.alpha = parseDouble(key, val);
+    }
+    if (o.samples < MIN_SAMPLES) {
+        throw std::invalid_argument("--samples must be at least " + std::to_string(MIN_SAMPLES));
+    }
+    if (!(o.alpha > 0.0 && o.alpha < 1.0)) {
+        throw std::invalid_argument("--alpha must be in (0, 1)");
+    }
+    if (o.generator != "all" && o.generator != "hand" && o.generator != "bulk" &&
+        o.generator != "counter") {
+        throw std::invalid_argument("unknown generator " + o.generator);
+    }
+    return o;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    try {
+        opts = parseArgs(argc, argv);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "  rsp_rngtest: " << e.what() << "\n"
+                  << "  usage: rsp_rngtest [--samples N] [--threads 1,2,4]\n"
+                  << "                     [--generator all|hand|bulk|counter] [--seed S] [--alpha A]\n";
+        return 2;
+    }
+
+    std::vector<RngGenerator> generators;
+    if (opts.generator == "all" || opts.generator == "hand")    generators.push_back(RngValidator::handGenerator());
+    if (opts.generator == "all" || opts.generator == "bulk")    generators.push_back(RngValidator::handBulkGenerator());
+    if (opts.generator == "all" || opts.generator == "counter") generators.push_back(RngValidator::counterGenerator(opts.seed));
+
+    std::cout << "\n  rsp_rngtest: " << opts.samples << " gestures per run, alpha " << opts.alpha
+              << "\n\n"
+              << "  generator                    threads   p(freq)  p(serial)    p(corr)    p(runs)"
+              << "   gen Mg/s/thr   total Mg/s  verdict\n";
+
+    bool allPassed = true;
+    for (const RngGenerator& g : generators) {
+        for (unsigned threads : opts.threads) {
+            const RngReport r = RngValidator::run(g, opts.samples, threads);
+            const bool ok = r.passed(opts.alpha);
+            allPassed = allPassed && ok;
+            std::cout << "  " << std::left << std::setw(28) << r.generator << std::right
+                      << std::setw(8) << r.threads
+                      << std::scientific << std::setprecision(2)
+                      << std::setw(10) << r.chiSquareP
+                      << std::setw(11) << r.serialP
+                      << std::setw(11) << r.serialCorrelationP
+                      << std::setw(11) << r.runsP
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(15) << r.generatedPerSecond / 1e6
+                      << std::setw(13) << r.samplesPerSecond / 1e6
+                      << "  " << (ok ? "ok" : "FAIL") << "\n";
+        }
+    }
+    std::cout << "\n";
+    return allPassed ? 0 : 1;
+}